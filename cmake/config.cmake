@@ -42,12 +42,30 @@ endfunction()
 option(FIBER_CTEST "Enables testing with ctest on local host machines" OFF)
 option(FIBER_COMPILE_TESTS "If ON compiles the test sources" OFF)
 
+# ================================================================================
+#                                Benchmarks
+# ================================================================================
+
+option(FIBER_BENCHMARK "Builds the `bench_runner` executable for benchmarks on local host machines" OFF)
+option(FIBER_COMPILE_BENCHMARKS "If ON compiles the benchmark sources" OFF)
+
+if(FIBER_BENCHMARK AND NOT FIBER_COMPILE_BENCHMARKS)
+    message(STATUS "fiber: Enabling `FIBER_COMPILE_BENCHMARKS = ON`, because `FIBER_BENCHMARK = ON`")
+    set(FIBER_COMPILE_BENCHMARKS ON)
+endif()
+
 # ================================================================================
 #                                CPU
 # ================================================================================
 
 option(FIBER_MULTI_CORE "Enables multicore features and safeguards" OFF)
 
+# ================================================================================
+#                                Futures
+# ================================================================================
+
+set_default_cache_variable(FIBER_CONTINUATION_SIZE 16 "Maximum size in bytes of a callable that is stored inline in a future continuation")
+
 # ================================================================================
 #                                system stubs
 # ================================================================================
@@ -124,6 +142,7 @@ option(FIBER_DISABLE_UTF8_CODES "If `OFF` enables UTF8 codes, for exampample lin
 # General Number Formating
 # ------------------------
 option(FIBER_FMT_MINIMAL "Disables runtime configurability but offers more performant code and smaller binaries" OFF)
+option(FIBER_FMT_EXACT_DIGITS "Rounds floats from their exact digits if the fixed point fast path does not fit. Costs about 1.1 KB of stack per double print instead of a 24 character digit buffer." OFF)
 
 # Bool Formating
 # --------------
@@ -144,6 +163,7 @@ option(FIBER_FMT_FORCE_EXPONENT "forces an exponent, even if the exponent is zer
 option(FIBER_FMT_FORCE_EXPONENT_SIGN "forces a sign on the exponent, even if the exponent is positive. Depends on `FIBER_FMT_MINIMAL`." OFF)
 
 set_default_cache_variable(FIBER_FMT_FLOAT_DECIMALS 3 "Number of decimal places for float formatting. Depends on `FIBER_FMT_MINIMAL`.")
+option(FIBER_FMT_FLOAT_SHORTEST "Prints the shortest digits that read back as the same value instead of rounding to `FIBER_FMT_FLOAT_DECIMALS`. Depends on `FIBER_FMT_MINIMAL`." OFF)
 
 
 ## Float Representations 
@@ -165,11 +185,13 @@ set_exactly_one("${_fiber_float_representation}" FIBER_FMT_FLOAT_REP_ENG)
 
 set(fiber_cmake_flags
     FIBER_COMPILE_TESTS
+    FIBER_COMPILE_BENCHMARKS
     FIBER_USE_SYS_STUBS
 )
 
 set(fiber_main_flags
     FIBER_MULTI_CORE
+    FIBER_CONTINUATION_SIZE
     FIBER_DISABLE_EXCEPTIONS
     FIBER_DISABLE_ASSERTIONS
     FIBER_ASSERTION_LEVEL_CRITICAL
@@ -185,6 +207,7 @@ set(fiber_main_flags
     FIBER_DISABLE_ANSI_CODES
     FIBER_DISABLE_UTF8_CODES
     FIBER_FMT_MINIMAL
+    FIBER_FMT_EXACT_DIGITS
 )
 
 set(fiber_fmt_flags
@@ -195,6 +218,7 @@ set(fiber_fmt_flags
     FIBER_FMT_DOT_AS_COMMA
     FIBER_FMT_PAD_SIGN
     FIBER_FMT_FLOAT_DECIMALS
+    FIBER_FMT_FLOAT_SHORTEST
     FIBER_FMT_THOUSANDS
     FIBER_FMT_FORCE_COMMA
     FIBER_FMT_FORCE_DECIMALS
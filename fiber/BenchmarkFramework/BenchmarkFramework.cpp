@@ -0,0 +1,27 @@
+#include "BenchmarkFramework.hpp"
+
+// std
+#include <chrono>
+
+// fiber
+#include <fiber/OStream/ansi.hpp>
+
+namespace fiber{
+
+    FIBER_WEAK uint64_t benchmark_timestamp_ns(){
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+
+    void print_benchmark_result(const BenchmarkResult& result){
+        // fixed point with two decimals
+        const uint64_t centi_ns_per_op = (result.iterations == 0) ? 0 : (result.nanoseconds * 100) / result.iterations;
+        const uint64_t decimals = centi_ns_per_op % 100;
+
+        fiber::cout << "    [" << fiber::ansi::bright_blue << fiber::ansi::bold << "BENCH" << fiber::ansi::reset << "]: " 
+                    << result.name << ": " 
+                    << (centi_ns_per_op / 100) << '.' << ((decimals < 10) ? "0" : "") << decimals << " ns/op" 
+                    << " (" << result.iterations << " iterations)" << fiber::endl;
+    }
+
+}// namespace fiber
@@ -0,0 +1,68 @@
+#pragma once
+
+// std
+#include <cstdint>
+
+// fiber
+#include <fiber/Core/definitions.hpp>
+#include <fiber/OStream/OStream.hpp>
+
+namespace fiber{
+
+    /**
+     * @brief Weak, user overloadable function that returns a monotonic time stamp in nanoseconds.
+     * 
+     * The default implementation uses `std::chrono::steady_clock` of the host. 
+     * On a bare-metal target one may return a scaled cycle counter instead.
+     */
+    FIBER_WEAK uint64_t benchmark_timestamp_ns();
+
+    /**
+     * @brief Prevents the compiler from optimising away the computation of `value`
+     */
+    template<class T>
+    inline void do_not_optimize(T& value){
+        #if defined(__GNUC__) || defined(__clang__)
+            asm volatile("" : "+m"(value) : : "memory");
+        #else
+            volatile T* ptr = &value;
+            (void)*ptr;
+        #endif
+    }
+
+    struct BenchmarkResult{
+        const char* name = "";
+        uint64_t iterations = 0;
+        uint64_t nanoseconds = 0;
+    };
+
+    /// @brief prints the result as: `[BENCH]: <name>: <ns/op> ns/op (<iterations> iterations)`
+    void print_benchmark_result(const BenchmarkResult& result);
+
+    /**
+     * @brief Measures the average time of `function` over `iterations` calls and prints the result
+     * 
+     * Example:
+     * ```cpp
+     * fiber::benchmark("add", 1'000'000, [&](){
+     *      sum += value;
+     *      fiber::do_not_optimize(sum);
+     * });
+     * ```
+     */
+    template<class Function>
+    BenchmarkResult benchmark(const char* name, uint64_t iterations, Function&& function){
+        const uint64_t start = benchmark_timestamp_ns();
+        for(uint64_t i = 0; i < iterations; ++i){
+            function();
+        }
+        const uint64_t stop = benchmark_timestamp_ns();
+        const BenchmarkResult result{name, iterations, stop - start};
+        print_benchmark_result(result);
+        return result;
+    }
+
+}// namespace fiber
+
+#define BENCHMARK_GROUP \
+    fiber::cout << __func__ << ':' << fiber::newl;
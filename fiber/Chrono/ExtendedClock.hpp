@@ -0,0 +1,158 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+// fiber
+#include "Duration.hpp"
+#include "TimePoint.hpp"
+
+namespace fiber{
+
+    /**
+     * \brief Extends a 16 or 32 bit hardware counter to a monotonic 64 bit tick count
+     *
+     * `TimePoint` wraps around with its representation `FIBER_CLOCK_UINT<x>`. If the hardware timer only has 16 bits,
+     * long delays and deadlines alias after one period of the counter. This class counts the periods in software:
+     * compile with `FIBER_CLOCK_UINT64` and pass `ExtendedClock::now()` to the scheduler to get a 64 bit time base from a small timer.
+     *
+     * The clock remembers the 64 bit tick count at the last `update()` together with the hardware count at that moment.
+     * A read adds the ticks of the hardware counter since then. The counter only tells the ticks modulo one period,
+     * so two consecutive updates, and an update and a read, have to be strictly less than one period apart.
+     * Otherwise a whole period is lost and the time jumps back. Call `update()` at least twice per period, so that
+     * interrupt latency and jitter of up to half a period are tolerated:
+     * - from the overflow and a half-period compare interrupt of the timer, or
+     * - from any other interrupt that fires at least twice per period, or
+     * - lazily from the only context that reads the time, for example the `now` function of a single-core scheduler.
+     *   Then the scheduler has to wake up at least twice per counter period.
+     *
+     * One update per period, only from the overflow interrupt, is not enough: if that interrupt is delayed,
+     * the next one can be more than one period after the previous update.
+     *
+     * Reading is lock-free: the 64 bit base is protected by a sequence lock, so readers never block the interrupt
+     * and retry only if an update happened during the read. `update()` must only be called from one context at a time.
+     *
+     * Example:
+     * ```C++
+     * fiber::ExtendedClock<uint16_t> clock([]{return uint16_t(TIM3->CNT);});
+     *
+     * // update event at 0 and compare event at half the period (TIM3->CCR1 = 0x8000)
+     * extern "C" void TIM3_IRQHandler(){
+     *     TIM3->SR = 0;
+     *     clock.update();
+     * }
+     *
+     * fiber::TimePoint get_time(){return clock.now();}
+     * fiber::Scheduler<8> scheduler(get_time);
+     * ```
+     *
+     * \tparam UInt The unsigned integer type of the hardware counter
+     * \tparam MAX_COUNT The last value of the counter before it restarts at zero
+     */
+    template<std::unsigned_integral UInt, UInt MAX_COUNT = std::numeric_limits<UInt>::max()>
+    class ExtendedClock{
+        static_assert(sizeof(UInt) <= sizeof(uint32_t), "The hardware counter may have at most 32 bits");
+
+    public:
+        using counter_type = UInt;
+
+        /// the number of ticks in one period of the hardware counter
+        static constexpr uint64_t period = static_cast<uint64_t>(MAX_COUNT) + 1;
+
+    private:
+        UInt (*_read_counter)();
+
+        // 64 bit tick count at the last update, split so that every part is lock-free on 32 bit processors
+        std::atomic<uint32_t> _sequence = 0; // odd while an update is in progress
+        std::atomic<uint32_t> _ticks_low = 0;
+        std::atomic<uint32_t> _ticks_high = 0;
+        std::atomic<UInt> _count = 0; // hardware count at the last update
+
+    public:
+
+        /**
+         * \param read_counter function that returns the current value of the hardware counter
+         */
+        explicit ExtendedClock(UInt (*read_counter)())
+            : _read_counter(read_counter)
+            , _count(read_counter()){}
+
+        ExtendedClock(const ExtendedClock&) = delete;
+        ExtendedClock& operator=(const ExtendedClock&) = delete;
+
+        /**
+         * \brief Advances the 64 bit base to the current hardware count and returns the tick count
+         *
+         * Call it at least twice per period of the hardware counter, so that consecutive updates are always less
+         * than one period apart, and only from one context at a time, for example from the overflow and a
+         * half-period compare interrupt of the timer.
+         */
+        uint64_t update(){
+            const uint32_t sequence = this->_sequence.load(std::memory_order_relaxed);
+            const UInt count = this->_read_counter();
+            const uint64_t ticks = this->load_ticks() + ticks_between(this->_count.load(std::memory_order_relaxed), count);
+
+            // odd sequence: readers retry
+            this->_sequence.store(sequence + 1, std::memory_order_relaxed);
+            fence();
+            this->_ticks_low.store(static_cast<uint32_t>(ticks), std::memory_order_relaxed);
+            this->_ticks_high.store(static_cast<uint32_t>(ticks >> 32), std::memory_order_relaxed);
+            this->_count.store(count, std::memory_order_relaxed);
+            fence();
+            this->_sequence.store(sequence + 2, std::memory_order_relaxed);
+
+            return ticks;
+        }
+
+        /**
+         * \brief Returns the monotonic 64 bit tick count without modifying the clock
+         *
+         * May be called from any context, also while an interrupt updates the clock.
+         * Is monotonic as long as the clock is updated less than one period apart, see `update()`.
+         */
+        uint64_t ticks() const {
+            while(true){
+                const uint32_t sequence = this->_sequence.load(std::memory_order_relaxed);
+                fence();
+                const uint64_t base = this->load_ticks();
+                const UInt base_count = this->_count.load(std::memory_order_relaxed);
+                const UInt count = this->_read_counter();
+                fence();
+                if((sequence & 1) == 0 && sequence == this->_sequence.load(std::memory_order_relaxed)){
+                    return base + ticks_between(base_count, count);
+                }
+            }
+        }
+
+        /// @brief returns the current time, see `ticks()`
+        TimePoint now() const {
+            return TimePoint(Duration(static_cast<DurationRepresentation>(this->ticks())));
+        }
+
+        /// @brief returns the number of ticks that the counter advanced from `from` to `to`, less than one period
+        static constexpr uint64_t ticks_between(UInt from, UInt to){
+            return (to >= from)
+                ? static_cast<uint64_t>(to - from)
+                : static_cast<uint64_t>(to) + period - static_cast<uint64_t>(from);
+        }
+
+    private:
+        uint64_t load_ticks() const {
+            return (static_cast<uint64_t>(this->_ticks_high.load(std::memory_order_relaxed)) << 32)
+                | this->_ticks_low.load(std::memory_order_relaxed);
+        }
+
+        static void fence(){
+            #ifdef FIBER_MULTI_CORE
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            #else
+                // the writer is an interrupt on the same core, only the compiler may not reorder
+                std::atomic_signal_fence(std::memory_order_seq_cst);
+            #endif
+        }
+    };
+
+} // namespace fiber
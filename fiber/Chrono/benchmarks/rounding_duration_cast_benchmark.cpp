@@ -0,0 +1,63 @@
+#include "rounding_duration_cast_benchmark.hpp"
+
+// std
+#include <chrono>
+#include <cstdint>
+
+// fiber
+#include <fiber/Chrono/Duration.hpp>
+#include <fiber/Chrono/rounding_duration_cast.hpp>
+#include <fiber/BenchmarkFramework/BenchmarkFramework.hpp>
+
+namespace fiber
+{
+    static constexpr uint64_t iterations = 1'000'000;
+
+    /// the formula before the conversion engine, as a baseline
+    template<class ToDuration, class Rep, class Period>
+    static ToDuration plain_cast(const std::chrono::duration<Rep, Period>& d){
+        using conversion = typename std::ratio_divide<Period, typename ToDuration::period>::type;
+        return ToDuration(static_cast<typename ToDuration::rep>((d.count() * conversion::num + (conversion::den - 1)) / conversion::den));
+    }
+
+    void rounding_duration_cast_benchmark(){
+        BENCHMARK_GROUP;
+
+        uint64_t count = 123456789;
+
+        fiber::benchmark("plain: nanoseconds to microseconds", iterations, [&count](){
+            auto result = plain_cast<std::chrono::microseconds>(std::chrono::nanoseconds(static_cast<int64_t>(count)));
+            count += 7;
+            fiber::do_not_optimize(result);
+        });
+        fiber::benchmark("fiber::rounding_duration_cast: nanoseconds to microseconds", iterations, [&count](){
+            auto result = fiber::rounding_duration_cast<std::chrono::microseconds>(std::chrono::nanoseconds(static_cast<int64_t>(count)));
+            count += 7;
+            fiber::do_not_optimize(result);
+        });
+
+        fiber::benchmark("plain: microseconds to fiber::Duration", iterations, [&count](){
+            auto result = plain_cast<fiber::Duration::base>(std::chrono::microseconds(static_cast<int64_t>(count)));
+            count += 7;
+            fiber::do_not_optimize(result);
+        });
+        fiber::benchmark("fiber::rounding_duration_cast: microseconds to fiber::Duration", iterations, [&count](){
+            auto result = fiber::rounding_duration_cast<fiber::Duration::base>(std::chrono::microseconds(static_cast<int64_t>(count)));
+            count += 7;
+            fiber::do_not_optimize(result);
+        });
+
+        fiber::benchmark("plain: 32 bit ticks to milliseconds", iterations, [&count](){
+            const std::chrono::duration<uint32_t, fiber::Duration::period> ticks(static_cast<uint32_t>(count));
+            auto result = plain_cast<std::chrono::milliseconds>(ticks);
+            count += 7;
+            fiber::do_not_optimize(result);
+        });
+        fiber::benchmark("fiber::rounding_duration_cast: 32 bit ticks to milliseconds", iterations, [&count](){
+            const std::chrono::duration<uint32_t, fiber::Duration::period> ticks(static_cast<uint32_t>(count));
+            auto result = fiber::rounding_duration_cast<std::chrono::milliseconds>(ticks);
+            count += 7;
+            fiber::do_not_optimize(result);
+        });
+    }
+} // namespace fiber
@@ -0,0 +1,9 @@
+#pragma once
+
+namespace fiber
+{
+    /**
+     * @brief Benchmarks `fiber::rounding_duration_cast` against the plain formula `(count * num + rounding) / den`
+     */
+    void rounding_duration_cast_benchmark();
+} // namespace fiber
@@ -1,5 +1,16 @@
 #pragma once
 
+// std
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+// fiber
+#include <fiber/Core/concepts.hpp>
+#include <fiber/math/const_divide.hpp>
+
 namespace fiber
 {
 
@@ -9,24 +20,124 @@ namespace fiber
         Nearest,
     };
 
+    namespace detail{
+
+        /// `fiber::Tick` like representations, that wrap around after `max_tick`
+        template<class Rep>
+        concept CTickRep = requires(Rep r){
+            Rep::max_tick;
+            r.value;
+        };
+
+        /// the largest absolute value of a representation
+        template<class Rep>
+        constexpr uint64_t max_magnitude(){
+            if constexpr (CTickRep<Rep>){
+                return static_cast<uint64_t>(Rep::max_tick);
+            }else if constexpr (std::is_signed_v<Rep>){
+                return static_cast<uint64_t>(std::numeric_limits<Rep>::max()) + 1;
+            }else{
+                return static_cast<uint64_t>(std::numeric_limits<Rep>::max());
+            }
+        }
+
+        /**
+         * \brief computes `(magnitude * Num + rounding) / Den` exactly
+         *
+         * The arithmetic is chosen at compile time from the largest possible magnitude:
+         * 32 bit if everything fits (compilers divide by constants with a multiplication),
+         * else 64 bit with a `ConstDivider`, else a 128 bit product. Saturates to `UINT64_MAX`.
+         */
+        template<uint64_t Num, uint64_t Den, RoundingMethod rounding_type, uint64_t max_in>
+        constexpr uint64_t scale_magnitude(uint64_t magnitude){
+            constexpr uint64_t rounding = (rounding_type == RoundingMethod::Up) ? Den - 1
+                                        : (rounding_type == RoundingMethod::Nearest) ? Den / 2
+                                        : 0;
+
+            if constexpr (Num == 1 && Den == 1){
+                return magnitude;
+            }else if constexpr (Num <= UINT32_MAX && Den <= UINT32_MAX && max_in <= (UINT32_MAX - rounding) / Num){
+                return (static_cast<uint32_t>(magnitude) * static_cast<uint32_t>(Num) + static_cast<uint32_t>(rounding)) / static_cast<uint32_t>(Den);
+            }else if constexpr (max_in <= (UINT64_MAX - rounding) / Num){
+                return ConstDivider<Den>::divide(magnitude * Num + rounding);
+            }else{
+                WideProduct product = mul_wide(magnitude, Num);
+                product.low += rounding;
+                if(product.low < rounding) product.high += 1;
+                if(product.high == 0) return ConstDivider<Den>::divide(product.low);
+                return div_wide_saturate(product, Den);
+            }
+        }
+
+        /// converts the scaled magnitude to the representation, saturates builtin integers and wraps ticks around
+        template<class ToRep>
+        constexpr ToRep make_rep(uint64_t magnitude, bool negative){
+            if constexpr (CTickRep<ToRep>){
+                const ToRep result(magnitude);
+                return negative ? -result : result;
+            }else if constexpr (std::is_integral_v<ToRep>){
+                if(negative){
+                    if constexpr (std::is_signed_v<ToRep>){
+                        return (magnitude > max_magnitude<ToRep>()) ? std::numeric_limits<ToRep>::min() : static_cast<ToRep>(0 - magnitude);
+                    }else{
+                        return ToRep(0);
+                    }
+                }
+                return (magnitude > static_cast<uint64_t>(std::numeric_limits<ToRep>::max())) ? std::numeric_limits<ToRep>::max() : static_cast<ToRep>(magnitude);
+            }else{
+                return negative ? -static_cast<ToRep>(magnitude) : static_cast<ToRep>(magnitude);
+            }
+        }
+
+    } // namespace detail
+
     /**
      * \brief duration cast that round to the nearest tick of the new `ToDuration`
+     *
+     * For integer and tick representations the conversion is exact and never overflows:
+     * - the product `count * num` is computed with 32, 64 or 128 bits, depending on the possible range of `Rep`,
+     *   which is known at compile time.
+     * - the division by `den` is a multiplication with a reciprocal that is computed at compile time.
+     * - results that do not fit into `ToDuration::rep` saturate to its limits, `fiber::Tick`s wrap around.
+     *
+     * Negative values are rounded by their absolute value: `Up` rounds away from zero, `Down` towards zero
+     * and `Nearest` rounds halfway cases away from zero.
      */
     template<class ToDuration, RoundingMethod rounding_type = RoundingMethod::Up, class Rep = unsigned int, fiber::CRatio Period = std::ratio<1>>
     constexpr ToDuration rounding_duration_cast( const std::chrono::duration<Rep, Period>& d ){
         using conversion = typename std::ratio_divide<Period, typename ToDuration::period>::type;
-        if constexpr (rounding_type == RoundingMethod::Nearest){
+        using ToRep = typename ToDuration::rep;
+        if constexpr (detail::CTickRep<Rep> || (std::is_integral_v<Rep> && !std::is_same_v<Rep, bool>)){
+            constexpr uint64_t num = static_cast<uint64_t>(conversion::num);
+            constexpr uint64_t den = static_cast<uint64_t>(conversion::den);
+            constexpr uint64_t max_in = detail::max_magnitude<Rep>();
+
+            uint64_t magnitude;
+            bool negative = false;
+            if constexpr (detail::CTickRep<Rep>){
+                magnitude = static_cast<uint64_t>(d.count().value);
+            }else if constexpr (std::is_signed_v<Rep>){
+                negative = d.count() < 0;
+                magnitude = negative ? uint64_t(0) - static_cast<uint64_t>(d.count()) : static_cast<uint64_t>(d.count());
+            }else{
+                magnitude = static_cast<uint64_t>(d.count());
+            }
+
+            const uint64_t new_count = detail::scale_magnitude<num, den, rounding_type, max_in>(magnitude);
+            ToDuration result(detail::make_rep<ToRep>(new_count, negative));
+            return result;
+        }else if constexpr (rounding_type == RoundingMethod::Nearest){
             if constexpr (std::is_unsigned_v<Rep>){
                 const auto mul = d.count() * conversion::num;
                 const auto round = mul + conversion::den/2;
                 const auto new_count = round / conversion::den;
-                ToDuration result(static_cast<ToDuration::rep>(new_count));
+                ToDuration result(static_cast<ToRep>(new_count));
                 return result;
             }else{
                 const auto mul = d.count() * conversion::num;
                 const auto round =  ((d.count() > 0) ? (mul + conversion::den/2) : (mul - conversion::den/2));
                 const auto new_count = round / conversion::den;
-                ToDuration result(static_cast<ToDuration::rep>(new_count));
+                ToDuration result(static_cast<ToRep>(new_count));
                 return result;
             }
         }else if constexpr (rounding_type == RoundingMethod::Up){
@@ -34,24 +145,23 @@ namespace fiber
                 const auto mul = d.count() * conversion::num;
                 const auto round =  mul + (conversion::den-1);
                 const auto new_count = round / conversion::den;
-                ToDuration result(static_cast<ToDuration::rep>(new_count));
+                ToDuration result(static_cast<ToRep>(new_count));
                 return result;
             }else{
                 const auto mul = d.count() * conversion::num;
                 const auto round =  ((d.count() > 0) ? (mul + (conversion::den-1)) : (mul - (conversion::den-1)));
                 const auto new_count = round / conversion::den;
-                ToDuration result(static_cast<ToDuration::rep>(new_count));
+                ToDuration result(static_cast<ToRep>(new_count));
                 return result;
             }
         }else /*if constexpr (rounding_type == RoundingMethod::Down)*/{
             const auto mul = d.count() * conversion::num;
             const auto round = mul;
             const auto new_count = round / conversion::den;
-            ToDuration result(static_cast<ToDuration::rep>(new_count));
+            ToDuration result(static_cast<ToRep>(new_count));
             return result;
         }
-        
+
     }
-    
-} // namespace fiber
 
+} // namespace fiber
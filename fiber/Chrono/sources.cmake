@@ -3,6 +3,7 @@ target_sources(fiber
     ${CMAKE_CURRENT_LIST_DIR}/Tick.hpp
     ${CMAKE_CURRENT_LIST_DIR}/Duration.hpp
     ${CMAKE_CURRENT_LIST_DIR}/TimePoint.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/ExtendedClock.hpp
     ${CMAKE_CURRENT_LIST_DIR}/rounding_duration_cast.hpp
     PRIVATE
         
@@ -13,4 +14,10 @@ if(FIBER_COMPILE_TESTS)
 
     include(${CMAKE_CURRENT_LIST_DIR}/tests/sources.cmake)
 
+endif()
+
+if(FIBER_COMPILE_BENCHMARKS)
+
+    include(${CMAKE_CURRENT_LIST_DIR}/benchmarks/sources.cmake)
+
 endif()
\ No newline at end of file
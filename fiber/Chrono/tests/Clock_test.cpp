@@ -8,6 +8,7 @@
 #include "../Tick.hpp"
 #include "../Duration.hpp"
 #include "../TimePoint.hpp"
+#include "../ExtendedClock.hpp"
 #include <fiber/TestFramework/TestFramework.hpp>
 
 namespace fiber{
@@ -220,6 +221,81 @@ namespace fiber{
         TEST_END;
     }
 
+    static uint16_t g_counter16 = 0;
+    static uint16_t read_counter16(){return g_counter16;}
+
+    static fiber::TestResult ExtendedClock_test_wrap_around(){
+        TEST_START;
+
+        g_counter16 = 60000;
+        ExtendedClock<uint16_t> clock(read_counter16);
+        TEST_EQUAL(clock.ticks(), 0);
+
+        // reads add the ticks since the last update, also across the overflow of the counter
+        g_counter16 = 65000;
+        TEST_EQUAL(clock.ticks(), 5000);
+        g_counter16 = 100;
+        TEST_EQUAL(clock.ticks(), 5636);
+        TEST_EQUAL(clock.update(), 5636);
+        TEST_EQUAL(clock.ticks(), 5636);
+
+        // beyond the range of 32 bits, one update per period
+        uint64_t expected = 5636;
+        for(int i = 0; i < 120000; ++i){
+            g_counter16 = static_cast<uint16_t>(g_counter16 + 40000);
+            expected += 40000;
+            TEST_EQUAL(clock.update(), expected);
+        }
+        TEST_GREATER(clock.ticks(), uint64_t(UINT32_MAX));
+        TEST_EQUAL(clock.now().time_since_epoch().count().value, static_cast<DurationRepresentation>(expected));
+
+        TEST_END;
+    }
+
+    static fiber::TestResult ExtendedClock_test_custom_period(){
+        TEST_START;
+
+        // counter that restarts after 999
+        g_counter16 = 900;
+        ExtendedClock<uint16_t, 999> clock(read_counter16);
+        TEST_EQUAL(clock.period, 1000);
+
+        g_counter16 = 50;
+        TEST_EQUAL(clock.update(), 150);
+        g_counter16 = 49;
+        TEST_EQUAL(clock.update(), 150 + 999);
+        TEST_EQUAL((ExtendedClock<uint16_t, 999>::ticks_between(0, 999)), 999);
+        TEST_EQUAL((ExtendedClock<uint16_t, 999>::ticks_between(999, 0)), 1);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult ExtendedClock_test_jitter(){
+        TEST_START;
+
+        // overflow interrupts that are more than one period apart, with a half-period compare interrupt in between
+        g_counter16 = 0;
+        ExtendedClock<uint16_t> clock(read_counter16);
+        uint64_t expected = 0;
+        uint64_t last = 0;
+        for(int i = 0; i < 100; ++i){
+            // delayed compare interrupt at 0.5 + 0.4 periods
+            g_counter16 = static_cast<uint16_t>(g_counter16 + 58982);
+            expected += 58982;
+            TEST_EQUAL(clock.update(), expected);
+
+            // overflow interrupt 1.3 periods after the previous one
+            g_counter16 = static_cast<uint16_t>(g_counter16 + 26214);
+            expected += 26214;
+            TEST_GREATER_EQUAL(clock.ticks(), last);
+            last = clock.ticks();
+            TEST_EQUAL(clock.update(), expected);
+        }
+        TEST_EQUAL(clock.ticks(), expected);
+
+        TEST_END;
+    }
+
     fiber::TestResult ClockTick_test(){
         TEST_GROUP;
         
@@ -231,7 +307,10 @@ namespace fiber{
             | ClockTick_test_comparison
             | Duration_test_construction
             | Duration_test_std_integration
-            | Clock_template_instantiation_and_time_point;
+            | Clock_template_instantiation_and_time_point
+            | ExtendedClock_test_wrap_around
+            | ExtendedClock_test_custom_period
+            | ExtendedClock_test_jitter;
 
     }
 
@@ -0,0 +1,191 @@
+#include "rounding_duration_cast_test.hpp"
+
+// std
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+
+// fiber
+#include "../Duration.hpp"
+#include "../rounding_duration_cast.hpp"
+#include <fiber/math/const_divide.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber{
+
+    #ifdef __SIZEOF_INT128__
+
+    using int128 = __int128;
+
+    /// the original formula of `rounding_duration_cast` with exact 128 bit arithmetic, saturated to `ToRep`
+    template<class ToRep, RoundingMethod rounding_type>
+    static ToRep reference_cast(int128 count, int128 num, int128 den){
+        const int128 rounding = (rounding_type == RoundingMethod::Up) ? den - 1
+                              : (rounding_type == RoundingMethod::Nearest) ? den / 2
+                              : 0;
+        const int128 mul = count * num;
+        const int128 result = (count > 0) ? (mul + rounding) / den : (mul - rounding) / den;
+        if(result > static_cast<int128>(std::numeric_limits<ToRep>::max())) return std::numeric_limits<ToRep>::max();
+        if(result < static_cast<int128>(std::numeric_limits<ToRep>::min())) return std::numeric_limits<ToRep>::min();
+        return static_cast<ToRep>(result);
+    }
+
+    /// returns the number of values for which the cast differs from the reference
+    template<class ToRep, class Rep, intmax_t Num, intmax_t Den, RoundingMethod rounding_type>
+    static int count_errors(Rep count){
+        using From = std::chrono::duration<Rep, std::ratio<Num, Den>>;
+        using To = std::chrono::duration<ToRep>;
+        using conversion = std::ratio<Num, Den>;
+        const ToRep result = fiber::rounding_duration_cast<To, rounding_type>(From(count)).count();
+        const ToRep expected = reference_cast<ToRep, rounding_type>(count, conversion::num, conversion::den);
+        return (result == expected) ? 0 : 1;
+    }
+
+    template<class ToRep, class Rep, intmax_t Num, intmax_t Den>
+    static int count_errors_all_roundings(Rep count){
+        return count_errors<ToRep, Rep, Num, Den, RoundingMethod::Up>(count)
+             + count_errors<ToRep, Rep, Num, Den, RoundingMethod::Down>(count)
+             + count_errors<ToRep, Rep, Num, Den, RoundingMethod::Nearest>(count);
+    }
+
+    template<class ToRep, class Rep>
+    static int count_errors_all_ratios(Rep count){
+        return count_errors_all_roundings<ToRep, Rep, 1, 1>(count)
+             + count_errors_all_roundings<ToRep, Rep, 1, 20>(count)         // 20kHz ticks to seconds
+             + count_errors_all_roundings<ToRep, Rep, 20, 1>(count)
+             + count_errors_all_roundings<ToRep, Rep, 50, 1>(count)
+             + count_errors_all_roundings<ToRep, Rep, 3, 7>(count)
+             + count_errors_all_roundings<ToRep, Rep, 1000, 3>(count)
+             + count_errors_all_roundings<ToRep, Rep, 1, 50000>(count)
+             + count_errors_all_roundings<ToRep, Rep, 1, 1024>(count)
+             + count_errors_all_roundings<ToRep, Rep, 1, 10000000019>(count) // divisor larger than 32 bit
+             + count_errors_all_roundings<ToRep, Rep, 1000000000, 1>(count)  // seconds to nanoseconds
+             + count_errors_all_roundings<ToRep, Rep, 1000000000000000000, 7>(count);
+    }
+
+    static uint64_t xorshift(uint64_t& state){
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    static fiber::TestResult rounding_duration_cast_test_exhaustive_16bit(){
+        TEST_START;
+
+        int errors = 0;
+        for(uint32_t i = 0; i <= UINT16_MAX; ++i){
+            errors += count_errors_all_ratios<int64_t>(static_cast<uint16_t>(i));
+            errors += count_errors_all_ratios<int64_t>(static_cast<int16_t>(i));
+            errors += count_errors_all_ratios<int16_t>(static_cast<int16_t>(i));
+            errors += count_errors_all_ratios<uint32_t>(static_cast<uint16_t>(i));
+        }
+        TEST_EQUAL(errors, 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult rounding_duration_cast_test_64bit(){
+        TEST_START;
+
+        int errors = 0;
+        const int64_t edges[] = {
+            0, 1, -1, 2, -2, INT32_MAX, INT32_MIN, int64_t(UINT32_MAX), int64_t(UINT32_MAX) + 1,
+            INT64_MAX, INT64_MAX - 1, INT64_MIN, INT64_MIN + 1, INT64_MAX / 20, INT64_MIN / 50
+        };
+        for(const int64_t count : edges){
+            errors += count_errors_all_ratios<int64_t>(count);
+            errors += count_errors_all_ratios<int32_t>(count);
+            errors += count_errors_all_ratios<uint64_t>(static_cast<uint64_t>(count));
+        }
+
+        uint64_t state = 0x9E3779B97F4A7C15;
+        for(int i = 0; i < 20000; ++i){
+            const uint64_t random = xorshift(state);
+            // all magnitudes, not only huge numbers
+            const int64_t count = static_cast<int64_t>(random) >> (random % 64);
+            errors += count_errors_all_ratios<int64_t>(count);
+            errors += count_errors_all_ratios<uint64_t>(static_cast<uint64_t>(count));
+            errors += count_errors_all_ratios<int64_t>(static_cast<uint32_t>(count));
+        }
+        TEST_EQUAL(errors, 0);
+
+        TEST_END;
+    }
+
+    #endif
+
+    static fiber::TestResult rounding_duration_cast_test_tick(){
+        TEST_START;
+
+        using Ticks = std::chrono::duration<Tick<uint32_t>, std::ratio<1, 20000>>;
+
+        // the product does not wrap around with the tick
+        const Ticks ticks(Tick<uint32_t>(UINT32_MAX));
+        TEST_EQUAL(fiber::rounding_duration_cast<std::chrono::microseconds>(ticks).count(), int64_t(UINT32_MAX) * 50);
+        TEST_EQUAL((fiber::rounding_duration_cast<std::chrono::milliseconds, RoundingMethod::Down>(ticks).count()), int64_t(UINT32_MAX) / 20);
+        TEST_EQUAL((fiber::rounding_duration_cast<std::chrono::milliseconds, RoundingMethod::Up>(ticks).count()), int64_t(UINT32_MAX) / 20 + 1);
+
+        // the result wraps around if it is a tick
+        using SlowTicks = std::chrono::duration<Tick<uint16_t>, std::ratio<1, 10>>;
+        TEST_EQUAL(fiber::rounding_duration_cast<SlowTicks>(std::chrono::hours(2)).count().value, uint16_t(72000 - 65536));
+        TEST_EQUAL(fiber::rounding_duration_cast<SlowTicks>(std::chrono::milliseconds(-250)).count().value, uint16_t(65536 - 3));
+
+        // also in constant expressions
+        static_assert(fiber::rounding_duration_cast<std::chrono::milliseconds>(std::chrono::microseconds(1500)).count() == 2);
+        static_assert(fiber::rounding_duration_cast<std::chrono::milliseconds, RoundingMethod::Nearest>(std::chrono::microseconds(-1500)).count() == -2);
+        static_assert(fiber::rounding_duration_cast<std::chrono::nanoseconds>(std::chrono::hours(INT64_MAX / 3600)).count() == INT64_MAX);
+
+        TEST_END;
+    }
+
+    template<uint64_t D>
+    static int count_divider_errors(uint64_t n){
+        return (ConstDivider<D>::divide(n) == n / D) ? 0 : 1;
+    }
+
+    static fiber::TestResult ConstDivider_test(){
+        TEST_START;
+
+        int errors = 0;
+        uint64_t state = 0x2545F4914F6CDD1D;
+        for(int i = 0; i < 100000; ++i){
+            const uint64_t random = xorshift(state);
+            const uint64_t n = (i < 64) ? (UINT64_MAX >> i) : random >> (random % 64);
+            errors += count_divider_errors<1>(n);
+            errors += count_divider_errors<3>(n);
+            errors += count_divider_errors<7>(n);
+            errors += count_divider_errors<20>(n);
+            errors += count_divider_errors<1000>(n);
+            errors += count_divider_errors<1024>(n);
+            errors += count_divider_errors<1000000007>(n);
+            errors += count_divider_errors<10000000019>(n);
+            errors += count_divider_errors<(uint64_t(1) << 63) + 1>(n);
+            errors += count_divider_errors<UINT64_MAX>(n);
+        }
+        TEST_EQUAL(errors, 0);
+
+        const WideProduct product = mul_wide(UINT64_MAX, UINT64_MAX);
+        TEST_EQUAL(product.high, UINT64_MAX - 1);
+        TEST_EQUAL(product.low, 1);
+        TEST_EQUAL(div_wide_saturate(product, UINT64_MAX), UINT64_MAX);
+        TEST_EQUAL(div_wide_saturate(WideProduct{1, 0}, 3), 0x5555555555555555);
+        TEST_EQUAL(div_wide_saturate(WideProduct{3, 0}, 3), UINT64_MAX);
+
+        TEST_END;
+    }
+
+    fiber::TestResult rounding_duration_cast_test(){
+        TEST_GROUP;
+
+        return fiber::TestResult()
+        #ifdef __SIZEOF_INT128__
+            | rounding_duration_cast_test_exhaustive_16bit
+            | rounding_duration_cast_test_64bit
+        #endif
+            | rounding_duration_cast_test_tick
+            | ConstDivider_test;
+    }
+
+} // namespace fiber
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber{
+
+    /**
+     * @brief Tests `fiber::rounding_duration_cast` and `fiber::ConstDivider` against exact 128 bit arithmetic
+     */
+    fiber::TestResult rounding_duration_cast_test();
+
+} // namespace fiber
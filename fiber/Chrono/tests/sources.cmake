@@ -1,7 +1,9 @@
 target_sources(fiber
     PUBLIC
         ${CMAKE_CURRENT_LIST_DIR}/Clock_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/rounding_duration_cast_test.hpp
         
     PRIVATE
         ${CMAKE_CURRENT_LIST_DIR}/Clock_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/rounding_duration_cast_test.cpp
 )
@@ -9,19 +9,120 @@
 #include <ranges>
 #include <functional>
 #include <concepts>
+#include <cstring>
+#include <memory>
 
 // fiber
 #include <fiber/Core/functional.hpp>
+#include <fiber/Core/type_traits.hpp>
 #include <fiber/Exceptions/Exceptions.hpp>
 #include <fiber/OStream/OStream.hpp>
 
 
-// TODO: use the memcpy - to potentially use dma copy
 // TODO: Make a ArrayListSlice that stores pointers and feels like woring with references to the elements of another list.
 // TODO: Make a reference type (ArrayListRef) that references the whole list with a pointer to the data, a pointer to its size, an int of the capacity
 // TODO: also make a const reference version of both slice and ref
 namespace fiber
 {
+    namespace detail{
+
+        /**
+         * @brief moves `count` elements from `source` to the uninitialised memory at `dest`, the ranges may overlap
+         *
+         * Afterwards `[source, source + count)` is uninitialised memory, except where it overlaps with `dest`.
+         * Trivially relocatable types are moved with a single `memmove`, others one by one with a
+         * move construction and a destruction, in the order that does not overwrite elements before they are moved.
+         */
+        template<class T>
+        void relocate(T* dest, T* source, std::size_t count){
+            if(count == 0 || dest == source) return;
+            if constexpr (fiber::is_trivially_relocatable_v<T>){
+                std::memmove(static_cast<void*>(dest), static_cast<const void*>(source), count * sizeof(T));
+            }else if(dest < source){
+                for(std::size_t i = 0; i < count; ++i){
+                    std::construct_at(dest + i, std::move(source[i]));
+                    std::destroy_at(source + i);
+                }
+            }else{
+                for(std::size_t i = count; i > 0; --i){
+                    std::construct_at(dest + i - 1, std::move(source[i - 1]));
+                    std::destroy_at(source + i - 1);
+                }
+            }
+        }
+
+        /**
+         * @brief copy constructs `[first, last)` into the uninitialised memory at `dest`
+         * @returns the end of the constructed elements
+         *
+         * Contiguous ranges of the same trivially copyable type are copied with a single `memcpy`.
+         */
+        template<class T, std::forward_iterator Itr>
+        T* uninitialized_copy(Itr first, Itr last, T* dest){
+            if constexpr (std::contiguous_iterator<Itr> && std::is_same_v<std::iter_value_t<Itr>, T> && std::is_trivially_copyable_v<T>){
+                const std::size_t count = static_cast<std::size_t>(last - first);
+                if(count != 0) std::memcpy(static_cast<void*>(dest), static_cast<const void*>(std::to_address(first)), count * sizeof(T));
+                return dest + count;
+            }else{
+                for(; first != last; ++first, (void)++dest) std::construct_at(dest, *first);
+                return dest;
+            }
+        }
+
+        /// @brief moves one element from `source` to the uninitialised memory at `dest`, see `relocate()`
+        template<class T>
+        void relocate_one(T* dest, T* source){
+            if constexpr (fiber::is_trivially_relocatable_v<T>){
+                std::memcpy(static_cast<void*>(dest), static_cast<const void*>(source), sizeof(T));
+            }else{
+                std::construct_at(dest, std::move(*source));
+                std::destroy_at(source);
+            }
+        }
+
+        /**
+         * @brief removes the elements for which `f` returns `true` from the `count` elements of a list
+         *
+         * Element `i` is at `root[step * i]`, so the same code compacts lists that grow upwards (`step = 1`)
+         * and the right list of a `fiber::DualArrayList` that grows downwards (`step = -1`).
+         * Erased elements are destroyed and kept elements are relocated into the gap in a single pass,
+         * trivially relocatable ones as raw memory without a move and a destruction.
+         * `f` is called exactly once per element, in order.
+         *
+         * @returns the number of kept elements
+         */
+        template<std::ptrdiff_t step, class T, class Callable>
+        std::size_t erase_if(T* root, std::size_t count, Callable&& f){
+            static_assert(step == 1 || step == -1);
+
+            if(count == 0) return 0;
+
+            // search the first element to erase, nothing has to move before it
+            // pointers only advance to elements that exist, `root + step * count` is never formed
+            T* read = root;
+            std::size_t n_kept = 0;
+            while(!f(*read)){
+                if(++n_kept == count) return count;
+                read += step;
+            }
+            std::destroy_at(read);
+
+            T* write = read;
+            for(std::size_t n_read = n_kept + 1; n_read < count; ++n_read){
+                read += step;
+                if(f(*read)){
+                    std::destroy_at(read);
+                }else{
+                    detail::relocate_one(write, read);
+                    write += step;
+                    ++n_kept;
+                }
+            }
+            return n_kept;
+        }
+
+    } // namespace detail
+
     /** 
      * @brief An array of contiguous memory which is statically allocated
      * 
@@ -77,7 +178,7 @@ namespace fiber
         ~ArrayList(){
             if constexpr (!std::is_trivially_destructible<T>::value){
                 for(T& elem : *this){
-                    elem->~T();
+                    elem.~T();
                 }
             }
         }
@@ -242,11 +343,24 @@ namespace fiber
             return this->back();
         }
 
+        /// @brief appends `count` many default initialised elements
+        /// @details Trivial types like `char` are left uninitialised, so the new elements can be the target of a block copy.
+        /// @return an iterator to the first appended element
+        iterator append_default(const size_type count){
+            FIBER_ASSERT_O1(count <= this->reserve());
+            const iterator first = this->end();
+            if constexpr (!std::is_trivially_default_constructible_v<T>){
+                for(iterator itr = first; itr != first + count; ++itr) new (itr) T;
+            }
+            this->_size += count;
+            return first;
+        }
+
         /// @brief clears the list - destructs all members if necessary and sets the size to zero
         void clear(){
             if constexpr (!std::is_trivially_destructible<T>::value){
                 for(T& elem : *this){
-                    elem->~T();
+                    elem.~T();
                 }
             }
             this->_size = 0;
@@ -269,8 +383,10 @@ namespace fiber
         template<std::forward_iterator Itr>
         requires std::convertible_to<typename std::iterator_traits<Itr>::value_type, T>
         inline void append(Itr first, Itr last){
-            for(; first != last; ++first) 
-                this->emplace_back(*first);
+            const size_type count = static_cast<size_type>(std::distance(first, last));
+            FIBER_ASSERT_O1(count <= this->reserve());
+            detail::uninitialized_copy(first, last, this->end());
+            this->_size += count;
         }
 
         /// @brief assigns a range defined by foreward iterators using the closed-open principle [first, last). After the assignment the list has the size of the assigned range
@@ -366,12 +482,7 @@ namespace fiber
         /// @return an iterator pointing to the inserted value
         template<std::convertible_to<T> Ta>
         iterator insert(const const_iterator pos, const Ta& value){
-            FIBER_ASSERT_O1(!this->full());
-            for(auto i = this->end(); i != pos; --i) *i = std::move(*(i-1));
-            ++this->_size;
-            iterator pos_ = unconst(pos);
-            *pos_ = value;
-            return pos_;
+            return this->insert(pos, T(value));
         }
 
         /// @brief Inserts a value
@@ -381,10 +492,11 @@ namespace fiber
         template<std::convertible_to<T> Ta>
         iterator insert(const const_iterator pos, Ta&& value){
             FIBER_ASSERT_O1(!this->full());
-            for(auto i = this->end(); i != pos; --i) *i = std::move(*(i-1));
+            T element(std::forward<Ta>(value)); // the value may be an element of this list
+            iterator pos_ = this->unconst(pos);
+            detail::relocate(pos_ + 1, pos_, static_cast<size_type>(this->end() - pos_));
+            std::construct_at(pos_, std::move(element));
             ++this->_size;
-            iterator pos_ = unconst(pos);
-            *pos_ = std::move(value);
             return pos_;
         }
 
@@ -399,11 +511,11 @@ namespace fiber
         iterator insert(const const_iterator pos, Itr first, Itr last){
             size_type dist = std::distance(first, last);
             FIBER_ASSERT_O1(fiber::less_equal(dist, this->reserve()));
-            for(auto i = this->end(); i != pos; --i) *(i + dist - 1) = std::move(*(i - 1));
-            iterator insertIterator = this->unconst(pos);
-            for(; first != last; ++first, (void)++insertIterator) *insertIterator = *first;
+            iterator pos_ = this->unconst(pos);
+            detail::relocate(pos_ + dist, pos_, static_cast<size_type>(this->end() - pos_));
+            detail::uninitialized_copy(first, last, pos_);
             this->_size += dist;
-            return unconst(pos);
+            return pos_;
         }
 
         /// @brief inserts a range at the given position
@@ -478,14 +590,11 @@ namespace fiber
         /// @returns an iterator the element after the removed one
         iterator erase(const_iterator cpos){
             FIBER_ASSERT_O1(!this->empty());
-            iterator destItr = this->unconst(cpos);
-            iterator sourceItr = destItr + 1;
-            for(; sourceItr < this->end(); ++sourceItr, (void)++destItr) *destItr = std::move(*sourceItr);
-            if constexpr (!std::is_trivially_destructible_v<T>){
-                this->back().~T();
-            }
+            iterator pos = this->unconst(cpos);
+            std::destroy_at(pos);
+            detail::relocate(pos, pos + 1, static_cast<size_type>(this->end() - pos - 1));
             --this->_size;
-            return this->unconst(cpos);
+            return pos;
         }
 
         /// @brief erases/removes the element at the position pointed to by `cpos` 
@@ -504,17 +613,12 @@ namespace fiber
             FIBER_ASSERT_O1(first <= this->end());
             FIBER_ASSERT_O1(this->begin() <= last);
             FIBER_ASSERT_O1(last <= this->end());
-            iterator destItr = this->unconst(first);
-            iterator sourceItr = this->unconst(last);
-            for(; (destItr != last) && (sourceItr != this->end()); ++destItr, (void)++sourceItr) *destItr = std::move(*sourceItr);
-            
-            if constexpr (!std::is_trivially_destructible_v<T>){
-                for(; destItr != this->end(); ++destItr) destItr->~T();
-            }
-            
-            const auto dist = std::distance(first, last);
-            this->_size -= dist;
-            return this->unconst(last-dist);
+            iterator first_ = this->unconst(first);
+            iterator last_ = this->unconst(last);
+            std::destroy(first_, last_);
+            detail::relocate(first_, last_, static_cast<size_type>(this->end() - last_));
+            this->_size -= static_cast<size_type>(last_ - first_);
+            return first_;
         }
 
         /// @brief erases elements from the list if they satisfy the callable
@@ -522,43 +626,8 @@ namespace fiber
         /// @param f Condition that returns `true` if that element should be erased from the list.
         template<class Callable>
         std::size_t erase_if(Callable&& f){
-            iterator read_itr = this->begin();
-            const iterator end_itr = this->end();
-
-            // search first that is true
-            for(;read_itr != end_itr; ++read_itr){
-                if(f(*read_itr)) break;
-            }
-
-            // return if it did not aplie to any
-            if(read_itr == end_itr) return 0;
-            
-            // setup first read and write iterators
-            iterator write_itr = read_itr;
-            ++read_itr;
-
-            // move down or skip if erased
-            while(read_itr != end_itr){
-                if(f(*read_itr)){
-                    ++read_itr;
-                }else{
-                    *write_itr = std::move(*read_itr);
-                    ++write_itr;
-                    ++read_itr;
-                }
-            }
-
-            // calculate new and erased size
-            std::size_t new_size = std::distance(this->begin(), write_itr);
-            std::size_t n_erased = std::distance(write_itr, this->end());
-
-            // destroy remaining
-            if constexpr (!std::is_trivially_destructible_v<T>){
-                for(; write_itr != end_itr; ++write_itr){
-                    write_itr->~T();
-                }
-            }
-            
+            const size_type new_size = detail::erase_if<1>(this->data(), this->size(), std::forward<Callable>(f));
+            const size_type n_erased = this->size() - new_size;
             this->_size = new_size;
             return n_erased;
         }
@@ -0,0 +1,238 @@
+#pragma once
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+// fiber
+#include <fiber/Exceptions/Exceptions.hpp>
+
+namespace fiber
+{
+
+    /**
+     * @brief A lock-free bipartite ring buffer for one producer and one consumer that hands out contiguous regions
+     *
+     * Unlike a ring buffer, every region that the producer reserves and every region that the consumer reads
+     * is one contiguous piece of memory: a DMA can receive straight into the buffer and a parser can work in place.
+     * If a reservation does not fit at the end of the buffer, it starts at the front again and the end of the
+     * valid data is remembered in a watermark, the consumer continues at the front once it reaches it.
+     *
+     * Producer side:
+     * 1. `reserve(n)` or `reserve_max()` returns a free contiguous region (or an empty span)
+     * 2. write up to its size into it, for example with a DMA
+     * 3. `commit(n)` publishes the first `n` elements of the region to the consumer
+     *
+     * Consumer side:
+     * 1. `read()` returns the oldest contiguous region of committed data
+     * 2. process it in place
+     * 3. `release(n)` frees the first `n` elements of it
+     *
+     * ```C++
+     * fiber::BipBuffer<256> rx;
+     *
+     * void start_dma(){
+     *     std::span<uint8_t> region = rx.reserve_max();
+     *     dma_start(region.data(), region.size());
+     * }
+     *
+     * void DMA_IRQHandler(){
+     *     rx.commit(dma_received());
+     *     start_dma();
+     * }
+     *
+     * fiber::Coroutine<fiber::Exit> receive(){
+     *     while(true){
+     *         co_await rx.data_available();
+     *         std::span<const uint8_t> data = rx.read();
+     *         rx.release(parse(data));
+     *     }
+     * }
+     * ```
+     *
+     * The producer publishes its write position and the consumer its read position with release stores,
+     * each reads the position of the other with an acquire load. No interrupt has to be disabled.
+     *
+     * @tparam N The capacity in elements
+     * @tparam T The type of the elements, has to be trivially copyable
+     */
+    template<std::size_t N, class T = uint8_t>
+    class BipBuffer{
+        static_assert(std::is_trivially_copyable_v<T>, "The elements of a BipBuffer are written by raw memory access");
+        static_assert(N >= 2, "A BipBuffer needs at least two elements");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        /// @brief awaitable that is ready once `count` elements can be read (`data_available()`) or reserved (`space_available()`)
+        class Awaitable{
+        private:
+            const BipBuffer* _buffer;
+            size_type _count;
+            bool _space;
+
+        public:
+            constexpr Awaitable(const BipBuffer* buffer, size_type count, bool space) : _buffer(buffer), _count(count), _space(space){}
+
+            bool await_ready() const noexcept {
+                return this->_space ? this->_buffer->can_reserve(this->_count) : (this->_buffer->size() >= this->_count);
+            }
+
+            constexpr void await_resume() const noexcept {}
+        };
+
+    private:
+        T _data[N];
+        std::atomic<size_type> _write = 0;      // end of the committed data, written by the producer
+        std::atomic<size_type> _read = 0;       // start of the unread data, written by the consumer
+        std::atomic<size_type> _watermark = N;  // end of the data before the wrap, written by the producer before it wraps
+
+        // the current reservation, only used by the producer
+        size_type _reserve_start = 0;
+        size_type _reserve_size = 0;
+
+        // the start of a reservation with `n` elements or `N` if there is no such space
+        static constexpr size_type reserve_start(size_type write, size_type read, size_type n){
+            if(write >= read){
+                if(N - write >= n) return write;
+                if(read > n) return 0; // wrap, but never make write == read, that means empty
+                return N;
+            }else{
+                return (write + n < read) ? write : N;
+            }
+        }
+
+    public:
+
+        constexpr BipBuffer() = default;
+        BipBuffer(const BipBuffer&) = delete;
+        BipBuffer& operator=(const BipBuffer&) = delete;
+
+        /// @brief returns the capacity of the container
+        static constexpr size_type capacity() {return N;}
+
+        /// @brief returns the number of committed elements that have not been released, contiguous or not
+        size_type size() const {
+            const size_type read = this->_read.load(std::memory_order_acquire);
+            const size_type write = this->_write.load(std::memory_order_acquire);
+            if(write >= read) return write - read;
+            return this->_watermark.load(std::memory_order_relaxed) - read + write;
+        }
+
+        /// @brief returns true if there is no committed data
+        bool empty() const {return this->size() == 0;}
+
+        /// @brief returns `true` if `reserve(n)` would succeed, exact for the producer and a lower bound for the consumer
+        bool can_reserve(size_type n) const {
+            const size_type read = this->_read.load(std::memory_order_acquire);
+            const size_type write = this->_write.load(std::memory_order_relaxed);
+            return reserve_start(write, read, n) != N || n == 0;
+        }
+
+        /// @brief `co_await` suspends until at least `count` elements can be read
+        Awaitable data_available(size_type count = 1) const {return Awaitable(this, count, false);}
+
+        /// @brief `co_await` suspends until a region of `count` elements can be reserved
+        Awaitable space_available(size_type count = 1) const {return Awaitable(this, count, true);}
+
+        // ---- producer ----
+
+        /**
+         * @brief reserves a contiguous region of exactly `n` elements
+         * @returns the region, or an empty span if there is not enough contiguous space
+         */
+        std::span<T> reserve(size_type n){
+            const size_type read = this->_read.load(std::memory_order_acquire);
+            const size_type write = this->_write.load(std::memory_order_relaxed);
+            const size_type start = reserve_start(write, read, n);
+            if(start == N || n == 0){
+                this->_reserve_size = 0;
+                return {};
+            }
+            this->_reserve_start = start;
+            this->_reserve_size = n;
+            return std::span<T>(this->_data + start, n);
+        }
+
+        /**
+         * @brief reserves the largest contiguous free region, for example for a DMA transfer of unknown length
+         * @returns the region, or an empty span if the buffer is full
+         */
+        std::span<T> reserve_max(){
+            const size_type read = this->_read.load(std::memory_order_acquire);
+            const size_type write = this->_write.load(std::memory_order_relaxed);
+            size_type n;
+            if(write >= read){
+                const size_type back = N - write;
+                const size_type front = (read > 0) ? read - 1 : 0;
+                n = std::max(back, front);
+            }else{
+                n = read - write - 1;
+            }
+            return this->reserve(n);
+        }
+
+        /**
+         * @brief publishes the first `n` elements of the last reservation to the consumer and ends the reservation
+         * @param n the number of written elements, at most the size of the reservation
+         */
+        void commit(size_type n){
+            FIBER_ASSERT_O1_MSG(n <= this->_reserve_size, "Cannot commit more than was reserved!");
+            this->_reserve_size = 0;
+            if(n == 0) return;
+            const size_type write = this->_write.load(std::memory_order_relaxed);
+            const size_type start = this->_reserve_start;
+            if(start != write){
+                // the reservation wrapped to the front: the data before the wrap ends at the old write position
+                this->_watermark.store(write, std::memory_order_relaxed);
+            }
+            this->_write.store(start + n, std::memory_order_release);
+        }
+
+        /// @brief copies all `count` values into the buffer, returns `false` and copies nothing if they do not fit contiguously
+        bool write(const T* values, size_type count){
+            std::span<T> region = this->reserve(count);
+            if(region.size() != count || count == 0) return false;
+            std::copy_n(values, count, region.data());
+            this->commit(count);
+            return true;
+        }
+
+        // ---- consumer ----
+
+        /// @brief returns the oldest contiguous region of committed data, or an empty span if there is none
+        std::span<const T> read(){
+            size_type read = this->_read.load(std::memory_order_relaxed);
+            const size_type write = this->_write.load(std::memory_order_acquire);
+            if(write < read){
+                const size_type watermark = this->_watermark.load(std::memory_order_relaxed);
+                if(read < watermark) return std::span<const T>(this->_data + read, watermark - read);
+                // everything before the wrap has been read
+                read = 0;
+                this->_read.store(read, std::memory_order_release);
+            }
+            return std::span<const T>(this->_data + read, write - read);
+        }
+
+        /**
+         * @brief frees the first `n` elements of the region returned by `read()`
+         * @param n the number of processed elements, at most the size of the last region
+         */
+        void release(size_type n){
+            size_type read = this->_read.load(std::memory_order_relaxed);
+            const size_type write = this->_write.load(std::memory_order_acquire);
+            const bool wrapped = write < read;
+            const size_type end = wrapped ? this->_watermark.load(std::memory_order_relaxed) : write;
+            FIBER_ASSERT_O1_MSG(read + n <= end, "Cannot release more than was read!");
+            read += n;
+            if(wrapped && read == end) read = 0; // continue at the front after the wrap
+            this->_read.store(read, std::memory_order_release);
+        }
+    };
+
+} // namespace fiber
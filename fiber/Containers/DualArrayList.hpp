@@ -9,11 +9,11 @@
 #include <ranges>
 #include <functional>
 #include <concepts> 
+#include <memory>
 
 // fiber
 #include <fiber/Containers/ArrayList.hpp>
 
-// TODO: use the memcpy - to potentially use dma copy
 // TODO: Make a ArrayListSlice that stores pointers and feels like woring with references to the elements of another list.
 // TODO: Make a reference type (ArrayListRef) that references the whole list with a pointer to the data, a pointer to its size, an int of the capacity
 // TODO: also make a const reference version of both slice and ref
@@ -391,7 +391,7 @@ namespace fiber
         void left_clear(){
             if constexpr (!std::is_trivially_destructible<T>::value){
                 for(reference elem : this->left_subrange()){
-                    elem->~T();
+                    elem.~T();
                 }
             }
             this->_left_size = 0;
@@ -402,7 +402,7 @@ namespace fiber
         void right_clear(){
             if constexpr (!std::is_trivially_destructible<T>::value){
                 for(reference elem : this->right_subrange()){
-                    elem->~T();
+                    elem.~T();
                 }
             }
             this->_right_size = 0;
@@ -448,8 +448,10 @@ namespace fiber
         template<std::forward_iterator Itr>
         requires std::convertible_to<typename std::iterator_traits<Itr>::value_type, T>
         inline void left_append(Itr first, Itr last){
-            for(; first != last; ++first) 
-                this->left_emplace_back(*first);
+            const size_type count = static_cast<size_type>(std::distance(first, last));
+            FIBER_ASSERT_O1(count <= this->reserve());
+            detail::uninitialized_copy(first, last, this->left_end());
+            this->_left_size += count;
         }
 
         template<std::forward_iterator Itr>
@@ -625,42 +627,34 @@ namespace fiber
 
         template<std::convertible_to<T> Ta>
         left_iterator left_insert(const left_const_iterator pos, const Ta& value){
-            FIBER_ASSERT_O1(!this->full());
-            for(auto i = this->left_end(); i != pos; --i) *i = std::move(*(i-1));
-            this->_left_size += 1;
-            left_iterator pos_ = left_unconst(pos);
-            *pos_ = value;
-            return pos_;
+            return this->left_insert(pos, T(value));
         }
 
         template<std::convertible_to<T> Ta>
         right_iterator right_insert(const right_const_iterator pos, const Ta& value){
-            FIBER_ASSERT_O1(!this->full());
-            for(auto i = this->right_end(); i != pos; --i) *i = std::move(*(i-1));
-            this->_right_size += 1;
-            right_iterator pos_ = right_unconst(pos);
-            *pos_ = value;
-            return pos_;
+            return this->right_insert(pos, T(value));
         }
 
         template<std::convertible_to<T> Ta>
         left_iterator left_insert(const left_const_iterator pos, Ta&& value){
             FIBER_ASSERT_O1(!this->full());
-            for(auto i = this->left_end(); i != pos; --i) *i = std::move(*(i-1));
+            T element(std::forward<Ta>(value)); // the value may be an element of this list
+            const size_type index = this->left_to_index(pos);
+            this->left_open_gap(index, 1);
+            std::construct_at(this->left_element(index), std::move(element));
             this->_left_size += 1;
-            left_iterator pos_ = left_unconst(pos);
-            *pos_ = std::move(value);
-            return pos_;
+            return this->left_begin() + index;
         }
 
         template<std::convertible_to<T> Ta>
         right_iterator right_insert(const right_const_iterator pos, Ta&& value){
             FIBER_ASSERT_O1(!this->full());
-            for(auto i = this->right_end(); i != pos; --i) *i = std::move(*(i-1));
+            T element(std::forward<Ta>(value)); // the value may be an element of this list
+            const size_type index = this->right_to_index(pos);
+            this->right_open_gap(index, 1);
+            std::construct_at(this->right_element(index), std::move(element));
             this->_right_size += 1;
-            right_iterator pos_ = right_unconst(pos);
-            *pos_ = std::move(value);
-            return pos_;
+            return this->right_begin() + index;
         }
 
         template<std::forward_iterator Itr>
@@ -668,11 +662,11 @@ namespace fiber
         left_iterator left_insert(const left_const_iterator pos, Itr first, Itr last){
             size_type dist = std::distance(first, last);
             FIBER_ASSERT_O1(fiber::less_equal(dist, this->reserve()));
-            for(auto i = this->left_end(); i != pos; --i) *(i + dist - 1) = std::move(*(i - 1));
-            left_iterator insertIterator = this->left_unconst(pos);
-            for(; first != last; ++first, (void)++insertIterator) *insertIterator = *first;
+            const size_type index = this->left_to_index(pos);
+            this->left_open_gap(index, dist);
+            detail::uninitialized_copy(first, last, this->left_element(index));
             this->_left_size += dist;
-            return left_unconst(pos);
+            return this->left_begin() + index;
         }
 
         template<std::forward_iterator Itr>
@@ -680,11 +674,11 @@ namespace fiber
         right_iterator right_insert(const right_const_iterator pos, Itr first, Itr last){
             size_type dist = std::distance(first, last);
             FIBER_ASSERT_O1(fiber::less_equal(dist, this->reserve()));
-            for(auto i = this->right_end(); i != pos; --i) *(i + dist - 1) = std::move(*(i - 1));
-            right_iterator insertIterator = this->right_unconst(pos);
-            for(; first != last; ++first, (void)++insertIterator) *insertIterator = *first;
+            const size_type index = this->right_to_index(pos);
+            this->right_open_gap(index, dist);
+            for(size_type i = index; first != last; ++first, (void)++i) std::construct_at(this->right_element(i), *first);
             this->_right_size += dist;
-            return right_unconst(pos);
+            return this->right_begin() + index;
         }
 
         template<std::ranges::forward_range Range>
@@ -861,26 +855,20 @@ namespace fiber
 
         left_iterator left_erase(left_const_iterator cpos){
             FIBER_ASSERT_O1(!this->left_empty());
-            left_iterator destItr = this->left_unconst(cpos);
-            left_iterator sourceItr = destItr + 1;
-            for(; sourceItr < this->left_end(); ++sourceItr, (void)++destItr) *destItr = std::move(*sourceItr);
-            if constexpr (!std::is_trivially_destructible<T>::value){
-                this->left_back().~T();
-            }
+            const size_type index = this->left_to_index(cpos);
+            std::destroy_at(this->left_element(index));
+            this->left_close_gap(index, 1);
             this->_left_size -= 1;
-            return this->left_unconst(cpos);
+            return this->left_begin() + index;
         }
 
         right_iterator right_erase(right_const_iterator cpos){
             FIBER_ASSERT_O1(!this->right_empty());
-            right_iterator destItr = this->right_unconst(cpos);
-            right_iterator sourceItr = destItr + 1;
-            for(; sourceItr < this->right_end(); ++sourceItr, (void)++destItr) *destItr = std::move(*sourceItr);
-            if constexpr (!std::is_trivially_destructible<T>::value){
-                this->right_back().~T();
-            }
+            const size_type index = this->right_to_index(cpos);
+            std::destroy_at(this->right_element(index));
+            this->right_close_gap(index, 1);
             this->_right_size -= 1;
-            return this->right_unconst(cpos);
+            return this->right_begin() + index;
         }
 
         template<std::integral Int>
@@ -898,20 +886,12 @@ namespace fiber
             FIBER_ASSERT_O1(first <= this->left_end());
             FIBER_ASSERT_O1(this->left_begin() <= last);
             FIBER_ASSERT_O1(last <= this->left_end());
-            left_iterator destItr = this->left_unconst(first);
-            left_iterator sourceItr = this->left_unconst(last);
-            for(; (destItr != last) && (sourceItr != this->left_end()); ++destItr, (void)++sourceItr){
-                *destItr = std::move(*sourceItr);
-            }
-            
-            if constexpr (!std::is_trivially_destructible<T>::value){
-                for(; destItr != this->left_end(); ++destItr){
-                    destItr->~T();
-                }
-            }
-            const auto dist = std::distance(first, last);
+            const size_type index = this->left_to_index(first);
+            const size_type dist = static_cast<size_type>(last - first);
+            for(size_type i = index; i < index + dist; ++i) std::destroy_at(this->left_element(i));
+            this->left_close_gap(index, dist);
             this->_left_size -= dist;
-            return this->left_unconst(last-dist);
+            return this->left_begin() + index;
         }
 
         right_iterator right_erase(right_const_iterator first, right_const_iterator last){
@@ -919,101 +899,26 @@ namespace fiber
             FIBER_ASSERT_O1(first <= this->right_end());
             FIBER_ASSERT_O1(this->right_begin() <= last);
             FIBER_ASSERT_O1(last <= this->right_end());
-            right_iterator destItr = this->right_unconst(first);
-            right_iterator sourceItr = this->right_unconst(last);
-            for(; (destItr != last) && (sourceItr != this->right_end()); ++destItr, (void)++sourceItr){
-                *destItr = std::move(*sourceItr);
-            }
-            
-            if constexpr (!std::is_trivially_destructible<T>::value){
-                for(; destItr != this->right_end(); ++destItr){
-                    destItr->~T();
-                }
-            }
-
-            const auto dist = std::distance(first, last);
+            const size_type index = this->right_to_index(first);
+            const size_type dist = static_cast<size_type>(last - first);
+            for(size_type i = index; i < index + dist; ++i) std::destroy_at(this->right_element(i));
+            this->right_close_gap(index, dist);
             this->_right_size -= dist;
-            return this->right_unconst(last-dist);
+            return this->right_begin() + index;
         }
 
         template<class Callable>
         std::size_t left_erase_if(Callable&& f){
-            left_iterator read_itr = this->left_begin();
-            const left_iterator end_itr = this->left_end();
-
-            // search first that is true
-            for(;read_itr != end_itr; ++read_itr){
-                if(f(*read_itr)) break;
-            }
-
-            // return if it did not aplie to any
-            if(read_itr == end_itr) return 0;
-            
-            // setup first read and write iterators
-            left_iterator write_itr = read_itr;
-            ++read_itr;
-
-            // move down or skip if erased
-            while(read_itr != end_itr){
-                if(f(*read_itr)){
-                    ++read_itr;
-                }else{
-                    *write_itr = std::move(*read_itr);
-                    ++write_itr;
-                    ++read_itr;
-                }
-            }
-            // calculate new and erased size
-            std::size_t new_size = write_itr - this->left_begin();
-            std::size_t n_erased = this->left_end() - write_itr;
-
-            // destroy remaining
-            if constexpr (!std::is_trivially_destructible<T>::value){
-                for(; write_itr != end_itr; ++write_itr){
-                    write_itr->~T();
-               }
-            }
+            const size_type new_size = detail::erase_if<1>(this->left_element(0), this->left_size(), std::forward<Callable>(f));
+            const size_type n_erased = this->left_size() - new_size;
             this->_left_size = new_size;
             return n_erased;
         }
 
         template<class Callable>
         std::size_t right_erase_if(Callable&& f){
-            right_iterator read_itr = this->right_begin();
-            const right_iterator end_itr = this->right_end();
-
-            // search first that is true
-            for(;read_itr != end_itr; ++read_itr){
-                if(f(*read_itr)) break;
-            }
-
-            // return if it did not aplie to any
-            if(read_itr == end_itr) return 0;
-            
-            // setup first read and write iterators
-            right_iterator write_itr = read_itr;
-            ++read_itr;
-
-            // move down or skip if erased
-            while(read_itr != end_itr){
-                if(f(*read_itr)){
-                    ++read_itr;
-                }else{
-                    *write_itr = std::move(*read_itr);
-                    ++write_itr;
-                    ++read_itr;
-                }
-            }
-            // calculate new and erased size
-            std::size_t new_size = std::distance(this->right_begin(), write_itr);
-            std::size_t n_erased = std::distance(write_itr, this->right_end());
-
-            // destroy remaining
-            if constexpr (!std::is_trivially_destructible<T>::value){
-                for(; write_itr != end_itr; ++write_itr){
-                    write_itr->~T();
-               }
-            }
+            const size_type new_size = detail::erase_if<-1>(this->right_element(0), this->right_size(), std::forward<Callable>(f));
+            const size_type n_erased = this->right_size() - new_size;
             this->_right_size = new_size;
             return n_erased;
         }
@@ -1057,6 +962,32 @@ namespace fiber
                 *itr = function(*itr);
             }
         }
+
+    private:
+        // the address of element `i` of the left or right list, also past the end
+        pointer left_element(size_type i){return this->data() + i;}
+        pointer right_element(size_type i){return this->data() + (N - 1 - i);}
+
+        // moves the elements `[index, size)` `n` places back to open a gap of uninitialised memory at `index`
+        void left_open_gap(size_type index, size_type n){
+            detail::relocate(this->left_element(index + n), this->left_element(index), this->left_size() - index);
+        }
+
+        void right_open_gap(size_type index, size_type n){
+            // the right list is stored backwards: its last element has the lowest address
+            pointer low = this->data() + (N - this->right_size());
+            detail::relocate(low - n, low, this->right_size() - index);
+        }
+
+        // moves the elements `[index + n, size)` `n` places to the front to close the gap of destroyed elements at `index`
+        void left_close_gap(size_type index, size_type n){
+            detail::relocate(this->left_element(index), this->left_element(index + n), this->left_size() - index - n);
+        }
+
+        void right_close_gap(size_type index, size_type n){
+            pointer low = this->data() + (N - this->right_size());
+            detail::relocate(low + n, low, this->right_size() - index - n);
+        }
     };
 
     template<class T, std::size_t N>
@@ -1,12 +1,30 @@
 #pragma once
 
+// std
+#include <cstddef>
+
+// fiber
 #include "DualArrayList.hpp"
+#include "dary_heap.hpp"
 
 namespace fiber
 {
 
-    
-    template<class T, size_t N, class stage1_less_priority, class stage2_less_priority>
+    /**
+     * @brief Two priority queues in one buffer of `N` elements: stage 1 grows from the back, stage 2 from the front
+     *
+     * Elements usually move from stage 1 to stage 2, for example from the queue sorted by ready times
+     * to the queue sorted by deadlines, so both share the capacity.
+     * Each stage is a d-ary heap (see `fiber::push_dary_heap()`): with `arity = 4` the heaps are half as deep
+     * as binary heaps, which makes pops cheaper for large queues.
+     *
+     * @tparam T The type of the elements
+     * @tparam N The number of elements of both stages together
+     * @tparam stage1_less_priority Comparator of stage 1, returns `true` if the first argument has a lower priority
+     * @tparam stage2_less_priority Comparator of stage 2, returns `true` if the first argument has a lower priority
+     * @tparam arity The number of children per node of the heaps, at least 2
+     */
+    template<class T, size_t N, class stage1_less_priority, class stage2_less_priority, size_t arity = 2>
     class DualPriorityQueue{
     private:
         DualArrayList<T, N> _buffer;
@@ -88,31 +106,31 @@ namespace fiber
 
         void stage1_push(const T& value){
             this->stage1().emplace_back(value);
-            std::push_heap(this->stage1().begin(), this->stage1().end(), stage1_less_priority{});
+            fiber::push_dary_heap<arity>(this->stage1().begin(), this->stage1().end(), stage1_less_priority{});
         }
 
         void stage1_push(T&& value){
             this->stage1().emplace_back(std::move(value));
-            std::push_heap(this->stage1().begin(), this->stage1().end(), stage1_less_priority{});
+            fiber::push_dary_heap<arity>(this->stage1().begin(), this->stage1().end(), stage1_less_priority{});
         }
 
         void stage2_push(const T& value){
             this->stage2().emplace_back(value);
-            std::push_heap(this->stage2().begin(), this->stage2().end(), stage2_less_priority{});
+            fiber::push_dary_heap<arity>(this->stage2().begin(), this->stage2().end(), stage2_less_priority{});
         }
 
         void stage2_push(T&& value){
             this->stage2().emplace_back(std::move(value));
-            std::push_heap(this->stage2().begin(), this->stage2().end(), stage2_less_priority{});
+            fiber::push_dary_heap<arity>(this->stage2().begin(), this->stage2().end(), stage2_less_priority{});
         }
 
         void stage2_pop(){
-            std::pop_heap(this->stage2().begin(), this->stage2().end(), stage2_less_priority{});
+            fiber::pop_dary_heap<arity>(this->stage2().begin(), this->stage2().end(), stage2_less_priority{});
             this->stage2().pop_back();
         }
 
         void stage1_pop(){
-            std::pop_heap(this->stage1().begin(), this->stage1().end(), stage2_less_priority{});
+            fiber::pop_dary_heap<arity>(this->stage1().begin(), this->stage1().end(), stage1_less_priority{});
             this->stage1().pop_back();
         }
 
@@ -131,10 +149,10 @@ namespace fiber
 
     };    
 
-    template<class T, size_t N, class stage1_less_priority, class stage2_less_priority>
+    template<class T, size_t N, class stage1_less_priority, class stage2_less_priority, size_t arity = 2>
     class Stage1DualPriorityQueueConstRef{
         private:
-        using BaseType = DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority>;
+        using BaseType = DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority, arity>;
         const BaseType& _queue;
 
         public:
@@ -146,7 +164,7 @@ namespace fiber
         using iterator = BaseType::stage1_iterator;
         using const_iterator = BaseType::stage1_const_iterator;
 
-        Stage1DualPriorityQueueConstRef(const DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority>& queue)
+        Stage1DualPriorityQueueConstRef(const DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority, arity>& queue)
             : _queue(queue){}
 
         constexpr const_iterator begin() const {return this->_queue.stage1_begin();}
@@ -177,10 +195,10 @@ namespace fiber
         constexpr const_reference top() const {return this->_queue.stage1_top();}
     };  
 
-    template<class T, size_t N, class stage1_less_priority, class stage2_less_priority>
+    template<class T, size_t N, class stage1_less_priority, class stage2_less_priority, size_t arity = 2>
     class Stage1DualPriorityQueueRef{
         private:
-        using BaseType = DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority>;
+        using BaseType = DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority, arity>;
         BaseType& _queue;
 
 
@@ -193,7 +211,7 @@ namespace fiber
         using iterator = BaseType::stage1_iterator;
         using const_iterator = BaseType::stage1_const_iterator;
 
-        Stage1DualPriorityQueueRef(DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority>& queue)
+        Stage1DualPriorityQueueRef(DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority, arity>& queue)
             : _queue(queue){}
 
 
@@ -241,10 +259,10 @@ namespace fiber
         inline T top_pop(){return this->_queue.stage1_top_pop();}
     };  
 
-    template<class T, size_t N, class stage1_less_priority, class stage2_less_priority>
+    template<class T, size_t N, class stage1_less_priority, class stage2_less_priority, size_t arity = 2>
     class Stage2DualPriorityQueueConstRef{
         private:
-        using BaseType = DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority>;
+        using BaseType = DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority, arity>;
         const BaseType& _queue;
 
         public:
@@ -256,7 +274,7 @@ namespace fiber
         using iterator = BaseType::stage2_iterator;
         using const_iterator = BaseType::stage2_const_iterator;
 
-        Stage2DualPriorityQueueConstRef(const DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority>& queue)
+        Stage2DualPriorityQueueConstRef(const DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority, arity>& queue)
             : _queue(queue){}
 
         constexpr const_iterator begin() const {return this->_queue.stage2_begin();}
@@ -288,10 +306,10 @@ namespace fiber
     };
 
 
-    template<class T, size_t N, class stage1_less_priority, class stage2_less_priority>
+    template<class T, size_t N, class stage1_less_priority, class stage2_less_priority, size_t arity = 2>
     class Stage2DualPriorityQueueRef{
         private:
-        using BaseType = DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority>;
+        using BaseType = DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority, arity>;
         BaseType& _queue;
 
         public:
@@ -303,7 +321,7 @@ namespace fiber
         using iterator = BaseType::stage2_iterator;
         using const_iterator = BaseType::stage2_const_iterator;
 
-        Stage2DualPriorityQueueRef(DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority>& queue)
+        Stage2DualPriorityQueueRef(DualPriorityQueue<T, N, stage1_less_priority, stage2_less_priority, arity>& queue)
             : _queue(queue){}
 
         constexpr iterator begin() {return this->_queue.stage2_begin();}
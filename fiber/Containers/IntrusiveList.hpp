@@ -0,0 +1,201 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+// fiber
+#include <fiber/Exceptions/Exceptions.hpp>
+
+namespace fiber
+{
+
+    /**
+     * @brief The links that an element of a `fiber::IntrusiveList` carries as a member
+     *
+     * Copying or moving a hook yields an unlinked hook, so elements can be moved before they are inserted.
+     *
+     * @tparam T The type of the elements
+     */
+    template<class T>
+    struct ListHook{
+        T* next = nullptr;
+        T* prev = nullptr;
+        const void* owner = nullptr; // the container that the element is linked into
+
+        constexpr ListHook() = default;
+        constexpr ListHook([[maybe_unused]]const ListHook& other) noexcept {}
+        constexpr ListHook& operator=([[maybe_unused]]const ListHook& other) noexcept {return *this;}
+    };
+
+    /**
+     * @brief A doubly linked list of elements that store their links themselves
+     *
+     * The list never allocates or copies elements: inserting and erasing only rewires the hooks of the elements,
+     * so its memory scales with the number of elements instead of a compile time capacity.
+     * Erasing a known element is O(1).
+     *
+     * The destructor does not touch the elements, they may have been destroyed before the container.
+     * Call `clear()` first, if the elements outlive the container and should be inserted somewhere else.
+     *
+     * An element can only be in one list per hook and may not be moved or destroyed while it is linked.
+     *
+     * Example:
+     * ```C++
+     * struct Node{
+     *     int value;
+     *     fiber::ListHook<Node> hook;
+     * };
+     *
+     * fiber::IntrusiveList<Node, &Node::hook> list;
+     * Node a{1};
+     * list.push_back(&a);
+     * ```
+     *
+     * @tparam T The type of the elements
+     * @tparam hook Pointer to the `fiber::ListHook<T>` member of `T`
+     */
+    template<class T, ListHook<T> T::* hook>
+    class IntrusiveList{
+    private:
+        T* _head = nullptr;
+        T* _tail = nullptr;
+        std::size_t _size = 0;
+
+        static constexpr ListHook<T>& links(T* element){return element->*hook;}
+        static constexpr const ListHook<T>& links(const T* element){return element->*hook;}
+
+    public:
+        using value_type = T*;
+        using size_type = std::size_t;
+
+        /// @brief forward iterator that yields pointers to the elements
+        class const_iterator{
+        private:
+            T* _element = nullptr;
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T*;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T* const*;
+            using reference = T* const&;
+
+            constexpr const_iterator() = default;
+            constexpr explicit const_iterator(T* element) : _element(element){}
+
+            constexpr reference operator*() const {return this->_element;}
+            constexpr const_iterator& operator++(){this->_element = links(this->_element).next; return *this;}
+            constexpr const_iterator operator++(int){const_iterator result = *this; ++*this; return result;}
+            friend constexpr bool operator==(const const_iterator& lhs, const const_iterator& rhs){return lhs._element == rhs._element;}
+        };
+        using iterator = const_iterator;
+
+        constexpr IntrusiveList() = default;
+        IntrusiveList(const IntrusiveList&) = delete;
+        IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+        constexpr const_iterator begin() const {return const_iterator(this->_head);}
+        constexpr const_iterator end() const {return const_iterator(nullptr);}
+
+        /// @brief returns the number of elements
+        constexpr size_type size() const {return this->_size;}
+
+        /// @brief returns `true` if the list has no elements
+        constexpr bool empty() const {return this->_head == nullptr;}
+
+        /// @brief returns the first element, the list may not be empty
+        constexpr T* front() const {return this->_head;}
+
+        /// @brief returns the last element, the list may not be empty
+        constexpr T* back() const {return this->_tail;}
+
+        /// @brief returns `true` if the element is linked into any list with this hook
+        static constexpr bool is_linked(const T* element){return links(element).owner != nullptr;}
+
+        /// @brief returns `true` if the element is linked into this list, O(1)
+        constexpr bool contains(const T* element) const {return links(element).owner == this;}
+
+        /// @brief appends the element, which may not be linked already
+        constexpr void push_back(T* element){
+            FIBER_ASSERT_O1_MSG(!is_linked(element), "The element is already linked into a list!");
+            ListHook<T>& l = links(element);
+            l.next = nullptr;
+            l.prev = this->_tail;
+            l.owner = this;
+            if(this->_tail != nullptr) links(this->_tail).next = element; else this->_head = element;
+            this->_tail = element;
+            ++this->_size;
+        }
+
+        /// @brief prepends the element, which may not be linked already
+        constexpr void push_front(T* element){
+            FIBER_ASSERT_O1_MSG(!is_linked(element), "The element is already linked into a list!");
+            ListHook<T>& l = links(element);
+            l.next = this->_head;
+            l.prev = nullptr;
+            l.owner = this;
+            if(this->_head != nullptr) links(this->_head).prev = element; else this->_tail = element;
+            this->_head = element;
+            ++this->_size;
+        }
+
+        /// @brief unlinks the element in O(1), it has to be an element of this list
+        constexpr void erase(T* element){
+            FIBER_ASSERT_O1_MSG(this->contains(element), "The element is not linked into this list!");
+            ListHook<T>& l = links(element);
+            if(l.prev != nullptr) links(l.prev).next = l.next; else this->_head = l.next;
+            if(l.next != nullptr) links(l.next).prev = l.prev; else this->_tail = l.prev;
+            l.next = nullptr;
+            l.prev = nullptr;
+            l.owner = nullptr;
+            --this->_size;
+        }
+
+        /// @brief unlinks and returns the first element, the list may not be empty
+        constexpr T* pop_front(){
+            T* element = this->_head;
+            this->erase(element);
+            return element;
+        }
+
+        /**
+         * @brief unlinks all elements for which `predicate(element)` returns `true`
+         *
+         * The consumer receives each erased element after it has been unlinked from this list,
+         * so moving elements from one list to another is a single pass:
+         * ```C++
+         * list.erase_if([&](Node* node){return node->value > 3;}, [&](Node* node){other.push_back(node);});
+         * ```
+         *
+         * @returns the number of erased elements
+         */
+        template<class Predicate, class Consumer>
+        constexpr size_type erase_if(Predicate&& predicate, Consumer&& consumer){
+            size_type n = 0;
+            T* element = this->_head;
+            while(element != nullptr){
+                T* next = links(element).next;
+                if(predicate(element)){
+                    this->erase(element);
+                    consumer(element);
+                    ++n;
+                }
+                element = next;
+            }
+            return n;
+        }
+
+        /// @brief unlinks all elements for which `predicate(element)` returns `true`, returns the number of erased elements
+        template<class Predicate>
+        constexpr size_type erase_if(Predicate&& predicate){
+            return this->erase_if(std::forward<Predicate>(predicate), []([[maybe_unused]]T* element){});
+        }
+
+        /// @brief unlinks all elements
+        constexpr void clear(){
+            while(!this->empty()) this->pop_front();
+        }
+    };
+
+} // namespace fiber
@@ -0,0 +1,260 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <iterator>
+
+// fiber
+#include <fiber/Exceptions/Exceptions.hpp>
+
+namespace fiber
+{
+
+    /**
+     * @brief The links that an element of a `fiber::IntrusivePairingHeap` carries as a member
+     *
+     * `prev` points to the parent for the first child and to the previous sibling otherwise.
+     * Copying or moving a hook yields an unlinked hook, so elements can be moved before they are inserted.
+     *
+     * @tparam T The type of the elements
+     */
+    template<class T>
+    struct PairingHeapHook{
+        T* child = nullptr;
+        T* next = nullptr;
+        T* prev = nullptr;
+        const void* owner = nullptr; // the container that the element is linked into
+
+        constexpr PairingHeapHook() = default;
+        constexpr PairingHeapHook([[maybe_unused]]const PairingHeapHook& other) noexcept {}
+        constexpr PairingHeapHook& operator=([[maybe_unused]]const PairingHeapHook& other) noexcept {return *this;}
+    };
+
+    /**
+     * @brief A priority queue of elements that store the links of the heap themselves
+     *
+     * A pairing heap (Fredman, Sedgewick, Sleator and Tarjan) as a tree of first-child and next-sibling links.
+     * Pushing is O(1), popping the top and erasing any element is O(log n) amortised.
+     * The heap never allocates or copies elements, so its memory scales with the number of elements
+     * instead of a compile time capacity.
+     *
+     * The comparator follows the convention of `std::push_heap`: `LessPriority{}(a, b)` returns `true`
+     * if `a` has a lower priority than `b`. The element with the highest priority is on the top.
+     *
+     * The destructor does not touch the elements, they may have been destroyed before the container.
+     * Call `clear()` first, if the elements outlive the container and should be inserted somewhere else.
+     *
+     * An element can only be in one heap per hook and may not be moved or destroyed while it is linked.
+     * Elements may not change their priority while they are linked: erase, change and push them again.
+     *
+     * @tparam T The type of the elements
+     * @tparam hook Pointer to the `fiber::PairingHeapHook<T>` member of `T`
+     * @tparam LessPriority A comparator for `const T*`
+     */
+    template<class T, PairingHeapHook<T> T::* hook, class LessPriority>
+    class IntrusivePairingHeap{
+    private:
+        T* _root = nullptr;
+        std::size_t _size = 0;
+
+        static constexpr PairingHeapHook<T>& links(T* element){return element->*hook;}
+        static constexpr const PairingHeapHook<T>& links(const T* element){return element->*hook;}
+
+    public:
+        using value_type = T*;
+        using size_type = std::size_t;
+
+        /// @brief forward iterator that visits all elements in pre-order of the tree, not in the order of their priority
+        class const_iterator{
+        private:
+            T* _element = nullptr;
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T*;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T* const*;
+            using reference = T* const&;
+
+            constexpr const_iterator() = default;
+            constexpr explicit const_iterator(T* element) : _element(element){}
+
+            constexpr reference operator*() const {return this->_element;}
+
+            constexpr const_iterator& operator++(){
+                T* element = this->_element;
+                if(links(element).child != nullptr){
+                    this->_element = links(element).child;
+                    return *this;
+                }
+                // climb up until an element has a next sibling, the root has neither a parent nor siblings
+                while(element != nullptr && links(element).next == nullptr){
+                    element = parent(element);
+                }
+                this->_element = (element != nullptr) ? links(element).next : nullptr;
+                return *this;
+            }
+
+            constexpr const_iterator operator++(int){const_iterator result = *this; ++*this; return result;}
+            friend constexpr bool operator==(const const_iterator& lhs, const const_iterator& rhs){return lhs._element == rhs._element;}
+        };
+        using iterator = const_iterator;
+
+        constexpr IntrusivePairingHeap() = default;
+        IntrusivePairingHeap(const IntrusivePairingHeap&) = delete;
+        IntrusivePairingHeap& operator=(const IntrusivePairingHeap&) = delete;
+
+        constexpr const_iterator begin() const {return const_iterator(this->_root);}
+        constexpr const_iterator end() const {return const_iterator(nullptr);}
+
+        /// @brief returns the number of elements
+        constexpr size_type size() const {return this->_size;}
+
+        /// @brief returns `true` if the heap has no elements
+        constexpr bool empty() const {return this->_root == nullptr;}
+
+        /// @brief returns the element with the highest priority, the heap may not be empty
+        constexpr T* top() const {return this->_root;}
+
+        /// @brief returns `true` if the element is linked into any heap with this hook
+        static constexpr bool is_linked(const T* element){return links(element).owner != nullptr;}
+
+        /// @brief returns `true` if the element is linked into this heap, O(1)
+        constexpr bool contains(const T* element) const {return links(element).owner == this;}
+
+        /// @brief inserts the element in O(1), it may not be linked already
+        constexpr void push(T* element){
+            FIBER_ASSERT_O1_MSG(!is_linked(element), "The element is already linked into a heap!");
+            PairingHeapHook<T>& l = links(element);
+            l.child = nullptr;
+            l.next = nullptr;
+            l.prev = nullptr;
+            l.owner = this;
+            this->_root = (this->_root == nullptr) ? element : meld(this->_root, element);
+            ++this->_size;
+        }
+
+        /// @brief removes the top element, the heap may not be empty
+        constexpr void pop(){
+            T* root = this->_root;
+            this->_root = merge_pairs(links(root).child);
+            unlink(root);
+            --this->_size;
+        }
+
+        /// @brief removes and returns the top element, the heap may not be empty
+        constexpr T* top_pop(){
+            T* root = this->_root;
+            this->pop();
+            return root;
+        }
+
+        /// @brief removes the element from anywhere in the heap in O(log n) amortised, it has to be an element of this heap
+        constexpr void erase(T* element){
+            FIBER_ASSERT_O1_MSG(this->contains(element), "The element is not linked into this heap!");
+            if(element == this->_root){
+                this->pop();
+                return;
+            }
+            cut(element);
+            T* subtree = merge_pairs(links(element).child);
+            if(subtree != nullptr) this->_root = meld(this->_root, subtree);
+            unlink(element);
+            --this->_size;
+        }
+
+        /// @brief unlinks all elements
+        constexpr void clear(){
+            while(!this->empty()) this->pop();
+        }
+
+    private:
+        static constexpr void unlink(T* element){
+            PairingHeapHook<T>& l = links(element);
+            l.child = nullptr;
+            l.next = nullptr;
+            l.prev = nullptr;
+            l.owner = nullptr;
+        }
+
+        /// returns the parent of the element or `nullptr` for the root
+        static constexpr T* parent(T* element){
+            while(links(element).prev != nullptr){
+                T* prev = links(element).prev;
+                if(links(prev).child == element) return prev;
+                element = prev;
+            }
+            return nullptr;
+        }
+
+        /// links two roots without siblings, the one with the lower priority becomes the first child of the other
+        static constexpr T* meld(T* a, T* b){
+            if(LessPriority{}(a, b)){
+                T* tmp = a;
+                a = b;
+                b = tmp;
+            }
+            // a stays root, b becomes its first child
+            PairingHeapHook<T>& la = links(a);
+            PairingHeapHook<T>& lb = links(b);
+            lb.next = la.child;
+            lb.prev = a;
+            if(la.child != nullptr) links(la.child).prev = b;
+            la.child = b;
+            la.next = nullptr;
+            la.prev = nullptr;
+            return a;
+        }
+
+        /// removes the subtree of the element from its parent and siblings
+        static constexpr void cut(T* element){
+            PairingHeapHook<T>& l = links(element);
+            T* prev = l.prev;
+            if(links(prev).child == element){
+                links(prev).child = l.next;
+            }else{
+                links(prev).next = l.next;
+            }
+            if(l.next != nullptr) links(l.next).prev = prev;
+            l.next = nullptr;
+            l.prev = nullptr;
+        }
+
+        /// melds a list of siblings to one tree with the two-pass method, without recursion
+        static constexpr T* merge_pairs(T* first){
+            if(first == nullptr) return nullptr;
+
+            // first pass: meld pairs from left to right, chain the results in reverse order through `prev`
+            T* reversed = nullptr;
+            T* element = first;
+            while(element != nullptr){
+                T* a = element;
+                T* b = links(a).next;
+                T* rest = (b != nullptr) ? links(b).next : nullptr;
+                links(a).next = nullptr;
+                links(a).prev = nullptr;
+                T* pair = a;
+                if(b != nullptr){
+                    links(b).next = nullptr;
+                    links(b).prev = nullptr;
+                    pair = meld(a, b);
+                }
+                links(pair).prev = reversed;
+                reversed = pair;
+                element = rest;
+            }
+
+            // second pass: meld from right to left into one tree
+            T* result = reversed;
+            T* next = links(result).prev;
+            links(result).prev = nullptr;
+            while(next != nullptr){
+                T* tree = next;
+                next = links(tree).prev;
+                links(tree).prev = nullptr;
+                result = meld(result, tree);
+            }
+            return result;
+        }
+    };
+
+} // namespace fiber
@@ -2,131 +2,292 @@
 
 
 // std
-#include <cstddef> // size_type
-#include <algorithm> // swap
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 // fiber
-#include "ArrayList.hpp"
+#include <fiber/Exceptions/Exceptions.hpp>
 
 namespace fiber
 {
-    template<class T, size_type N, class greater_priority>
+    /**
+     * @brief A statically allocated priority queue that hands out stable handles to its elements
+     *
+     * Elements live in fixed slots and never move, the binary heap only orders slot indices.
+     * Every slot knows its position in the heap, so an element can be found through its handle in O(1)
+     * and changed or removed anywhere in the queue in O(log n):
+     *
+     * ```C++
+     * fiber::PriorityQueue<Job, 16, EarlierDeadline> queue;
+     * auto handle = queue.push(Job{...});
+     * queue[handle].deadline -= 5ms;  // change the priority ...
+     * queue.update(handle);           // ... and restore the order
+     * queue.erase(handle);            // or cancel it
+     * ```
+     *
+     * Handles carry a generation counter: a handle of a popped or erased element is never valid again,
+     * even if its slot is reused, which can be checked with `contains()`.
+     *
+     * The comparator follows the convention of `std::push_heap`: `less_priority(a, b)` returns `true`
+     * if `a` has a lower priority than `b`. The element with the highest priority is on the top.
+     *
+     * @tparam T The type of the elements
+     * @tparam N The capacity
+     * @tparam LessPriority A comparator for `const T&`
+     */
+    template<class T, std::size_t N, class LessPriority = std::less<T>>
     class PriorityQueue{
     public:
-        using comntainer_type = ArrayList<T, N>;
-    
+        using value_type = T;
+        using size_type = std::size_t;
+        using reference = T&;
+        using const_reference = const T&;
+
+        /// @brief refers to an element of a `fiber::PriorityQueue`, stays the same while the element is in the queue
+        class Handle{
+        private:
+            friend class PriorityQueue;
+            size_type _slot = std::numeric_limits<size_type>::max();
+            uint32_t _generation = 0;
+
+            constexpr Handle(size_type slot, uint32_t generation) : _slot(slot), _generation(generation){}
+
+        public:
+            /// @brief constructs a handle that refers to no element
+            constexpr Handle() = default;
+
+            /// @brief returns the slot of the element, which is in `[0, N)` for valid handles
+            constexpr size_type slot() const {return this->_slot;}
+
+            friend constexpr bool operator==(const Handle& lhs, const Handle& rhs) = default;
+        };
+
     private:
-        bool (*_greater_priority)(const T& lhs, const T& rhs);
-        ArrayList<T, N> _buffer;
+        alignas(T) std::byte _values[N * sizeof(T)];
+        size_type _heap[N];         // slots in heap order
+        size_type _position[N];     // position of a slot in `_heap`, or the next free slot for free slots
+        uint32_t _generation[N];    // odd if the slot holds an element
+        size_type _size = 0;
+        size_type _used_slots = 0;  // slots `[_used_slots, N)` have never been used
+        size_type _free = N;        // first slot of the list of free slots
+        [[no_unique_address]] LessPriority _less_priority;
 
     public:
 
-        using value_type = comntainer_type::value_type;
-        using size_type = comntainer_type::size_type;
-        using reference = comntainer_type::reference;
-        using const_reference = comntainer_type::const_reference;
-        using iterator = comntainer_type::iterator;
-        using const_iterator = comntainer_type::const_iterator;
-
         constexpr PriorityQueue() = default;
-        constexpr PriorityQueue(const PriorityQueue&) = default;
-        constexpr PriorityQueue& operator=(const PriorityQueue&) = default;
-        
-        /// @brief returns the size/count of live elements in the container 
-        constexpr size_type size() const {return this->_buffer.size();}
+        constexpr explicit PriorityQueue(const LessPriority& less_priority) : _less_priority(less_priority){}
+
+        PriorityQueue(const PriorityQueue&) = delete;
+        PriorityQueue& operator=(const PriorityQueue&) = delete;
+
+        ~PriorityQueue(){this->clear();}
+
+        /// @brief returns the size/count of live elements in the container
+        constexpr size_type size() const {return this->_size;}
 
         /// @brief returns the capacity of the container. Since this is a statically allocated container this is also the maximal size.
-        constexpr size_type capacity() const {return this->_buffer.capacity();}
+        constexpr size_type capacity() const {return N;}
 
-        /// @brief returns the maximal number of elements that can be stored in the container 
-        constexpr size_type max_size() const {return this->_buffer.max_size();}
+        /// @brief returns the maximal number of elements that can be stored in the container
+        constexpr size_type max_size() const {return N;}
 
-        /// @brief returns the reserve - number of elements that can be stored until the container is full 
-        constexpr size_type reserve() const {return this->_buffer.reserve();}
+        /// @brief returns the reserve - number of elements that can be stored until the container is full
+        constexpr size_type reserve() const {return N - this->_size;}
 
-        /// @brief returns true if there are not elements in the container, aka. the container is empty. 
-        constexpr bool empty() const {return this->_buffer.empty();}
+        /// @brief returns true if there are not elements in the container, aka. the container is empty.
+        constexpr bool empty() const {return this->_size == 0;}
 
-        /// @brief returns true if the container is full and no more elements can be stored in the container 
-        constexpr bool full() const {return this->_buffer.full();}
+        /// @brief returns true if the container is full and no more elements can be stored in the container
+        constexpr bool full() const {return this->_size == N;}
 
-        /// @brief returns a reference to the element with the top most priority 
-        constexpr reference top() {return this->_buffer.front();}
+        /// @brief returns `true` if the handle refers to an element of this queue
+        constexpr bool contains(Handle handle) const {
+            return handle._slot < this->_used_slots && this->_generation[handle._slot] == handle._generation;
+        }
 
-        /// @brief returns a reference to the element with the top most priority 
-        constexpr const_reference top() const {return this->_buffer.front();}
+        /// @brief returns a reference to the element with the top most priority
+        reference top() {
+            FIBER_ASSERT_O1(!this->empty());
+            return this->value(this->_heap[0]);
+        }
 
+        /// @brief returns a reference to the element with the top most priority
+        const_reference top() const {
+            FIBER_ASSERT_O1(!this->empty());
+            return this->value(this->_heap[0]);
+        }
+
+        /// @brief returns the handle of the element with the top most priority
+        Handle top_handle() const {
+            FIBER_ASSERT_O1(!this->empty());
+            return this->handle(this->_heap[0]);
+        }
+
+        /**
+         * @brief returns the element of the handle
+         *
+         * The element may be changed in place, but changes of its priority have to be followed by `update()`.
+         */
+        reference operator[](Handle handle) {
+            FIBER_ASSERT_O1_MSG(this->contains(handle), "The handle does not refer to an element of this queue!");
+            return this->value(handle._slot);
+        }
+
+        /// @brief returns the element of the handle
+        const_reference operator[](Handle handle) const {
+            FIBER_ASSERT_O1_MSG(this->contains(handle), "The handle does not refer to an element of this queue!");
+            return this->value(handle._slot);
+        }
+
+        /// @brief constructs an element in place and returns its handle, O(log n)
         template<class... Args>
-        inline reference emplace(Args&&... args){
-            this->_buffer.emplace_back(std::forward<Args>(args)...);
-            return this->sort_up(this->size() - 1);
+        Handle emplace(Args&&... args){
+            FIBER_ASSERT_O1_MSG(!this->full(), "The priority queue is full!");
+            const size_type slot = this->allocate_slot();
+            std::construct_at(&this->value(slot), std::forward<Args>(args)...);
+            const size_type position = this->_size++;
+            this->_heap[position] = slot;
+            this->_position[slot] = position;
+            this->sift_up(position);
+            return this->handle(slot);
         }
 
+        /// @brief inserts a copy of the value and returns its handle, O(log n)
+        Handle push(const T& value){return this->emplace(value);}
+
+        /// @brief inserts the value and returns its handle, O(log n)
+        Handle push(T&& value){return this->emplace(std::move(value));}
+
+        /// @brief removes the element with the top most priority, O(log n)
         void pop(){
-            size_type parent_idx = 0;
-            size_type max_child = this->max_child(parent_idx);
-
-            // overwrite the first element with the last one and destroy it
-            this->_buffer.front() = std::move(this->_buffer.back());
-            this->_buffer.pop_back();
-
-            // swap all parents with the higher priority child
-            while(max_child < this->size()){
-                // swap child with parent
-                std::swap(this->_buffer[parent_idx], this->_buffer[max_child]);
-        
-                // calculate next chil
-                parent_idx = max_child;
-                max_child = this->max_child(max_child);
-            }
+            FIBER_ASSERT_O1(!this->empty());
+            this->remove_at(0);
         }
 
-        inline value_type top_pop{
-            value_type value = std::move(this->top());
-            this->pop();
-            return value;
+        /// @brief removes and returns the element with the top most priority, O(log n)
+        value_type top_pop(){
+            FIBER_ASSERT_O1(!this->empty());
+            value_type result = std::move(this->top());
+            this->remove_at(0);
+            return result;
+        }
+
+        /// @brief restores the order after the priority of the element has been changed through `operator[]`, O(log n)
+        void update(Handle handle){
+            FIBER_ASSERT_O1_MSG(this->contains(handle), "The handle does not refer to an element of this queue!");
+            this->restore(this->_position[handle._slot]);
+        }
+
+        /// @brief assigns a new value to the element and restores the order, O(log n)
+        template<class U>
+        void update(Handle handle, U&& value){
+            FIBER_ASSERT_O1_MSG(this->contains(handle), "The handle does not refer to an element of this queue!");
+            this->value(handle._slot) = std::forward<U>(value);
+            this->restore(this->_position[handle._slot]);
+        }
+
+        /// @brief removes the element of the handle from anywhere in the queue, O(log n)
+        void erase(Handle handle){
+            FIBER_ASSERT_O1_MSG(this->contains(handle), "The handle does not refer to an element of this queue!");
+            this->remove_at(this->_position[handle._slot]);
+        }
+
+        /// @brief destroys all elements, all handles become invalid
+        void clear(){
+            while(!this->empty()) this->remove_at(this->_size - 1);
         }
 
     private:
 
+        [[nodiscard]] static constexpr size_type parent(size_type i){return (i - 1) / 2;}
         [[nodiscard]] static constexpr size_type left_child(size_type i){return i * 2 + 1;}
-        [[nodiscard]] static constexpr size_type right_child(size_type i){return i * 2 + 2;}
-        [[nodiscard]] static constexpr size_type parent(size_type i){return (i-1) / 2;}
-
-        [[nodiscard]] size_type max_child(const size_type parent_idx){
-            const size_type left_idx = left_child(parent_idx);
-            if(left_idx >= this->size()) return left_idx;
-            const size_type right_idx = right_child(parent_idx);
-            if(right_idx >= this->size()) return left_idx;
-            if(greater_priority(this->_buffer[left_idx], this->_buffer[right_idx])){
-                return left_idx;
+
+        T& value(size_type slot){return *std::launder(reinterpret_cast<T*>(this->_values + slot * sizeof(T)));}
+        const T& value(size_type slot) const {return *std::launder(reinterpret_cast<const T*>(this->_values + slot * sizeof(T)));}
+
+        Handle handle(size_type slot) const {return Handle(slot, this->_generation[slot]);}
+
+        bool less_priority(size_type slot_a, size_type slot_b) const {
+            return this->_less_priority(this->value(slot_a), this->value(slot_b));
+        }
+
+        /// takes a slot from the free list or one that has never been used, and marks it as occupied
+        size_type allocate_slot(){
+            size_type slot;
+            if(this->_free != N){
+                slot = this->_free;
+                this->_free = this->_position[slot];
             }else{
-                return right_idx;
+                slot = this->_used_slots++;
+                this->_generation[slot] = 0;
             }
+            ++this->_generation[slot];
+            return slot;
         }
 
-        /// @brief Sorts the element given by the index upwards and swaps it with its parent if it has a greater priority
-        /// @param idx the indes to the element in the list
-        /// @return the reference to the sorted element after the sort
-        reference sort_up(size_type idx){
+        void free_slot(size_type slot){
+            ++this->_generation[slot];
+            this->_position[slot] = this->_free;
+            this->_free = slot;
+        }
 
-            // get its parent index
-            size_type parent_idx = parent(idx);
+        /// destroys the element at the heap position and fills the gap with the last element
+        void remove_at(size_type position){
+            const size_type slot = this->_heap[position];
+            const size_type last = --this->_size;
+            if(position != last){
+                this->_heap[position] = this->_heap[last];
+                this->_position[this->_heap[position]] = position;
+                this->restore(position);
+            }
+            std::destroy_at(&this->value(slot));
+            this->free_slot(slot);
+        }
 
-            // iterate until top element is reached and as long as idx has a greater priority than its parent
-            while((idx != 0) && greater_priority(idx, parent_idx)){
-                // switch if it has a greater priority than the parend
-                std::swap(this->_buffer[idx], this->_buffer[parent_idx]);
+        /// moves the element at the position up or down, whichever direction its priority requires
+        void restore(size_type position){
+            if(position > 0 && this->less_priority(this->_heap[parent(position)], this->_heap[position])){
+                this->sift_up(position);
+            }else{
+                this->sift_down(position);
+            }
+        }
 
-                // assign new indices
-                idx = parent_idx;
-                parent_idx = parent(idx);
+        void sift_up(size_type position){
+            const size_type slot = this->_heap[position];
+            while(position > 0){
+                const size_type parent_position = parent(position);
+                const size_type parent_slot = this->_heap[parent_position];
+                if(!this->less_priority(parent_slot, slot)) break;
+                this->_heap[position] = parent_slot;
+                this->_position[parent_slot] = position;
+                position = parent_position;
             }
-            return this->_buffer.at(idx);
+            this->_heap[position] = slot;
+            this->_position[slot] = position;
         }
 
+        void sift_down(size_type position){
+            const size_type slot = this->_heap[position];
+            while(true){
+                size_type child = left_child(position);
+                if(child >= this->_size) break;
+                if(child + 1 < this->_size && this->less_priority(this->_heap[child], this->_heap[child + 1])) ++child;
+                const size_type child_slot = this->_heap[child];
+                if(!this->less_priority(slot, child_slot)) break;
+                this->_heap[position] = child_slot;
+                this->_position[child_slot] = position;
+                position = child;
+            }
+            this->_heap[position] = slot;
+            this->_position[slot] = position;
+        }
+    };
 
-        
-    }
 } // namespace fiber
-
@@ -0,0 +1,758 @@
+#pragma once
+
+// std
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+// fiber
+#include <fiber/Containers/ArrayList.hpp>
+#include <fiber/Core/functional.hpp>
+#include <fiber/Exceptions/Exceptions.hpp>
+#include <fiber/OStream/OStream.hpp>
+
+namespace fiber
+{
+
+    /**
+     * @brief An array list that stores up to `N` elements inline and spills into a memory resource when it grows beyond
+     *
+     * Has the same interface as `fiber::ArrayList`, but does not fail when it is full: the next insertion moves
+     * all elements into a larger buffer from the memory resource, which doubles the capacity.
+     * So `N` can be sized for the typical case and rare bursts still succeed, for example with a shared
+     * `fiber::StaticLinearAllocator` as the resource:
+     *
+     * ```C++
+     * fiber::StaticLinearAllocator<1024> burst_memory;
+     * fiber::SmallArrayList<Message, 4> inbox(&burst_memory);
+     * ```
+     *
+     * The elements stay in the memory resource until the list is destroyed or `shrink_to_fit()` moves them back inline.
+     * Growing, `shrink_to_fit()` and moving an inline list invalidate iterators and references.
+     * Copies and moved-to lists use the memory resource of the list they come from.
+     *
+     * Without a memory resource the list never touches the heap: it uses `std::pmr::null_memory_resource()`
+     * and growing beyond `N` is asserted. Pass `std::pmr::get_default_resource()` explicitly to spill into the global heap.
+     *
+     * @tparam T type of the data elements
+     * @tparam N number of elements that are stored inline, without the memory resource
+     */
+    template<class T, std::size_t N>
+    class SmallArrayList{
+        static_assert(N > 0, "A SmallArrayList needs at least one inline element, use a std::pmr::vector otherwise");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using pointer = T*;
+        using const_pointer = const T*;
+
+    private:
+        alignas(T) std::byte _buffer[N * sizeof(T)];
+        T* _data = reinterpret_cast<T*>(this->_buffer);
+        size_type _size = 0;
+        size_type _capacity = N;
+        std::pmr::memory_resource* _resource;
+
+    public:
+
+        /// @brief constructs an empty list that spills into `resource`, or cannot grow beyond `N` without one
+        explicit SmallArrayList(std::pmr::memory_resource* resource = std::pmr::null_memory_resource()) : _resource(resource){}
+
+        /// @brief copy constructor, uses the memory resource of `other`
+        SmallArrayList(const SmallArrayList& other) : _resource(other._resource){this->append(other);}
+
+        /// @brief move constructor, takes over the buffer of `other` if it has spilled and uses its memory resource
+        SmallArrayList(SmallArrayList&& other) : _resource(other._resource){this->take(std::move(other));}
+
+        /// @brief copy assignment, keeps the memory resource of this list
+        SmallArrayList& operator=(const SmallArrayList& other){
+            if(this != &other) this->assign(other);
+            return *this;
+        }
+
+        /// @brief move assignment, takes over the buffer of `other` if it has spilled into the same memory resource
+        SmallArrayList& operator=(SmallArrayList&& other){
+            if(this != &other){
+                this->clear();
+                this->take(std::move(other));
+            }
+            return *this;
+        }
+
+        /// @brief constructs a copy of another list
+        template<std::convertible_to<T> Ta, size_t N1>
+        SmallArrayList(const SmallArrayList<Ta, N1>& other) : _resource(other.resource()){this->append(other);}
+
+        /// @brief copy assignment from another list
+        template<std::convertible_to<T> Ta, size_t N1>
+        SmallArrayList& operator=(const SmallArrayList<Ta, N1>& other){this->assign(other); return *this;}
+
+        /// @brief construct from an initialiser list
+        /// @param ilist initialiser list
+        /// @param resource the memory resource for elements beyond `N`
+        template<std::convertible_to<T> Ta>
+        inline SmallArrayList(std::initializer_list<Ta> ilist, std::pmr::memory_resource* resource = std::pmr::null_memory_resource()) : _resource(resource){this->append(ilist);}
+
+        /// @brief construct from an generic range that follows the concept `std::ranges::forward_range`
+        /// @tparam Range templated range class that follows the concept `std::ranges::forward_range`
+        /// @param range the range that should be assigned on construction
+        /// @param resource the memory resource for elements beyond `N`
+        template<std::ranges::forward_range Range>
+        inline SmallArrayList(const Range& range, std::pmr::memory_resource* resource = std::pmr::null_memory_resource()) : _resource(resource){this->append(range);}
+
+        /// @brief destructor, returns a spilled buffer to the memory resource
+        ~SmallArrayList(){
+            this->clear();
+            this->release();
+        }
+
+        /// @brief returns the memory resource that takes the elements beyond `N`
+        std::pmr::memory_resource* resource() const {return this->_resource;}
+
+        /// @brief returns `true` if the elements are stored inline and `false` if they have spilled into the memory resource
+        constexpr bool is_inline() const {return this->_data == this->inline_data();}
+
+        /// @brief returns the size/count of live elements in the container
+        constexpr size_type size() const {return this->_size;}
+
+        /// @brief returns the capacity of the current buffer, at least `N`
+        constexpr size_type capacity() const {return this->_capacity;}
+
+        /// @brief returns the number of elements that are stored inline
+        static constexpr size_type inline_capacity() {return N;}
+
+        /// @brief returns the maximal number of elements that can be stored in the container
+        static constexpr size_type max_size() {return std::numeric_limits<size_type>::max() / sizeof(T);}
+
+        /// @brief returns the reserve - number of elements that can be stored until the container has to grow
+        constexpr size_type reserve() const {return this->capacity() - this->size();}
+
+        /// @brief returns true if there are not elements in the container, aka. the container is empty.
+        constexpr bool empty() const {return this->size() == 0;}
+
+        /// @brief returns true if the current buffer is full and the next insertion grows the container
+        constexpr bool full() const {return this->size() == this->capacity();}
+
+        /// @brief grows the buffer, so that at least `capacity` elements fit without a further allocation
+        void ensure_capacity(const size_type capacity){
+            if(capacity > this->capacity()) this->reallocate(capacity);
+        }
+
+        /// @brief moves spilled elements back inline if they fit, otherwise into a buffer of the exact size
+        void shrink_to_fit(){
+            if(this->is_inline() || this->size() == this->capacity()) return;
+            this->reallocate(this->size());
+        }
+
+        /// @brief returns a pointer to the start of the container
+        constexpr pointer data() {return this->_data;}
+
+        /// @brief returns a const-pointer to the start of the container
+        constexpr const_pointer data() const {return this->_data;}
+
+        /// @brief returns a const-pointer to the start of the container
+        constexpr const_pointer cdata() const {return this->_data;}
+
+        /// @brief returns an iterator to the start
+        constexpr iterator begin() {return this->_data;}
+
+        /// @brief returns a const-iterator to the start
+        constexpr const_iterator begin() const {return this->_data;}
+
+        /// @brief returns a const-iterator to the start
+        constexpr const_iterator cbegin() const {return this->_data;}
+
+        /// @brief returns an iterator past the end
+        constexpr iterator end() {return this->begin() + this->size();}
+
+        /// @brief returns a const-iterator past the end
+        constexpr const_iterator end() const {return this->begin() + this->size();}
+
+        /// @brief returns a const-iterator past the end
+        constexpr const_iterator cend() const {return this->cbegin() + this->size();}
+
+        /// @brief returns a reference to the first element in the buffer
+        constexpr reference front() {
+            FIBER_ASSERT_O1(!this->empty());
+            return *this->begin();
+        }
+
+        /// @brief returns a const-reference to the first element int the buffer
+        constexpr const_reference front() const {
+            FIBER_ASSERT_O1(!this->empty());
+            return *this->cbegin();
+        }
+
+        /// @brief returns a reference to the last element in the buffer
+        constexpr reference back() {
+            FIBER_ASSERT_O1(!this->empty());
+            return *(this->end()-1);
+        }
+
+        /// @brief returns a const reference to the last element in the buffer
+        constexpr const_reference back() const {
+            FIBER_ASSERT_O1(!this->empty());
+            return *(this->cend()-1);
+        }
+
+        /**
+         * @brief returns a reference to the element at the given position
+         *
+         * For signed integer types, signed ones will wrap negatives around so -1 will access the last element
+         * Unsigned integer types will avoid the branch.
+         */
+        template<std::integral Int>
+        constexpr reference at(const Int i) {
+            if constexpr (std::is_unsigned_v<Int>){
+                FIBER_ASSERT_O1(fiber::less(i, this->size()));
+                return *(this->begin()+i);
+            }else{
+                FIBER_ASSERT_O1(fiber::less(i, this->size()));
+                FIBER_ASSERT_O1(fiber::less_equal(-i, this->size()));
+                return *(((i >= 0) ? this->begin() : this->end()) + i);
+            }
+        }
+
+        /// @overload
+        template<std::integral Int>
+        constexpr const_reference at(const Int i) const {
+            if constexpr (std::is_unsigned_v<Int>){
+                FIBER_ASSERT_O1(fiber::less(i, this->size()));
+                return *(this->begin()+i);
+            }else{
+                FIBER_ASSERT_O1(fiber::less(i, this->size()));
+                FIBER_ASSERT_O1(fiber::less_equal(-i, this->size()));
+                return *(((i >= 0) ? this->begin() : this->end()) + i);
+            }
+        }
+
+        /// @brief Masked indexing
+        /// @param mask the mask that selects which elements to get. `true` will be included, `false` excluded
+        /// @return A SmallArrayList with the same memory resource that contains all values where of this where mask is `true`
+        SmallArrayList<T, N> at(const SmallArrayList<bool, N>& mask) const {
+            SmallArrayList<T, N> result(this->resource());
+            auto thisItr = this->begin();
+            const auto thisEnd = this->end();
+            auto maskItr = mask.begin();
+            const auto maskEnd = mask.end();
+            for(; thisItr < thisEnd && maskItr < maskEnd; ++thisItr, (void)++maskItr){
+                if(*maskItr){
+                    result.emplace_back(*thisItr);
+                }
+            }
+            return result;
+        }
+
+        /// @brief Indices list indexing
+        /// @tparam Int a generic integer
+        /// @param indices a list of indices that should be extracted
+        /// @return a SmallArrayList with the same memory resource containing all the elements from this that are contained in the `indices`
+        template<std::integral Int>
+        SmallArrayList<T, N> at(const SmallArrayList<Int, N>& indices) const {
+            SmallArrayList<T, N> result(this->resource());
+            for(const Int& index : indices){
+                result.emplace_back(this->at(index));
+            }
+            return result;
+        }
+
+        /// @brief returns a reference to the element at the given position
+        template<std::integral Int>
+        constexpr reference operator[](const Int i){return this->at(i);}
+
+        /// @brief returns a reference to the element at the given position
+        template<std::integral Int>
+        constexpr const_reference operator[](const Int i) const {return this->at(i);}
+
+        /// @brief accesses all elements where `mask` is `true`
+        SmallArrayList<T, N> operator[](const SmallArrayList<bool, N>& mask) const {return this->at(mask);}
+
+        /// @brief accesses all elements at the given `indices`
+        template<std::integral Int>
+        SmallArrayList<T, N> operator[](const SmallArrayList<Int, N>& indices) const {return this->at(indices);}
+
+        /// @brief emplaces (aka. pushes) an element to the back of the list
+        /// @details Actually constructs an element in place. If the list is full it grows first,
+        /// the arguments may refer to elements of the list.
+        /// @tparam ...Args list of parameters that correspond to a constructor of the value type of the list
+        /// @param ...args list of arguments to construct a value of the list
+        /// @return a reference to the constructed list element
+        template<class... Args>
+        T& emplace_back(Args&&... args){
+            if(this->full()){
+                // construct the new element before the old ones are moved, the arguments may refer to them
+                const size_type capacity = this->next_capacity(this->size() + 1);
+                T* data = this->allocate(capacity);
+                std::construct_at(data + this->size(), std::forward<Args>(args)...);
+                this->replace_buffer(data, capacity);
+            }else{
+                std::construct_at(this->end(), std::forward<Args>(args)...);
+            }
+            ++this->_size;
+            return this->back();
+        }
+
+        /// @brief appends `count` many default initialised elements
+        /// @details Trivial types like `char` are left uninitialised, so the new elements can be the target of a block copy.
+        /// @return an iterator to the first appended element
+        iterator append_default(const size_type count){
+            const iterator first = this->fill_gap(this->size(), count, [count](T* gap){
+                if constexpr (!std::is_trivially_default_constructible_v<T>){
+                    for(T* itr = gap; itr != gap + count; ++itr) new (itr) T;
+                }
+            });
+            this->_size += count;
+            return first;
+        }
+
+        /// @brief clears the list - destructs all members if necessary and sets the size to zero
+        /// @details A spilled buffer is kept, call `shrink_to_fit()` to return it to the memory resource.
+        void clear(){
+            std::destroy(this->begin(), this->end());
+            this->_size = 0;
+        }
+
+        /// @brief appends `value` `count` many times
+        /// @param count how often `value` should be emplaced_back()
+        /// @param value the value to be created
+        inline void append(const size_type count, const T& value){
+            for(size_type i = 0; i < count; ++i) this->emplace_back(value);
+        }
+
+        /// @brief clears the list and assigns the `value` `count` many times to the list.
+        inline void assign(const size_type count, const T& value){
+            this->clear();
+            this->append(count, value);
+        }
+
+        /// @brief appends a range defined by foreward iterators using the closed-open principle [first, last)
+        template<std::forward_iterator Itr>
+        requires std::convertible_to<typename std::iterator_traits<Itr>::value_type, T>
+        inline void append(Itr first, Itr last){
+            this->insert(this->end(), first, last);
+        }
+
+        /// @brief assigns a range defined by foreward iterators using the closed-open principle [first, last). After the assignment the list has the size of the assigned range
+        template<std::forward_iterator Itr>
+        requires std::convertible_to<typename std::iterator_traits<Itr>::value_type, T>
+        inline void assign(Itr first, Itr last){
+            this->clear();
+            this->append(first, last);
+        }
+
+        /// @brief appens an initilizer_list
+        template<std::convertible_to<T> Ta>
+        inline void append(std::initializer_list<Ta> ilist){
+            this->append(ilist.begin(), ilist.end());
+        }
+
+        /// @brief assigns an initializer_list
+        template<std::convertible_to<T> Ta>
+        inline void assign(std::initializer_list<Ta> ilist){
+            this->clear();
+            this->append(ilist);
+        }
+
+        /// @brief Appends the content of a range
+        template<std::ranges::forward_range Range>
+        inline void append(const Range& range){
+            this->append(range.begin(), range.end());
+        }
+
+        /// @brief Assigns the content of a range
+        template<std::ranges::forward_range Range>
+        inline void assign(const Range& range){
+            this->clear();
+            this->append(range);
+        }
+
+        /// @brief turns the passed position given by an iterator into an integer
+        constexpr size_type to_index(const const_iterator pos) const {
+            FIBER_ASSERT_O1(this->begin() <= pos && pos <= this->end());
+            return pos - this->begin();
+        }
+
+        /// @brief turns the passed unsigned integer into an iterator pointing to the same position
+        template<std::integral Int>
+        constexpr iterator to_iterator(const Int pos){
+            if constexpr (std::is_unsigned_v<Int>){
+                FIBER_ASSERT_O1(fiber::less_equal(pos, this->size()));
+                return this->begin() + pos;
+            }else{
+                FIBER_ASSERT_O1(fiber::less_equal(pos, this->size()));
+                FIBER_ASSERT_O1(fiber::less_equal(-pos, this->size()));
+                return ((pos >= 0) ? this->begin() : this->end()) + pos;
+            }
+        }
+
+        /// @brief turns the passed unsigned integer into a cosnt_iterator pointing to the same position
+        template<std::integral Int>
+        constexpr const_iterator to_iterator(const Int pos) const {
+            if constexpr (std::is_unsigned_v<Int>){
+                FIBER_ASSERT_O1(fiber::less_equal(pos, this->size()));
+                return this->begin() + pos;
+            }else{
+                FIBER_ASSERT_O1(fiber::less_equal(pos, this->size()));
+                FIBER_ASSERT_O1(fiber::less_equal(-pos, this->size()));
+                return ((pos >= 0) ? this->begin() : this->end()) + pos;
+            }
+        }
+
+        /// @brief turns the passed unsigned integer into a cosnt_iterator pointing to the same position
+        template<std::integral Int>
+        constexpr const_iterator to_const_iterator(const Int pos) const {
+            return this->to_iterator(pos);
+        }
+
+        /// @brief removes the constnes of an iterator if the user has access to the mutable (un-const) container
+        constexpr iterator unconst(const const_iterator pos) {
+            FIBER_ASSERT_O1(this->begin() <= pos);
+            FIBER_ASSERT_O1(pos <= this->end());
+            return this->begin() + this->to_index(pos);
+        }
+
+        /// @brief Inserts a value
+        /// @tparam Ta A type that is convertible to the `value_type` of the list
+        /// @param pos the position at which the value should be inserted
+        /// @param value the value that the element at that position should have after the insertion
+        /// @return an iterator pointing to the inserted value
+        template<std::convertible_to<T> Ta>
+        iterator insert(const const_iterator pos, const Ta& value){
+            return this->insert(pos, T(value));
+        }
+
+        /// @brief Inserts a value
+        /// @param pos the position at which the value should be inserted
+        /// @param value the value that the element at that position should have after the insertion
+        /// @return an iterator pointing to the inserted value
+        template<std::convertible_to<T> Ta>
+        iterator insert(const const_iterator pos, Ta&& value){
+            T element(std::forward<Ta>(value)); // the value may be an element of this list
+            const iterator pos_ = this->fill_gap(this->to_index(pos), 1, [&element](T* gap){
+                std::construct_at(gap, std::move(element));
+            });
+            ++this->_size;
+            return pos_;
+        }
+
+        /// @brief inserts a range at a given position
+        /// @tparam Itr a generic iterator that follows the concept std::forward_iterator
+        /// @param pos the position at which should be inserted given by an iterator
+        /// @param first the start of the range that should be inserted
+        /// @param last the past the end iterator to which should be inserted
+        /// @return an iterator to the start of the start of the insertion
+        template<std::forward_iterator Itr>
+        requires std::convertible_to<typename std::iterator_traits<Itr>::value_type, T>
+        iterator insert(const const_iterator pos, Itr first, Itr last){
+            const size_type dist = static_cast<size_type>(std::distance(first, last));
+            // the range may be part of this list, it is copied before a grown list releases its old buffer
+            const iterator pos_ = this->fill_gap(this->to_index(pos), dist, [&first, &last](T* gap){
+                detail::uninitialized_copy(first, last, gap);
+            });
+            this->_size += dist;
+            return pos_;
+        }
+
+        /// @brief inserts a range at the given position
+        /// @tparam Range a generic range that follows the concept `std::ranges::forward_range`
+        /// @param pos the insertion point
+        /// @param range the range that should be inserted
+        /// @return an iterator to the inserted range
+        template<std::ranges::forward_range Range>
+        inline iterator insert(const const_iterator pos, const Range& range){
+            return this->insert(pos, range.begin(), range.end());
+        }
+
+        /// @brief inserts the `value` at the `pos`ition passed as an integer that wraps if it is a signed type
+        template<std::integral Int, std::convertible_to<T> Ta>
+        inline iterator insert(const Int index, Ta&& value){
+            return this->insert(this->insert_position(index), std::forward<Ta>(value));
+        }
+
+        /// @brief inserts the `range` at the `pos`ition passed as an integer that wraps if it is a signed type
+        template<std::integral Int, std::ranges::forward_range Range>
+        inline iterator insert(const Int index, const Range& range){
+            return this->insert(this->insert_position(index), range);
+        }
+
+        /// @brief inserts the closed-open [`first`, `last`) range at the given `pos`ition
+        template<std::integral Int, std::forward_iterator Itr>
+        requires std::convertible_to<typename std::iterator_traits<Itr>::value_type, T>
+        inline iterator insert(const Int index, Itr first, Itr last){
+            return this->insert(this->insert_position(index), first, last);
+        }
+
+        /// @brief erases/removes the element at the position pointed to by `cpos`
+        /// @returns an iterator the element after the removed one
+        iterator erase(const_iterator cpos){
+            FIBER_ASSERT_O1(!this->empty());
+            iterator pos = this->unconst(cpos);
+            std::destroy_at(pos);
+            detail::relocate(pos, pos + 1, static_cast<size_type>(this->end() - pos - 1));
+            --this->_size;
+            return pos;
+        }
+
+        /// @brief erases/removes the element at the position pointed to by `cpos`
+        /// @returns an iterator the element after the removed one
+        template<class Int> requires std::is_integral_v<Int>
+        inline iterator erase(const Int pos){
+            return this->erase(this->to_iterator(pos));
+        }
+
+        /// @brief erases/removes the range given by the closed-open iterators [first, last)
+        /// @returns an iterator the element after the removed ones
+        iterator erase(const_iterator first, const_iterator last){
+            FIBER_ASSERT_O1(first <= last);
+            iterator first_ = this->unconst(first);
+            iterator last_ = this->unconst(last);
+            std::destroy(first_, last_);
+            detail::relocate(first_, last_, static_cast<size_type>(this->end() - last_));
+            this->_size -= static_cast<size_type>(last_ - first_);
+            return first_;
+        }
+
+        /// @brief erases/removes the range given by the closed-open indices [first, last)
+        /// @returns an iterator the element after the removed ones
+        template<class Int> requires std::is_integral_v<Int>
+        iterator erase(Int first, Int last){return this->erase(this->to_iterator(first), this->to_iterator(last));}
+
+        /// @brief erases elements from the list if they satisfy the callable
+        /// @tparam Callable Object that can be called like `bool f(const T&)` or `bool f(T)`.
+        /// @param f Condition that returns `true` if that element should be erased from the list.
+        template<class Callable>
+        std::size_t erase_if(Callable&& f){
+            const size_type new_size = detail::erase_if<1>(this->data(), this->size(), std::forward<Callable>(f));
+            const size_type n_erased = this->size() - new_size;
+            this->_size = new_size;
+            return n_erased;
+        }
+
+        /// @brief removes and destructs the last element
+        void pop_back(){
+            FIBER_ASSERT_O1(!this->empty());
+            std::destroy_at(&this->back());
+            --this->_size;
+        }
+
+        /// @brief Applies the negation (!) operator to all elements and returns it as a bool list with the same memory resource
+        SmallArrayList<bool, N> operator!() const {
+            SmallArrayList<bool, N> result(this->resource());
+            for(const auto& elem : *this){
+                result.emplace_back(!elem);
+            }
+            return result;
+        }
+
+        /// @brief Applies the function to each element of the list in-place
+        /// @param function the function being applied to change/transform each element
+        template<class Function>
+        constexpr void for_each(Function&& function){
+            for(auto& elem : *this){
+                elem = function(elem);
+            }
+        }
+
+    private:
+
+        T* inline_data() {return reinterpret_cast<T*>(this->_buffer);}
+        const T* inline_data() const {return reinterpret_cast<const T*>(this->_buffer);}
+
+        /// the capacity after growing to at least `required` elements: doubles, so appending is amortised O(1)
+        size_type next_capacity(const size_type required) const {
+            FIBER_ASSERT_O1_MSG(required <= max_size(), "The SmallArrayList cannot grow beyond max_size()!");
+            const size_type doubled = (this->capacity() <= max_size() / 2) ? this->capacity() * 2 : max_size();
+            return std::max(doubled, required);
+        }
+
+        /// returns inline storage if `capacity` fits, otherwise a buffer from the memory resource
+        T* allocate(const size_type capacity){
+            if(capacity <= N) return this->inline_data();
+            FIBER_ASSERT_CRITICAL_MSG(this->_resource != std::pmr::null_memory_resource(), "SmallArrayList: exceeded the inline capacity without a memory resource. S: Increase `N` or pass a memory resource to the constructor.");
+            return static_cast<T*>(this->_resource->allocate(capacity * sizeof(T), alignof(T)));
+        }
+
+        /// returns a spilled buffer to the memory resource
+        void release(){
+            if(!this->is_inline()) this->_resource->deallocate(this->_data, this->_capacity * sizeof(T), alignof(T));
+        }
+
+        /// relocates all elements into `data`, frees the old buffer and makes `data` the current buffer
+        void replace_buffer(T* data, const size_type capacity){
+            if(data != this->_data){
+                detail::relocate(data, this->_data, this->size());
+                this->release();
+            }
+            this->_data = data;
+            this->_capacity = capacity;
+        }
+
+        /// moves the elements into a buffer with room for `capacity` elements, inline if they fit
+        void reallocate(const size_type capacity){
+            this->replace_buffer(this->allocate(std::max(capacity, N)), std::max(capacity, N));
+        }
+
+        /**
+         * makes room for `count` elements at `index` and calls `fill(gap)` to construct them, does not change the size
+         *
+         * If the list has to grow, the gap is filled before the old buffer is released, so `fill` may read elements
+         * of the list, and the elements before and after the gap are relocated directly to their new place.
+         * @returns a pointer to the gap
+         */
+        template<class Fill>
+        T* fill_gap(const size_type index, const size_type count, Fill&& fill){
+            const size_type tail = this->size() - index;
+            if(count <= this->reserve()){
+                T* gap = this->begin() + index;
+                detail::relocate(gap + count, gap, tail);
+                fill(gap);
+                return gap;
+            }
+            const size_type capacity = this->next_capacity(this->size() + count);
+            T* data = this->allocate(capacity);
+            fill(data + index);
+            detail::relocate(data + index + count, this->_data + index, tail);
+            detail::relocate(data, this->_data, index);
+            this->release();
+            this->_data = data;
+            this->_capacity = capacity;
+            return data + index;
+        }
+
+        template<std::integral Int>
+        const_iterator insert_position(const Int index) const {
+            if constexpr (std::is_unsigned_v<Int>){
+                return this->begin() + index;
+            }else{
+                return (index >= 0) ? (this->begin() + index) : (this->end() + index + 1);
+            }
+        }
+
+        /// moves the elements of `other` into this empty list, takes its buffer if it has spilled into an equal resource
+        void take(SmallArrayList&& other){
+            if(!other.is_inline() && *other._resource == *this->_resource){
+                this->release();
+                this->_data = other._data;
+                this->_size = other._size;
+                this->_capacity = other._capacity;
+                other._data = other.inline_data();
+                other._size = 0;
+                other._capacity = N;
+            }else{
+                this->ensure_capacity(other.size());
+                detail::relocate(this->_data, other._data, other.size());
+                this->_size = other._size;
+                other._size = 0;
+            }
+        }
+    };
+
+    template<class T, std::size_t N, class Function>
+    auto for_each(const SmallArrayList<T, N>& list, Function&& function){
+        using R = decltype(function(std::declval<T>()));
+        SmallArrayList<R, N> result(list.resource());
+        for(const T& elem : list){
+            result.emplace_back(function(elem));
+        }
+        return result;
+    }
+
+    // --------------------------------------------------------------------------------------
+    //                              Formated stream outpuot
+    // --------------------------------------------------------------------------------------
+
+    /// @brief prints the small array list to the output stream
+    template<class T, std::size_t N>
+    OStream& operator<<(OStream& stream, const SmallArrayList<T, N>& array){
+        stream << "[";
+        bool is_first = true;
+        for(const auto& elem : array){
+            if(is_first){
+                is_first = false;
+            }else{
+                stream << ", ";
+            }
+            stream << elem;
+        }
+        return stream << "]";
+    }
+
+    // ---------- comparison operators -----------
+
+    /// @brief returns `true` if both lists have the same size and equal elements
+    template<class T1, class T2, std::size_t N1, std::size_t N2>
+    inline bool operator==(const SmallArrayList<T1, N1>& lhs, const SmallArrayList<T2, N2>& rhs){
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](const T1& a, const T2& b){
+            if constexpr (std::integral<T1> && std::integral<T2>){
+                return fiber::equal(a, b); // compares signed and unsigned integers safely
+            }else{
+                return a == b;
+            }
+        });
+    }
+
+    /// @brief returns `true` if the lists differ in size or any element
+    template<class T1, class T2, std::size_t N1, std::size_t N2>
+    inline bool operator!=(const SmallArrayList<T1, N1>& lhs, const SmallArrayList<T2, N2>& rhs){
+        return !(lhs == rhs);
+    }
+
+    /// @brief returns the lexicographical less comparison of the left and right hand side
+    template<class T1, class T2, std::size_t N1, std::size_t N2>
+    inline bool operator<(const SmallArrayList<T1, N1>& lhs, const SmallArrayList<T2, N2>& rhs){
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), fiber::less<T1, T2>);
+    }
+
+    /// @brief returns the lexicographical greater comparison of the left and right hand side
+    template<class T1, class T2, std::size_t N1, std::size_t N2>
+    inline bool operator>(const SmallArrayList<T1, N1>& lhs, const SmallArrayList<T2, N2>& rhs){
+        return (rhs < lhs);
+    }
+
+    /// @brief returns the lexicographical less equal comparison of the left and right hand side
+    template<class T1, class T2, std::size_t N1, std::size_t N2>
+    inline bool operator<=(const SmallArrayList<T1, N1>& lhs, const SmallArrayList<T2, N2>& rhs){
+        return !(lhs > rhs);
+    }
+
+    /// @brief returns the lexicographical greater equal comparison of the left and right hand side
+    template<class T1, class T2, std::size_t N1, std::size_t N2>
+    inline bool operator>=(const SmallArrayList<T1, N1>& lhs, const SmallArrayList<T2, N2>& rhs){
+        return !(lhs < rhs);
+    }
+
+    // --------------- reduction operations ---------------
+
+    /// @brief returns `true` if any (aka. at least one) values from the `list` (converted to bool) are `true`
+    template<class T, std::size_t N1>
+    constexpr bool any(const SmallArrayList<T, N1>& list){
+        return std::any_of(list.begin(), list.end(), [](const T& elem){return static_cast<bool>(elem);});
+    }
+
+    /// @brief returns `true` if all values from the `list` (converted to bool) are `true`
+    template<class T, std::size_t N1>
+    constexpr bool all(const SmallArrayList<T, N1>& list){
+        return std::all_of(list.begin(), list.end(), [](const T& elem){return static_cast<bool>(elem);});
+    }
+
+    /// @brief returns `true` if no values from the `list` (converted to bool) are `true`
+    template<class T, std::size_t N1>
+    constexpr bool none(const SmallArrayList<T, N1>& list){
+        return std::none_of(list.begin(), list.end(), [](const T& elem){return static_cast<bool>(elem);});
+    }
+
+} // namespace fiber
@@ -0,0 +1,176 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace fiber
+{
+
+    /**
+     * @brief A lock-free ring buffer for one producer and one consumer, for example an interrupt and a task
+     *
+     * The producer only writes the head and the consumer only writes the tail, each publishes its side
+     * with a release store and reads the other side with an acquire load.
+     * No interrupt has to be disabled, so an ISR can push while a task pops at the same time,
+     * also if the ISR and the task run on different cores.
+     * Both counters run freely and are masked with `N - 1`, so all `N` slots can be used.
+     *
+     * The consumer task suspends until data is available without polling it in its own loop:
+     * ```C++
+     * fiber::SpscRing<uint8_t, 64> rx;
+     *
+     * void UART_IRQHandler(){
+     *     rx.try_push(UART->DR);
+     * }
+     *
+     * fiber::Coroutine<fiber::Exit> receive(){
+     *     while(true){
+     *         co_await rx.data_available();
+     *         while(auto byte = rx.try_pop()) parse(*byte);
+     *     }
+     * }
+     * ```
+     *
+     * Only one context may call the producer methods (`try_push`, `try_emplace`, `push`)
+     * and only one context may call the consumer methods (`try_pop`, `pop`, `front`).
+     *
+     * @tparam T The type of the elements
+     * @tparam N The capacity, has to be a power of two
+     */
+    template<class T, std::size_t N>
+    class SpscRing{
+        static_assert(std::has_single_bit(N), "The capacity of an SpscRing has to be a power of two");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        /// @brief awaitable that is ready once `count` elements can be popped (`data_available()`) or pushed (`space_available()`)
+        class Awaitable{
+        private:
+            const SpscRing* _ring;
+            size_type _count;
+            bool _space;
+
+        public:
+            constexpr Awaitable(const SpscRing* ring, size_type count, bool space) : _ring(ring), _count(count), _space(space){}
+
+            bool await_ready() const noexcept {
+                return (this->_space ? this->_ring->reserve() : this->_ring->size()) >= this->_count;
+            }
+
+            constexpr void await_resume() const noexcept {}
+        };
+
+    private:
+        static constexpr size_type _mask = N - 1;
+
+        alignas(T) std::byte _buffer[N * sizeof(T)];
+        std::atomic<size_type> _head = 0; // number of pushed elements, written by the producer
+        std::atomic<size_type> _tail = 0; // number of popped elements, written by the consumer
+
+        T* slot(size_type counter){return std::launder(reinterpret_cast<T*>(this->_buffer + (counter & _mask) * sizeof(T)));}
+
+    public:
+
+        constexpr SpscRing() = default;
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        ~SpscRing(){
+            while(this->try_pop()){}
+        }
+
+        /// @brief returns the number of elements, exact for the consumer and a lower bound for the producer
+        size_type size() const {
+            return this->_head.load(std::memory_order_acquire) - this->_tail.load(std::memory_order_acquire);
+        }
+
+        /// @brief returns the number of free slots, exact for the producer and a lower bound for the consumer
+        size_type reserve() const {return N - this->size();}
+
+        /// @brief returns the capacity of the container
+        static constexpr size_type capacity() {return N;}
+
+        /// @brief returns true if there are no elements
+        bool empty() const {return this->size() == 0;}
+
+        /// @brief returns true if all slots hold elements
+        bool full() const {return this->size() == N;}
+
+        /// @brief `co_await` suspends until at least `count` elements can be popped
+        Awaitable data_available(size_type count = 1) const {return Awaitable(this, count, false);}
+
+        /// @brief `co_await` suspends until at least `count` elements can be pushed
+        Awaitable space_available(size_type count = 1) const {return Awaitable(this, count, true);}
+
+        // ---- producer ----
+
+        /// @brief constructs an element at the back, returns `false` if the ring is full
+        template<class... Args>
+        bool try_emplace(Args&&... args){
+            const size_type head = this->_head.load(std::memory_order_relaxed);
+            if(head - this->_tail.load(std::memory_order_acquire) == N) return false;
+            std::construct_at(this->slot(head), std::forward<Args>(args)...);
+            this->_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// @brief copies the value to the back, returns `false` if the ring is full
+        bool try_push(const T& value){return this->try_emplace(value);}
+
+        /// @brief moves the value to the back, returns `false` if the ring is full
+        bool try_push(T&& value){return this->try_emplace(std::move(value));}
+
+        /// @brief copies up to `count` values to the back and publishes them at once, returns the number of copied values
+        size_type push(const T* values, size_type count){
+            const size_type head = this->_head.load(std::memory_order_relaxed);
+            const size_type free = N - (head - this->_tail.load(std::memory_order_acquire));
+            if(count > free) count = free;
+            for(size_type i = 0; i < count; ++i) std::construct_at(this->slot(head + i), values[i]);
+            this->_head.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+        // ---- consumer ----
+
+        /// @brief returns the front element or `nullptr` if the ring is empty, the element stays in the ring
+        T* front(){
+            const size_type tail = this->_tail.load(std::memory_order_relaxed);
+            if(this->_head.load(std::memory_order_acquire) == tail) return nullptr;
+            return this->slot(tail);
+        }
+
+        /// @brief removes and returns the front element, or an empty optional if the ring is empty
+        std::optional<T> try_pop(){
+            const size_type tail = this->_tail.load(std::memory_order_relaxed);
+            if(this->_head.load(std::memory_order_acquire) == tail) return std::nullopt;
+            T* element = this->slot(tail);
+            std::optional<T> result(std::move(*element));
+            std::destroy_at(element);
+            this->_tail.store(tail + 1, std::memory_order_release);
+            return result;
+        }
+
+        /// @brief moves up to `count` elements to `out` and frees their slots at once, returns the number of moved elements
+        size_type pop(T* out, size_type count){
+            const size_type tail = this->_tail.load(std::memory_order_relaxed);
+            const size_type available = this->_head.load(std::memory_order_acquire) - tail;
+            if(count > available) count = available;
+            for(size_type i = 0; i < count; ++i){
+                T* element = this->slot(tail + i);
+                out[i] = std::move(*element);
+                std::destroy_at(element);
+            }
+            this->_tail.store(tail + count, std::memory_order_release);
+            return count;
+        }
+    };
+
+} // namespace fiber
@@ -0,0 +1,379 @@
+#pragma once
+
+// std
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// fiber
+#include <fiber/Exceptions/Exceptions.hpp>
+
+namespace fiber
+{
+
+    /**
+     * @brief A statically allocated hash map with open addressing and Robin Hood probing
+     *
+     * All elements live in one array of `N` slots, nothing is allocated. A key is searched from its home slot
+     * onwards. Robin Hood probing keeps the elements of a cluster sorted by their home slot: an insertion moves
+     * elements that are closer to their home one slot further, and an erasure shifts the following elements
+     * back into the gap. So probe lengths stay short even at a high load and a search for a missing key
+     * stops as soon as it passes the place where the key would have to be.
+     *
+     * The home slot is taken from the upper bits of the hash times the golden ratio, so plain hashes like
+     * `std::hash<int>` or aligned pointers still spread over the whole table.
+     *
+     * The map looks up tasks by their id in O(1) instead of a linear scan:
+     * ```C++
+     * fiber::StaticHashMap<unsigned int, fiber::TaskBase*, 32> tasks;
+     * tasks.try_emplace(task.id(), &task);
+     * if(auto itr = tasks.find(id); itr != tasks.end()) scheduler.remove(itr->second);
+     * ```
+     *
+     * If both `Hash` and `KeyEqual` define `is_transparent`, `find()`, `contains()`, `at()` and `erase()` accept
+     * any type that they can hash and compare, for example a `std::string_view` for `std::string` keys,
+     * without constructing a key.
+     *
+     * The default constructor is `constexpr`, so a global map is constant initialised and needs no start up code.
+     * With a `constexpr` hash the whole map can be used in constant expressions.
+     *
+     * Erasing an element may move the elements behind it, which invalidates iterators and references to them.
+     *
+     * @tparam K The type of the keys
+     * @tparam V The type of the mapped values
+     * @tparam N The number of slots, has to be a power of two
+     * @tparam Hash The hash function for the keys
+     * @tparam KeyEqual The equality comparison for the keys
+     */
+    template<class K, class V, std::size_t N, class Hash = std::hash<K>, class KeyEqual = std::equal_to<K>>
+    class StaticHashMap{
+        static_assert(std::has_single_bit(N) && N >= 2, "The capacity of a StaticHashMap has to be a power of two and at least two");
+        static_assert(N <= 0xFFFF, "The probe distances of a StaticHashMap are stored in 16 bits");
+
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = std::pair<const K, V>;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+    private:
+        static constexpr bool _is_transparent = requires {
+            typename Hash::is_transparent;
+            typename KeyEqual::is_transparent;
+        };
+
+        /// the types that lookups accept: any type for transparent hashes and comparisons, otherwise only `K`
+        template<class Key>
+        static constexpr bool _is_lookup_key = _is_transparent || std::is_same_v<std::remove_cvref_t<Key>, K>;
+
+        /// a slot that may hold an element, the union keeps the storage usable in constant expressions
+        union Slot{
+            value_type value;
+
+            constexpr Slot(){}
+            constexpr ~Slot(){}
+        };
+
+        static constexpr size_type _mask = N - 1;
+        static constexpr unsigned int _shift = sizeof(size_type) * 8 - std::countr_zero(N);
+
+        Slot _slots[N];
+        uint16_t _distance[N] = {}; // 0 for empty slots, otherwise 1 + the distance of the element to its home slot
+        size_type _size = 0;
+        [[no_unique_address]] Hash _hash;
+        [[no_unique_address]] KeyEqual _key_equal;
+
+    public:
+
+        /// @brief forward iterator over the elements in slot order
+        template<bool is_const>
+        class Iterator{
+        private:
+            friend class StaticHashMap;
+            template<bool> friend class Iterator;
+            using Map = std::conditional_t<is_const, const StaticHashMap, StaticHashMap>;
+
+            Map* _map = nullptr;
+            size_type _slot = 0;
+
+            constexpr Iterator(Map* map, size_type slot) : _map(map), _slot(slot){this->skip_empty();}
+
+            constexpr void skip_empty(){
+                while(this->_slot < N && this->_map->_distance[this->_slot] == 0) ++this->_slot;
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = StaticHashMap::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<is_const, const value_type*, value_type*>;
+            using reference = std::conditional_t<is_const, const value_type&, value_type&>;
+
+            constexpr Iterator() = default;
+
+            /// @brief converts an iterator into a const iterator
+            template<bool other_is_const>
+                requires (is_const && !other_is_const)
+            constexpr Iterator(const Iterator<other_is_const>& other) : _map(other._map), _slot(other._slot){}
+
+            constexpr reference operator*() const {return this->_map->_slots[this->_slot].value;}
+            constexpr pointer operator->() const {return &this->_map->_slots[this->_slot].value;}
+
+            constexpr Iterator& operator++(){++this->_slot; this->skip_empty(); return *this;}
+            constexpr Iterator operator++(int){Iterator result = *this; ++*this; return result;}
+
+            friend constexpr bool operator==(const Iterator& lhs, const Iterator& rhs){return lhs._slot == rhs._slot;}
+        };
+
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        constexpr StaticHashMap() = default;
+        constexpr explicit StaticHashMap(const Hash& hash, const KeyEqual& key_equal = KeyEqual()) : _hash(hash), _key_equal(key_equal){}
+
+        StaticHashMap(const StaticHashMap&) = delete;
+        StaticHashMap& operator=(const StaticHashMap&) = delete;
+
+        constexpr ~StaticHashMap(){this->clear();}
+
+        constexpr iterator begin() {return iterator(this, 0);}
+        constexpr const_iterator begin() const {return const_iterator(this, 0);}
+        constexpr const_iterator cbegin() const {return const_iterator(this, 0);}
+
+        constexpr iterator end() {return iterator(this, N);}
+        constexpr const_iterator end() const {return const_iterator(this, N);}
+        constexpr const_iterator cend() const {return const_iterator(this, N);}
+
+        /// @brief returns the size/count of elements in the container
+        constexpr size_type size() const {return this->_size;}
+
+        /// @brief returns the capacity of the container. Since this is a statically allocated container this is also the maximal size.
+        static constexpr size_type capacity() {return N;}
+
+        /// @brief returns the maximal number of elements that can be stored in the container
+        static constexpr size_type max_size() {return N;}
+
+        /// @brief returns the reserve - number of elements that can be stored until the container is full
+        constexpr size_type reserve() const {return N - this->_size;}
+
+        /// @brief returns true if there are not elements in the container, aka. the container is empty.
+        constexpr bool empty() const {return this->_size == 0;}
+
+        /// @brief returns true if the container is full and no more elements can be stored in the container
+        constexpr bool full() const {return this->_size == N;}
+
+        /// @brief returns an iterator to the element with the key, or `end()`
+        template<class Key>
+            requires _is_lookup_key<Key>
+        constexpr iterator find(const Key& key){
+            const auto [slot, found] = this->search(key, this->_hash(key));
+            return found ? iterator(this, slot) : this->end();
+        }
+
+        /// @brief returns an iterator to the element with the key, or `end()`
+        template<class Key>
+            requires _is_lookup_key<Key>
+        constexpr const_iterator find(const Key& key) const {
+            const auto [slot, found] = this->search(key, this->_hash(key));
+            return found ? const_iterator(this, slot) : this->end();
+        }
+
+        /// @brief returns `true` if there is an element with the key
+        template<class Key>
+            requires _is_lookup_key<Key>
+        constexpr bool contains(const Key& key) const {return this->search(key, this->_hash(key)).second;}
+
+        /// @brief returns the value of the element with the key, which has to exist
+        template<class Key>
+            requires _is_lookup_key<Key>
+        constexpr V& at(const Key& key){
+            const auto [slot, found] = this->search(key, this->_hash(key));
+            FIBER_ASSERT_O1_MSG(found, "The key is not in the map!");
+            return this->_slots[slot].value.second;
+        }
+
+        /// @brief returns the value of the element with the key, which has to exist
+        template<class Key>
+            requires _is_lookup_key<Key>
+        constexpr const V& at(const Key& key) const {
+            const auto [slot, found] = this->search(key, this->_hash(key));
+            FIBER_ASSERT_O1_MSG(found, "The key is not in the map!");
+            return this->_slots[slot].value.second;
+        }
+
+        /**
+         * @brief constructs an element from the key and `args...` if the key is not in the map yet
+         *
+         * Nothing is constructed if the key exists already.
+         *
+         * @returns an iterator to the element with the key and `true` if it has been inserted
+         * @throws Throws an `AssertionFailureO1` if `FIBER_ASSERTION_LEVEL_O1` or higher is enabled and the key is new but the map is full.
+         */
+        template<class Key, class... Args>
+        constexpr std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args){
+            const size_type hash = this->_hash(key);
+            const auto [slot, found] = this->search(key, hash);
+            if(found) return {iterator(this, slot), false};
+            FIBER_ASSERT_O1_MSG(!this->full(), "The hash map is full!");
+            this->open_slot(slot, hash);
+            std::construct_at(&this->_slots[slot].value,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<Key>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+            ++this->_size;
+            return {iterator(this, slot), true};
+        }
+
+        /// @brief inserts a copy of the element if its key is not in the map yet, see `try_emplace()`
+        constexpr std::pair<iterator, bool> insert(const value_type& value){
+            return this->try_emplace(value.first, value.second);
+        }
+
+        /// @brief inserts the element if its key is not in the map yet, see `try_emplace()`
+        constexpr std::pair<iterator, bool> insert(value_type&& value){
+            return this->try_emplace(value.first, std::move(value.second));
+        }
+
+        /// @brief inserts the element or assigns the value if the key exists already, see `try_emplace()`
+        template<class Key, class Value>
+        constexpr std::pair<iterator, bool> insert_or_assign(Key&& key, Value&& value){
+            auto result = this->try_emplace(std::forward<Key>(key), std::forward<Value>(value));
+            if(!result.second) result.first->second = std::forward<Value>(value);
+            return result;
+        }
+
+        /// @brief returns the value of the key and inserts a default constructed one first if the key is not in the map
+        template<class Key>
+        constexpr V& operator[](Key&& key){
+            return this->try_emplace(std::forward<Key>(key)).first->second;
+        }
+
+        /**
+         * @brief removes the element with the key
+         * @returns the number of erased elements, `1` or `0`
+         */
+        template<class Key>
+            requires _is_lookup_key<Key>
+        constexpr size_type erase(const Key& key){
+            const auto [slot, found] = this->search(key, this->_hash(key));
+            if(!found) return 0;
+            this->remove_at(slot);
+            return 1;
+        }
+
+        /// @brief removes the element at the iterator, which may move other elements and invalidate other iterators
+        constexpr void erase(const_iterator position){
+            FIBER_ASSERT_O1_MSG(position._map == this && position._slot < N && this->_distance[position._slot] != 0, "The iterator does not point to an element of this map!");
+            this->remove_at(position._slot);
+        }
+
+        /**
+         * @brief removes all elements for which `f(element)` returns `true`
+         *
+         * `f` is called exactly once per element, the order is the slot order starting from a slot that
+         * no element moves into during the erasure.
+         *
+         * @returns the number of erased elements
+         */
+        template<class Callable>
+        constexpr size_type erase_if(Callable&& f){
+            // start at an empty slot or an element in its home slot: erasures never shift anything across it
+            size_type start = 0;
+            while(start < N && this->_distance[start] > 1) ++start;
+            if(start == N) start = 0;
+
+            size_type n_erased = 0;
+            for(size_type i = 0; i < N; ++i){
+                const size_type slot = (start + i) & _mask;
+                // the erasure shifts the next element into this slot, which has not been visited yet
+                while(this->_distance[slot] != 0 && f(std::as_const(this->_slots[slot].value))){
+                    this->remove_at(slot);
+                    ++n_erased;
+                }
+            }
+            return n_erased;
+        }
+
+        /// @brief destroys all elements
+        constexpr void clear(){
+            if(this->_size == 0) return;
+            for(size_type slot = 0; slot < N; ++slot){
+                if(this->_distance[slot] != 0){
+                    std::destroy_at(&this->_slots[slot].value);
+                    this->_distance[slot] = 0;
+                }
+            }
+            this->_size = 0;
+        }
+
+    private:
+
+        /// the home slot of a hash: the upper bits of the hash times 2^w / golden ratio
+        static constexpr size_type home(size_type hash){
+            constexpr size_type golden = (sizeof(size_type) == 8) ? static_cast<size_type>(0x9E3779B97F4A7C15ull) : static_cast<size_type>(0x9E3779B9ul);
+            return static_cast<size_type>(hash * golden) >> _shift;
+        }
+
+        /**
+         * returns the slot of the key and `true`, or the slot where the key would have to be inserted and `false`
+         */
+        template<class Key>
+        constexpr std::pair<size_type, bool> search(const Key& key, size_type hash) const {
+            size_type slot = home(hash);
+            for(uint16_t distance = 1; ; ++distance, slot = (slot + 1) & _mask){
+                // the elements of a cluster are sorted by their home slot:
+                // once an element is closer to its home than the key would be, the key cannot come later
+                if(this->_distance[slot] < distance) return {slot, false};
+                if(this->_distance[slot] == distance && this->_key_equal(this->_slots[slot].value.first, key)) return {slot, true};
+                if(distance == N) return {slot, false};
+            }
+        }
+
+        /// moves the element from the slot `from` into the empty slot `to`
+        constexpr void relocate(size_type to, size_type from){
+            std::construct_at(&this->_slots[to].value, std::move(this->_slots[from].value));
+            std::destroy_at(&this->_slots[from].value);
+        }
+
+        /**
+         * shifts the elements from `slot` up to the next empty slot one slot further,
+         * and marks `slot` as occupied by an element with the home slot of `hash`
+         */
+        constexpr void open_slot(size_type slot, size_type hash){
+            size_type empty = slot;
+            while(this->_distance[empty] != 0) empty = (empty + 1) & _mask;
+            while(empty != slot){
+                const size_type previous = (empty - 1) & _mask;
+                this->relocate(empty, previous);
+                this->_distance[empty] = static_cast<uint16_t>(this->_distance[previous] + 1);
+                empty = previous;
+            }
+            this->_distance[slot] = static_cast<uint16_t>(((slot - home(hash)) & _mask) + 1);
+        }
+
+        /// destroys the element in the slot and shifts the following displaced elements back by one slot
+        constexpr void remove_at(size_type slot){
+            std::destroy_at(&this->_slots[slot].value);
+            size_type next = (slot + 1) & _mask;
+            while(this->_distance[next] > 1){
+                this->relocate(slot, next);
+                this->_distance[slot] = static_cast<uint16_t>(this->_distance[next] - 1);
+                slot = next;
+                next = (next + 1) & _mask;
+            }
+            this->_distance[slot] = 0;
+            --this->_size;
+        }
+    };
+
+} // namespace fiber
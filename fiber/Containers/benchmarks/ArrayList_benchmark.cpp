@@ -0,0 +1,173 @@
+#include "ArrayList_benchmark.hpp"
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// fiber
+#include <fiber/Containers/ArrayList.hpp>
+#include <fiber/Containers/DualArrayList.hpp>
+#include <fiber/BenchmarkFramework/BenchmarkFramework.hpp>
+
+namespace fiber
+{
+    static constexpr uint64_t iterations = 100'000;
+    static constexpr std::size_t list_size = 256;
+
+    /// a pointer with a user provided move, so the containers have to move it element by element
+    struct OpaquePointer{
+        void* pointer = nullptr;
+
+        OpaquePointer() = default;
+        OpaquePointer(void* pointer) : pointer(pointer){}
+        OpaquePointer(const OpaquePointer& other) : pointer(other.pointer){}
+        OpaquePointer& operator=(const OpaquePointer& other){this->pointer = other.pointer; return *this;}
+    };
+
+    /// the element by element loops of the previous implementation, as a baseline
+    struct ElementWise{
+        void* data[list_size + 1];
+        std::size_t size = 0;
+
+        void insert_front(void* value){
+            for(std::size_t i = this->size; i != 0; --i) this->data[i] = std::move(this->data[i - 1]);
+            this->data[0] = value;
+            ++this->size;
+        }
+
+        void erase_front(){
+            for(std::size_t i = 1; i < this->size; ++i) this->data[i - 1] = std::move(this->data[i]);
+            --this->size;
+        }
+
+        template<class Callable>
+        std::size_t erase_if(Callable&& f){
+            std::size_t write = 0;
+            for(std::size_t read = 0; read < this->size; ++read){
+                if(!f(this->data[read])) this->data[write++] = std::move(this->data[read]);
+            }
+            const std::size_t n_erased = this->size - write;
+            this->size = write;
+            return n_erased;
+        }
+
+        void append(void* const* first, void* const* last){
+            for(; first != last; ++first) this->data[this->size++] = *first;
+        }
+    };
+
+    static void* pointers[list_size];
+
+    static void* pointer(std::size_t i){return &pointers[i];}
+
+    /// erases every fourth element, in runs of three kept elements
+    static bool every_fourth(const void* p){
+        return ((static_cast<void* const*>(p) - pointers) & 3) == 0;
+    }
+
+    template<class List>
+    static void fill(List& list){
+        list.clear();
+        for(std::size_t i = 0; i < list_size; ++i) list.emplace_back(pointer(i));
+    }
+
+    static void insert_erase_benchmark(){
+        {
+            static ElementWise list;
+            list.size = 0;
+            list.append(pointers, pointers + list_size - 1);
+            fiber::benchmark("element wise: insert + erase front, 256 pointers", iterations, [&](){
+                list.insert_front(pointer(0));
+                list.erase_front();
+                fiber::do_not_optimize(list.data[0]);
+            });
+        }
+        {
+            static ArrayList<OpaquePointer, list_size> list;
+            fill(list);
+            list.pop_back();
+            fiber::benchmark("ArrayList<OpaquePointer>: insert + erase front, 256 pointers", iterations, [&](){
+                list.insert(list.begin(), OpaquePointer(pointer(0)));
+                list.erase(list.begin());
+                fiber::do_not_optimize(list.front());
+            });
+        }
+        {
+            static ArrayList<void*, list_size> list;
+            fill(list);
+            list.pop_back();
+            fiber::benchmark("ArrayList<void*>: insert + erase front, 256 pointers", iterations, [&](){
+                list.insert(list.begin(), pointer(0));
+                list.erase(list.begin());
+                fiber::do_not_optimize(list.front());
+            });
+        }
+        {
+            static DualArrayList<void*, list_size> list;
+            for(std::size_t i = 0; i + 1 < list_size; ++i) list.right_emplace_back(pointer(i));
+            fiber::benchmark("DualArrayList<void*>: right insert + erase front, 256 pointers", iterations, [&](){
+                list.right_insert(list.right_begin(), pointer(0));
+                list.right_erase(list.right_begin());
+                fiber::do_not_optimize(list.right_front());
+            });
+        }
+    }
+
+    static void erase_if_benchmark(){
+        {
+            static ElementWise list;
+            fiber::benchmark("element wise: erase_if every 4th + refill, 256 pointers", iterations, [&](){
+                list.size = 0;
+                list.append(pointers, pointers + list_size);
+                std::size_t n = list.erase_if([](void* p){return every_fourth(p);});
+                fiber::do_not_optimize(n);
+            });
+        }
+        {
+            static ArrayList<OpaquePointer, list_size> list;
+            fiber::benchmark("ArrayList<OpaquePointer>: erase_if every 4th + refill, 256 pointers", iterations, [&](){
+                list.clear();
+                for(std::size_t i = 0; i < list_size; ++i) list.emplace_back(pointer(i));
+                std::size_t n = list.erase_if([](const OpaquePointer& p){return every_fourth(p.pointer);});
+                fiber::do_not_optimize(n);
+            });
+        }
+        {
+            static ArrayList<void*, list_size> list;
+            fiber::benchmark("ArrayList<void*>: erase_if every 4th + refill, 256 pointers", iterations, [&](){
+                list.clear();
+                list.append(pointers, pointers + list_size);
+                std::size_t n = list.erase_if([](void* p){return every_fourth(p);});
+                fiber::do_not_optimize(n);
+            });
+        }
+    }
+
+    static void append_benchmark(){
+        {
+            static ElementWise list;
+            fiber::benchmark("element wise: append 256 pointers", iterations, [&](){
+                list.size = 0;
+                list.append(pointers, pointers + list_size);
+                fiber::do_not_optimize(list.data[list_size - 1]);
+            });
+        }
+        {
+            static ArrayList<void*, list_size> list;
+            fiber::benchmark("ArrayList<void*>: append 256 pointers", iterations, [&](){
+                list.clear();
+                list.append(pointers, pointers + list_size);
+                fiber::do_not_optimize(list.back());
+            });
+        }
+    }
+
+    void ArrayList_benchmark(){
+        BENCHMARK_GROUP;
+
+        insert_erase_benchmark();
+        erase_if_benchmark();
+        append_benchmark();
+    }
+} // namespace fiber
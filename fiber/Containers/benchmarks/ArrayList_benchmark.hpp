@@ -0,0 +1,9 @@
+#pragma once
+
+namespace fiber
+{
+    /**
+     * @brief Benchmarks the block moves of `fiber::ArrayList` and `fiber::DualArrayList` against element by element moves
+     */
+    void ArrayList_benchmark();
+} // namespace fiber
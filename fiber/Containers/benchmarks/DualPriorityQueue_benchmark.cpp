@@ -0,0 +1,106 @@
+#include "DualPriorityQueue_benchmark.hpp"
+
+// std
+#include <cstddef>
+#include <cstdint>
+
+// fiber
+#include <fiber/Containers/DualPriorityQueue.hpp>
+#include <fiber/BenchmarkFramework/BenchmarkFramework.hpp>
+
+namespace fiber
+{
+    static constexpr uint64_t iterations = 200'000;
+    static constexpr std::size_t max_size = 512;
+
+    /// stands in for a task: the key is behind a pointer and every element has its own cache line
+    struct alignas(64) Item{
+        uint32_t key = 0;
+    };
+
+    struct LargerKey{
+        constexpr bool operator()(const Item* lhs, const Item* rhs) const {return lhs->key > rhs->key;}
+    };
+
+    static Item items[max_size + 1];
+
+    static uint32_t next_random(uint32_t& state){
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    /// the scheduler case: the queue keeps its size, every operation pops the top and pushes it with a later key
+    template<std::size_t arity, std::size_t size, bool stage1>
+    static void hold(const char* name){
+        static DualPriorityQueue<Item*, max_size, LargerKey, LargerKey, arity> queue;
+        uint32_t state = 0x9E3779B9;
+        for(std::size_t i = 0; i < size; ++i){
+            items[i].key = next_random(state) % 1024;
+            if constexpr (stage1) queue.stage1_push(&items[i]); else queue.stage2_push(&items[i]);
+        }
+        fiber::benchmark(name, iterations, [&](){
+            Item* item = stage1 ? queue.stage1_top_pop() : queue.stage2_top_pop();
+            item->key += 1 + next_random(state) % 1024;
+            if constexpr (stage1) queue.stage1_push(item); else queue.stage2_push(item);
+            fiber::do_not_optimize(item);
+        });
+        while(!queue.empty()){
+            if constexpr (stage1) queue.stage1_pop(); else queue.stage2_pop();
+        }
+    }
+
+    /// bursts: fills the queue with `size` elements and drains it, reports the time per element
+    template<std::size_t arity, std::size_t size>
+    static void fill_drain(const char* name){
+        static DualPriorityQueue<Item*, max_size, LargerKey, LargerKey, arity> queue;
+        uint32_t state = 0x12345678;
+        for(std::size_t i = 0; i < size; ++i) items[i].key = next_random(state);
+        std::size_t n = 0;
+        fiber::benchmark(name, iterations, [&](){
+            if(n < size){
+                queue.stage1_push(&items[n]);
+            }else{
+                Item* item = queue.stage1_top_pop();
+                fiber::do_not_optimize(item);
+            }
+            n = (n + 1 < 2 * size) ? n + 1 : 0;
+        });
+        while(!queue.empty()) queue.stage1_pop();
+    }
+
+    void DualPriorityQueue_benchmark(){
+        BENCHMARK_GROUP;
+
+        hold<2, 16, true>("stage 1 hold, arity 2, 16 elements");
+        hold<4, 16, true>("stage 1 hold, arity 4, 16 elements");
+        hold<8, 16, true>("stage 1 hold, arity 8, 16 elements");
+        hold<2, 128, true>("stage 1 hold, arity 2, 128 elements");
+        hold<4, 128, true>("stage 1 hold, arity 4, 128 elements");
+        hold<8, 128, true>("stage 1 hold, arity 8, 128 elements");
+        hold<2, 512, true>("stage 1 hold, arity 2, 512 elements");
+        hold<4, 512, true>("stage 1 hold, arity 4, 512 elements");
+        hold<8, 512, true>("stage 1 hold, arity 8, 512 elements");
+
+        hold<2, 16, false>("stage 2 hold, arity 2, 16 elements");
+        hold<4, 16, false>("stage 2 hold, arity 4, 16 elements");
+        hold<8, 16, false>("stage 2 hold, arity 8, 16 elements");
+        hold<2, 128, false>("stage 2 hold, arity 2, 128 elements");
+        hold<4, 128, false>("stage 2 hold, arity 4, 128 elements");
+        hold<8, 128, false>("stage 2 hold, arity 8, 128 elements");
+        hold<2, 512, false>("stage 2 hold, arity 2, 512 elements");
+        hold<4, 512, false>("stage 2 hold, arity 4, 512 elements");
+        hold<8, 512, false>("stage 2 hold, arity 8, 512 elements");
+
+        fill_drain<2, 16>("stage 1 fill and drain, arity 2, 16 elements");
+        fill_drain<4, 16>("stage 1 fill and drain, arity 4, 16 elements");
+        fill_drain<8, 16>("stage 1 fill and drain, arity 8, 16 elements");
+        fill_drain<2, 128>("stage 1 fill and drain, arity 2, 128 elements");
+        fill_drain<4, 128>("stage 1 fill and drain, arity 4, 128 elements");
+        fill_drain<8, 128>("stage 1 fill and drain, arity 8, 128 elements");
+        fill_drain<2, 512>("stage 1 fill and drain, arity 2, 512 elements");
+        fill_drain<4, 512>("stage 1 fill and drain, arity 4, 512 elements");
+        fill_drain<8, 512>("stage 1 fill and drain, arity 8, 512 elements");
+    }
+} // namespace fiber
@@ -0,0 +1,9 @@
+#pragma once
+
+namespace fiber
+{
+    /**
+     * @brief Benchmarks `fiber::DualPriorityQueue` with heap arities of 2, 4 and 8 for different queue sizes and workloads
+     */
+    void DualPriorityQueue_benchmark();
+} // namespace fiber
@@ -0,0 +1,9 @@
+target_sources(fiber
+    PUBLIC
+        ${CMAKE_CURRENT_LIST_DIR}/ArrayList_benchmark.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/DualPriorityQueue_benchmark.hpp
+        
+    PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/ArrayList_benchmark.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/DualPriorityQueue_benchmark.cpp
+)
@@ -0,0 +1,139 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace fiber
+{
+
+    namespace detail{
+
+        template<class It>
+        inline constexpr bool is_reverse_pointer = false;
+
+        template<class T>
+        inline constexpr bool is_reverse_pointer<std::reverse_iterator<T*>> = true;
+
+        /**
+         * \brief moves the element at `index` up until its parent has a higher priority
+         *
+         * Element `i` is at `root[step * i]`, so the same code serves arrays that grow upwards (`step = 1`)
+         * and the right half of a `fiber::DualArrayList` that grows downwards (`step = -1`) without reverse iterators.
+         * Uses a hole instead of swaps: every level costs one move.
+         */
+        template<std::size_t arity, std::ptrdiff_t step, class Ptr, class Compare>
+        constexpr void dary_sift_up(Ptr root, std::size_t index, Compare& less_priority){
+            auto at = [root](std::size_t i) -> decltype(auto) {return root[step * static_cast<std::ptrdiff_t>(i)];};
+            auto value = std::move(at(index));
+            while(index > 0){
+                const std::size_t parent = (index - 1) / arity;
+                if(!less_priority(at(parent), value)) break;
+                at(index) = std::move(at(parent));
+                index = parent;
+            }
+            at(index) = std::move(value);
+        }
+
+        /**
+         * \brief moves `value` down from `index` into the heap of `size` elements, until no child has a higher priority
+         *
+         * Compares all children of a node first and then moves the one with the highest priority up into the hole.
+         * Nodes with all `arity` children take a loop that the compiler can unroll, only the last node checks the size.
+         */
+        template<std::size_t arity, std::ptrdiff_t step, class Ptr, class Value, class Compare>
+        constexpr void dary_sift_down(Ptr root, std::size_t size, std::size_t index, Value&& value, Compare& less_priority){
+            auto at = [root](std::size_t i) -> decltype(auto) {return root[step * static_cast<std::ptrdiff_t>(i)];};
+            while(true){
+                const std::size_t first_child = arity * index + 1;
+                if(first_child >= size) break;
+
+                std::size_t best = first_child;
+                if(first_child + arity <= size){
+                    for(std::size_t c = first_child + 1; c < first_child + arity; ++c){
+                        if(less_priority(at(best), at(c))) best = c;
+                    }
+                }else{
+                    for(std::size_t c = first_child + 1; c < size; ++c){
+                        if(less_priority(at(best), at(c))) best = c;
+                    }
+                }
+
+                if(!less_priority(value, at(best))) break;
+                at(index) = std::move(at(best));
+                index = best;
+            }
+            at(index) = std::forward<Value>(value);
+        }
+
+        /// calls `function.template operator()<step>(root)` with the fastest root for the iterator type
+        template<class It, class Function>
+        constexpr void dary_dispatch(It first, Function&& function){
+            if constexpr (is_reverse_pointer<It>){
+                function.template operator()<-1>(first.base() - 1);
+            }else{
+                function.template operator()<1>(first);
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * \brief Inserts the element at `last - 1` into the d-ary heap `[first, last - 1)`
+     *
+     * Works like `std::push_heap`, but each node has `arity` children: the tree is flatter,
+     * so pushes and pops visit fewer levels and the children of a node share cache lines.
+     * `less_priority(a, b)` returns `true` if `a` has a lower priority than `b`, the top is at `first`.
+     *
+     * Reverse iterators over pointers (the right half of a `fiber::DualArrayList`) use the pointer directly.
+     *
+     * \tparam arity The number of children per node, at least 2
+     */
+    template<std::size_t arity, std::random_access_iterator It, class Compare>
+    constexpr void push_dary_heap(It first, It last, Compare less_priority){
+        static_assert(arity >= 2, "A heap needs at least two children per node");
+        const std::size_t size = static_cast<std::size_t>(last - first);
+        if(size < 2) return;
+        detail::dary_dispatch(first, [&]<std::ptrdiff_t step>(auto root){
+            detail::dary_sift_up<arity, step>(root, size - 1, less_priority);
+        });
+    }
+
+    /**
+     * \brief Moves the top of the d-ary heap `[first, last)` to `last - 1` and restores the heap `[first, last - 1)`
+     *
+     * Works like `std::pop_heap`, see `fiber::push_dary_heap()`.
+     *
+     * \tparam arity The number of children per node, at least 2
+     */
+    template<std::size_t arity, std::random_access_iterator It, class Compare>
+    constexpr void pop_dary_heap(It first, It last, Compare less_priority){
+        static_assert(arity >= 2, "A heap needs at least two children per node");
+        const std::size_t size = static_cast<std::size_t>(last - first);
+        if(size < 2) return;
+        detail::dary_dispatch(first, [&]<std::ptrdiff_t step>(auto root){
+            auto& back = root[step * static_cast<std::ptrdiff_t>(size - 1)];
+            auto value = std::move(back);
+            back = std::move(root[0]);
+            detail::dary_sift_down<arity, step>(root, size - 1, 0, std::move(value), less_priority);
+        });
+    }
+
+    /**
+     * \brief Returns `true` if `[first, last)` is a d-ary heap
+     *
+     * \tparam arity The number of children per node, at least 2
+     */
+    template<std::size_t arity, std::random_access_iterator It, class Compare>
+    constexpr bool is_dary_heap(It first, It last, Compare less_priority){
+        static_assert(arity >= 2, "A heap needs at least two children per node");
+        const std::size_t size = static_cast<std::size_t>(last - first);
+        for(std::size_t i = 1; i < size; ++i){
+            if(less_priority(first[static_cast<std::ptrdiff_t>((i - 1) / arity)], first[static_cast<std::ptrdiff_t>(i)])) return false;
+        }
+        return true;
+    }
+
+} // namespace fiber
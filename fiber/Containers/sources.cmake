@@ -1,7 +1,16 @@
 target_sources(fiber
     PUBLIC
         ${CMAKE_CURRENT_LIST_DIR}/ArrayList.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/BipBuffer.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/DualArrayList.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/DualPriorityQueue.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/dary_heap.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/IntrusiveList.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/IntrusivePairingHeap.hpp
         ${CMAKE_CURRENT_LIST_DIR}/PriorityQueue.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/SmallArrayList.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/SpscRing.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/StaticHashMap.hpp
     PRIVATE
 )
 
@@ -9,4 +18,10 @@ if(FIBER_COMPILE_TESTS)
 
     include(${CMAKE_CURRENT_LIST_DIR}/tests/sources.cmake)
 
+endif()
+
+if(FIBER_COMPILE_BENCHMARKS)
+
+    include(${CMAKE_CURRENT_LIST_DIR}/benchmarks/sources.cmake)
+
 endif()
\ No newline at end of file
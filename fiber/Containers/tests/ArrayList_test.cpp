@@ -2,6 +2,10 @@
 #include "fiber/Containers/ArrayList.hpp"
 #include <fiber/TestFramework/TestFramework.hpp>
 
+// std
+#include <array>
+#include <string>
+
 namespace fiber
 {
 
@@ -372,6 +376,120 @@ namespace fiber
 
             TEST_END;
         }
+
+        fiber::TestResult append_default(){
+            TEST_START;
+
+            ArrayList<char, 8> list{'a', 'b'};
+            char* first = list.append_default(3);
+            TEST_EQUAL(list.size(), 5);
+            TEST_EQUAL(first, list.begin() + 2);
+            first[0] = 'c'; first[1] = 'd'; first[2] = 'e';
+            TEST_TRUE((list == ArrayList<char, 8>{'a', 'b', 'c', 'd', 'e'}));
+
+            TEST_EQUAL(list.append_default(0), list.end());
+            TEST_EQUAL(list.size(), 5);
+            TEST_THROW(list.append_default(4);)
+            
+            TEST_END;
+        }
+
+        /// not trivially relocatable, counts the live objects to find leaks and double destructions
+        struct Tracked{
+            static inline int alive = 0;
+            std::string value;
+
+            Tracked(const char* value) : value(value){++alive;}
+            Tracked(const Tracked& other) : value(other.value){++alive;}
+            Tracked(Tracked&& other) : value(std::move(other.value)){++alive;}
+            Tracked& operator=(const Tracked&) = default;
+            Tracked& operator=(Tracked&&) = default;
+            ~Tracked(){--alive;}
+
+            friend bool operator==(const Tracked& lhs, const char* rhs){return lhs.value == rhs;}
+        };
+
+        static_assert(fiber::is_trivially_relocatable_v<int*>);
+        static_assert(!fiber::is_trivially_relocatable_v<Tracked>);
+
+        fiber::TestResult erase_range_keeps_the_tail(){
+            TEST_START;
+
+            ArrayList<int, 10> list{0, 1, 2, 3, 4, 5, 6, 7};
+            list.erase(list.begin() + 1, list.begin() + 3);
+            TEST_TRUE((list == ArrayList<int, 10>{0, 3, 4, 5, 6, 7}));
+
+            list.erase(list.begin(), list.begin());
+            TEST_EQUAL(list.size(), 6);
+
+            TEST_END;
+        }
+
+        fiber::TestResult insert_own_element(){
+            TEST_START;
+
+            ArrayList<int, 10> list{0, 1, 2};
+            list.insert(list.begin(), list.back());
+            TEST_TRUE((list == ArrayList<int, 10>{2, 0, 1, 2}));
+
+            TEST_END;
+        }
+
+        fiber::TestResult relocates_non_trivial_elements(){
+            TEST_START;
+
+            Tracked::alive = 0;
+            {
+                ArrayList<Tracked, 10> list;
+                for(const char* value : {"a", "b", "c", "d", "e", "f"}) list.emplace_back(value);
+                TEST_EQUAL(Tracked::alive, 6);
+
+                list.insert(list.begin() + 1, Tracked("x"));
+                TEST_EQUAL(Tracked::alive, 7);
+                TEST_TRUE(list[1] == "x");
+                TEST_TRUE(list[2] == "b");
+                TEST_TRUE(list[6] == "f");
+
+                const std::array<Tracked, 2> range = {Tracked("y"), Tracked("z")};
+                list.insert(list.begin(), range.begin(), range.end());
+                TEST_EQUAL(Tracked::alive, 11);
+                TEST_TRUE(list[0] == "y");
+                TEST_TRUE(list[2] == "a");
+
+                list.erase(list.begin() + 2);
+                list.erase(list.begin(), list.begin() + 2);
+                TEST_EQUAL(Tracked::alive, 8);
+                TEST_TRUE(list.front() == "x");
+
+                TEST_EQUAL(list.erase_if([](const Tracked& t){return t.value == "b" || t.value == "e";}), 2);
+                TEST_EQUAL(list.size(), 4);
+                TEST_EQUAL(Tracked::alive, 6);
+                TEST_TRUE(list[0] == "x");
+                TEST_TRUE(list[1] == "c");
+                TEST_TRUE(list[2] == "d");
+                TEST_TRUE(list[3] == "f");
+            }
+            TEST_EQUAL(Tracked::alive, 0);
+
+            TEST_END;
+        }
+
+        fiber::TestResult erase_if_runs(){
+            TEST_START;
+
+            ArrayList<int, 16> list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+            int calls = 0;
+            const auto n = list.erase_if([&](int i){++calls; return i == 0 || i == 3 || i == 4 || i == 11;});
+            TEST_EQUAL(n, 4);
+            TEST_EQUAL(calls, 12);
+            TEST_TRUE((list == ArrayList<int, 16>{1, 2, 5, 6, 7, 8, 9, 10}));
+
+            TEST_EQUAL(list.erase_if([](int){return false;}), 0);
+            TEST_EQUAL(list.erase_if([](int){return true;}), 8);
+            TEST_TRUE(list.empty());
+
+            TEST_END;
+        }
     }// private namespace
 
     fiber::TestResult ArrayList_test(){
@@ -386,6 +504,11 @@ namespace fiber
             | any_all_none
             | negation
             | for_each_loop
+            | append_default
+            | erase_range_keeps_the_tail
+            | insert_own_element
+            | relocates_non_trivial_elements
+            | erase_if_runs
             ;
 
     }
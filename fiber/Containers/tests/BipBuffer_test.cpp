@@ -0,0 +1,174 @@
+#include "BipBuffer_test.hpp"
+
+// std
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+
+// fiber
+#include <fiber/Containers/BipBuffer.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber{
+
+    namespace{
+
+        uint32_t xorshift(uint32_t& state){
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+
+        fiber::TestResult reserve_commit_read_release(){
+            TEST_START;
+
+            BipBuffer<16> buffer;
+            TEST_TRUE(buffer.empty());
+            TEST_TRUE(buffer.read().empty());
+
+            std::span<uint8_t> region = buffer.reserve(5);
+            TEST_EQUAL(region.size(), 5);
+            for(std::size_t i = 0; i < region.size(); ++i) region[i] = static_cast<uint8_t>(i);
+
+            // only the committed part is visible
+            buffer.commit(3);
+            TEST_EQUAL(buffer.size(), 3);
+            std::span<const uint8_t> data = buffer.read();
+            TEST_EQUAL(data.size(), 3);
+            TEST_EQUAL(data[2], 2);
+
+            buffer.release(2);
+            TEST_EQUAL(buffer.size(), 1);
+            TEST_EQUAL(buffer.read()[0], 2);
+            buffer.release(1);
+            TEST_TRUE(buffer.empty());
+
+            TEST_END;
+        }
+
+        fiber::TestResult wraps_with_watermark(){
+            TEST_START;
+
+            BipBuffer<16> buffer;
+            const std::array<uint8_t, 12> a = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+            const std::array<uint8_t, 6> b = {2, 2, 2, 2, 2, 2};
+            TEST_TRUE(buffer.write(a.data(), a.size()));
+            buffer.release(8);
+
+            // 4 elements are free at the end, 8 at the front: 6 do not fit at the end and wrap
+            TEST_TRUE(buffer.can_reserve(6));
+            TEST_FALSE(buffer.can_reserve(8)); // the write position may never reach the read position
+            TEST_TRUE(buffer.write(b.data(), b.size()));
+            TEST_EQUAL(buffer.size(), 10);
+
+            // the consumer reads the data before the wrap first, then continues at the front
+            std::span<const uint8_t> data = buffer.read();
+            TEST_EQUAL(data.size(), 4);
+            TEST_EQUAL(data[0], 1);
+            buffer.release(4);
+            data = buffer.read();
+            TEST_EQUAL(data.size(), 6);
+            TEST_EQUAL(data[0], 2);
+            buffer.release(6);
+            TEST_TRUE(buffer.empty());
+
+            TEST_END;
+        }
+
+        fiber::TestResult reserve_max(){
+            TEST_START;
+
+            BipBuffer<16> buffer;
+            TEST_EQUAL(buffer.reserve_max().size(), 16);
+            buffer.commit(10);
+            buffer.release(9);
+
+            // 6 free at the end, 8 usable at the front
+            std::span<uint8_t> region = buffer.reserve_max();
+            TEST_EQUAL(region.size(), 8);
+            buffer.commit(8);
+            TEST_EQUAL(buffer.size(), 9);
+
+            // inverted: the free space is between the write and the read position
+            TEST_EQUAL(buffer.reserve_max().size(), 0);
+            buffer.commit(0);
+            buffer.release(1);
+            TEST_EQUAL(buffer.read().size(), 8);
+            buffer.release(4);
+            TEST_EQUAL(buffer.reserve_max().size(), 8);
+
+            TEST_END;
+        }
+
+        fiber::TestResult awaitables(){
+            TEST_START;
+
+            BipBuffer<8> buffer;
+            TEST_FALSE(buffer.data_available().await_ready());
+            TEST_TRUE(buffer.space_available(8).await_ready());
+            TEST_FALSE(buffer.space_available(9).await_ready());
+
+            buffer.reserve(6);
+            buffer.commit(6);
+            TEST_TRUE(buffer.data_available(6).await_ready());
+            TEST_FALSE(buffer.data_available(7).await_ready());
+            TEST_FALSE(buffer.space_available(3).await_ready());
+            buffer.release(4);
+            TEST_TRUE(buffer.space_available(3).await_ready());
+
+            TEST_END;
+        }
+
+        fiber::TestResult random_stream(){
+            TEST_START;
+
+            // the consumer has to see exactly the sequence of the producer
+            BipBuffer<64> buffer;
+            uint32_t state = 0xB1B;
+            uint8_t next_write = 0;
+            uint8_t next_read = 0;
+            std::size_t written = 0;
+            std::size_t read = 0;
+
+            for(int i = 0; i < 5000; ++i){
+                const uint32_t random = xorshift(state);
+                if(random & 1){
+                    const std::size_t n = 1 + (random >> 8) % 24;
+                    std::span<uint8_t> region = ((random >> 1) & 1) ? buffer.reserve(n) : buffer.reserve_max();
+                    const std::size_t used = std::min(region.size(), n);
+                    for(std::size_t k = 0; k < used; ++k) region[k] = next_write++;
+                    buffer.commit(used);
+                    written += used;
+                }else{
+                    std::span<const uint8_t> data = buffer.read();
+                    const std::size_t n = std::min<std::size_t>(data.size(), (random >> 8) % 24);
+                    for(std::size_t k = 0; k < n; ++k){
+                        TEST_EQUAL(data[k], next_read);
+                        ++next_read;
+                    }
+                    buffer.release(n);
+                    read += n;
+                }
+                TEST_EQUAL(buffer.size(), written - read);
+            }
+            TEST_GREATER(read, 1000);
+
+            TEST_END;
+        }
+
+    } // private namespace
+
+    fiber::TestResult BipBuffer_test(){
+        TEST_GROUP;
+
+        return fiber::TestResult()
+            | reserve_commit_read_release
+            | wraps_with_watermark
+            | reserve_max
+            | awaitables
+            | random_stream
+            ;
+    }
+}
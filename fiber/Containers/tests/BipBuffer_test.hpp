@@ -0,0 +1,8 @@
+#pragma once
+
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    fiber::TestResult BipBuffer_test();
+} // namespace fiber
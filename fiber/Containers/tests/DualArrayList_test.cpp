@@ -4,6 +4,9 @@
 #include <fiber/OStream/OStream.hpp>
 #include <fiber/TestFramework/TestFramework.hpp>
 
+// std
+#include <string>
+
 namespace fiber{
 
     namespace{
@@ -983,6 +986,72 @@ namespace fiber{
             TEST_END;
         }
 
+        fiber::TestResult erase_range_and_erase_if(){
+            TEST_START;
+
+            DualArrayList<int, 32> a;
+            a.left_assign({0, 1, 2, 3, 4, 5, 6, 7});
+            a.right_assign({10, 11, 12, 13, 14, 15, 16, 17});
+
+            // fewer erased than following elements
+            a.left_erase(1, 3);
+            a.right_erase(a.right_begin() + 1, a.right_begin() + 3);
+            TEST_EQUAL(a.left_size(), 6);
+            TEST_EQUAL(a.left_at(1), 3);
+            TEST_EQUAL(a.left_back(), 7);
+            TEST_EQUAL(a.right_size(), 6);
+            TEST_EQUAL(a.right_at(1), 13);
+            TEST_EQUAL(a.right_back(), 17);
+
+            // {0, 3, 4, 5, 6, 7} and {10, 13, 14, 15, 16, 17}
+            int last_seen = -1;
+            bool in_order = true;
+            TEST_EQUAL(a.right_erase_if([&](int i){in_order &= last_seen < i; last_seen = i; return i % 2 == 0;}), 3);
+            TEST_TRUE(in_order);
+            TEST_EQUAL(a.left_erase_if([](int i){return i % 2 == 1;}), 3);
+
+            TEST_EQUAL(a.left_size(), 3);
+            TEST_EQUAL(a.left_at(0), 0);
+            TEST_EQUAL(a.left_at(1), 4);
+            TEST_EQUAL(a.left_at(2), 6);
+            TEST_EQUAL(a.right_size(), 3);
+            TEST_EQUAL(a.right_at(0), 13);
+            TEST_EQUAL(a.right_at(1), 15);
+            TEST_EQUAL(a.right_at(2), 17);
+
+            TEST_END;
+        }
+
+        fiber::TestResult right_insert_non_trivial(){
+            TEST_START;
+
+            DualArrayList<std::string, 16> a;
+            a.right_assign({std::string("a"), std::string("b"), std::string("c")});
+            a.right_insert(a.right_begin() + 1, std::string("x"));
+            const std::string range[] = {"y", "z"};
+            a.right_insert(a.right_begin(), std::begin(range), std::end(range));
+            a.left_insert(a.left_begin(), std::string("l"));
+
+            // {y, z, a, x, b, c}
+            TEST_EQUAL(a.right_size(), 6);
+            TEST_TRUE(a.right_at(0) == "y");
+            TEST_TRUE(a.right_at(2) == "a");
+            TEST_TRUE(a.right_at(3) == "x");
+            TEST_TRUE(a.right_at(5) == "c");
+
+            a.right_erase(a.right_begin() + 3);
+            TEST_EQUAL(a.right_erase_if([](const std::string& s){return s == "z" || s == "c";}), 2);
+            TEST_EQUAL(a.right_size(), 3);
+            TEST_TRUE(a.right_at(0) == "y");
+            TEST_TRUE(a.right_at(1) == "a");
+            TEST_TRUE(a.right_at(2) == "b");
+            TEST_TRUE(a.left_front() == "l");
+
+            a.clear();
+
+            TEST_END;
+        }
+
     } // private namespace
      
     fiber::TestResult DualArrayList_test(){
@@ -998,6 +1067,8 @@ namespace fiber{
             | insert_range
             | insert_range_by_proxy
             | erase
+            | erase_range_and_erase_if
+            | right_insert_non_trivial
             ;
     }
 }
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "DualPriorityQueue_test.hpp"
+
+// std
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+
+// fiber
+#include <fiber/Containers/DualPriorityQueue.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber{
+
+    namespace{
+
+        uint32_t xorshift(uint32_t& state){
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+
+        fiber::TestResult stages_use_their_own_order(){
+            TEST_START;
+
+            // stage 1 pops the smallest, stage 2 the largest value
+            DualPriorityQueue<int, 8, std::greater<int>, std::less<int>> queue;
+            for(int value : {4, 1, 3, 2}){
+                queue.stage1_push(value);
+                queue.stage2_push(value);
+            }
+            TEST_TRUE(queue.full());
+
+            TEST_EQUAL(queue.stage1_top_pop(), 1);
+            TEST_EQUAL(queue.stage1_top_pop(), 2);
+            TEST_EQUAL(queue.stage2_top_pop(), 4);
+            TEST_EQUAL(queue.stage2_top_pop(), 3);
+            TEST_EQUAL(queue.stage1_top_pop(), 3);
+            TEST_EQUAL(queue.stage2_top_pop(), 2);
+            TEST_EQUAL(queue.stage1_top_pop(), 4);
+            TEST_EQUAL(queue.stage2_top_pop(), 1);
+            TEST_TRUE(queue.empty());
+
+            TEST_END;
+        }
+
+        template<std::size_t arity>
+        fiber::TestResult random_against_sorted(){
+            TEST_START;
+
+            constexpr std::size_t N = 200;
+            DualPriorityQueue<uint32_t, N, std::greater<uint32_t>, std::less<uint32_t>, arity> queue;
+            std::array<uint32_t, N> stage1_reference{};
+            std::array<uint32_t, N> stage2_reference{};
+            std::size_t stage1_size = 0;
+            std::size_t stage2_size = 0;
+            uint32_t state = 0xC0FFEE;
+
+            for(int i = 0; i < 2000; ++i){
+                const uint32_t random = xorshift(state);
+                const uint32_t value = (random >> 8) % 100;
+                const bool stage1 = (random & 1) != 0;
+                const bool push = ((random >> 1) % 8) < 5;
+                if(push && !queue.full()){
+                    if(stage1){
+                        queue.stage1_push(value);
+                        stage1_reference[stage1_size++] = value;
+                    }else{
+                        queue.stage2_push(value);
+                        stage2_reference[stage2_size++] = value;
+                    }
+                }else if(stage1 && stage1_size > 0){
+                    const auto min = std::min_element(stage1_reference.begin(), stage1_reference.begin() + stage1_size);
+                    TEST_EQUAL(queue.stage1_top_pop(), *min);
+                    *min = stage1_reference[--stage1_size];
+                }else if(!stage1 && stage2_size > 0){
+                    const auto max = std::max_element(stage2_reference.begin(), stage2_reference.begin() + stage2_size);
+                    TEST_EQUAL(queue.stage2_top_pop(), *max);
+                    *max = stage2_reference[--stage2_size];
+                }
+                TEST_TRUE(fiber::is_dary_heap<arity>(queue.stage1_begin(), queue.stage1_end(), std::greater<uint32_t>{}));
+                TEST_TRUE(fiber::is_dary_heap<arity>(queue.stage2_begin(), queue.stage2_end(), std::less<uint32_t>{}));
+            }
+
+            TEST_EQUAL(queue.stage1_size(), stage1_size);
+            TEST_EQUAL(queue.stage2_size(), stage2_size);
+
+            std::sort(stage1_reference.begin(), stage1_reference.begin() + stage1_size);
+            for(std::size_t i = 0; i < stage1_size; ++i) TEST_EQUAL(queue.stage1_top_pop(), stage1_reference[i]);
+            std::sort(stage2_reference.begin(), stage2_reference.begin() + stage2_size, std::greater<uint32_t>{});
+            for(std::size_t i = 0; i < stage2_size; ++i) TEST_EQUAL(queue.stage2_top_pop(), stage2_reference[i]);
+            TEST_TRUE(queue.empty());
+
+            TEST_END;
+        }
+
+        fiber::TestResult dary_heap_matches_std_heap(){
+            TEST_START;
+
+            // with two children per node the layout is the same as the one of `std::push_heap`
+            std::array<int, 32> values{};
+            uint32_t state = 12345;
+            for(std::size_t i = 0; i < values.size(); ++i){
+                values[i] = static_cast<int>(xorshift(state) % 50);
+                fiber::push_dary_heap<2>(values.begin(), values.begin() + i + 1, std::less<int>{});
+                TEST_TRUE(std::is_heap(values.begin(), values.begin() + i + 1));
+            }
+            for(std::size_t i = values.size(); i > 1; --i){
+                fiber::pop_dary_heap<2>(values.begin(), values.begin() + i, std::less<int>{});
+                TEST_TRUE(std::is_heap(values.begin(), values.begin() + i - 1));
+            }
+            TEST_TRUE(std::is_sorted(values.begin(), values.end()));
+
+            TEST_END;
+        }
+
+    } // private namespace
+
+    fiber::TestResult DualPriorityQueue_test(){
+        TEST_GROUP;
+
+        return fiber::TestResult()
+            | stages_use_their_own_order
+            | random_against_sorted<2>
+            | random_against_sorted<4>
+            | random_against_sorted<8>
+            | dary_heap_matches_std_heap
+            ;
+    }
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    fiber::TestResult DualPriorityQueue_test();
+} // namespace fiber
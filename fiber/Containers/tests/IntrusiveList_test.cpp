@@ -0,0 +1,109 @@
+#include "IntrusiveList_test.hpp"
+
+#include <fiber/Containers/IntrusiveList.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber{
+
+    namespace{
+
+        struct Node{
+            int value = 0;
+            ListHook<Node> hook;
+
+            Node(int value) : value(value){}
+        };
+
+        using List = IntrusiveList<Node, &Node::hook>;
+
+        int sum(const List& list){
+            int result = 0;
+            for(const Node* node : list) result = result * 10 + node->value;
+            return result;
+        }
+
+        fiber::TestResult push_and_erase(){
+            TEST_START;
+
+            Node a{1}, b{2}, c{3}, d{4};
+            List list;
+            TEST_TRUE(list.empty());
+            TEST_TRUE(list.begin() == list.end());
+
+            list.push_back(&b);
+            list.push_back(&c);
+            list.push_front(&a);
+            TEST_EQUAL(list.size(), 3);
+            TEST_EQUAL(sum(list), 123);
+            TEST_TRUE(list.front() == &a);
+            TEST_TRUE(list.back() == &c);
+            TEST_TRUE(list.contains(&b));
+            TEST_FALSE(list.contains(&d));
+            TEST_THROW(list.push_back(&b));
+
+            // erase from the middle, the front and the back
+            list.erase(&b);
+            TEST_EQUAL(sum(list), 13);
+            TEST_FALSE(List::is_linked(&b));
+            list.push_back(&d);
+            list.push_back(&b);
+            TEST_EQUAL(sum(list), 1342);
+            TEST_TRUE(list.pop_front() == &a);
+            list.erase(&b);
+            TEST_EQUAL(sum(list), 34);
+            TEST_TRUE(list.back() == &d);
+
+            // elements can only be erased from the list that contains them
+            List other;
+            TEST_THROW(other.erase(&c));
+
+            list.clear();
+            TEST_TRUE(list.empty());
+            TEST_EQUAL(list.size(), 0);
+            TEST_FALSE(List::is_linked(&c));
+
+            TEST_END;
+        }
+
+        fiber::TestResult erase_if_moves(){
+            TEST_START;
+
+            Node nodes[6] = {{1}, {2}, {3}, {4}, {5}, {6}};
+            List list;
+            List odd;
+            for(Node& node : nodes) list.push_back(&node);
+
+            const auto n = list.erase_if(
+                [](const Node* node){return node->value % 2 == 1;},
+                [&](Node* node){odd.push_back(node);});
+
+            TEST_EQUAL(n, 3);
+            TEST_EQUAL(sum(list), 246);
+            TEST_EQUAL(sum(odd), 135);
+            TEST_TRUE(odd.contains(&nodes[0]));
+            TEST_FALSE(list.contains(&nodes[0]));
+
+            TEST_EQUAL(list.erase_if([](const Node*){return true;}), 3);
+            TEST_TRUE(list.empty());
+            TEST_TRUE(list.back() == nullptr);
+
+            // copies of linked elements are not linked
+            const Node copy = nodes[0];
+            TEST_FALSE(List::is_linked(&copy));
+
+            odd.clear();
+
+            TEST_END;
+        }
+
+    } // private namespace
+
+    fiber::TestResult IntrusiveList_test(){
+        TEST_GROUP;
+
+        return fiber::TestResult()
+            | push_and_erase
+            | erase_if_moves
+            ;
+    }
+}
@@ -0,0 +1,143 @@
+#include "IntrusivePairingHeap_test.hpp"
+
+// std
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+// fiber
+#include <fiber/Containers/IntrusivePairingHeap.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber{
+
+    namespace{
+
+        struct Node{
+            int key = 0;
+            PairingHeapHook<Node> hook;
+
+            Node() = default;
+            Node(int key) : key(key){}
+        };
+
+        struct LargerKey{
+            constexpr bool operator()(const Node* lhs, const Node* rhs) const {return lhs->key > rhs->key;}
+        };
+
+        using Heap = IntrusivePairingHeap<Node, &Node::hook, LargerKey>;
+
+        uint32_t xorshift(uint32_t& state){
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+
+        fiber::TestResult push_pop(){
+            TEST_START;
+
+            Node nodes[7] = {{5}, {3}, {9}, {1}, {7}, {3}, {0}};
+            Heap heap;
+            TEST_TRUE(heap.empty());
+            for(Node& node : nodes) heap.push(&node);
+            TEST_EQUAL(heap.size(), 7);
+            TEST_TRUE(heap.top() == &nodes[6]);
+            TEST_THROW(heap.push(&nodes[2]));
+
+            // iteration visits every element once
+            int visited = 0;
+            int key_sum = 0;
+            for(const Node* node : heap){
+                ++visited;
+                key_sum += node->key;
+            }
+            TEST_EQUAL(visited, 7);
+            TEST_EQUAL(key_sum, 28);
+
+            const int expected[7] = {0, 1, 3, 3, 5, 7, 9};
+            for(int key : expected){
+                TEST_EQUAL(heap.top_pop()->key, key);
+            }
+            TEST_TRUE(heap.empty());
+            TEST_FALSE(Heap::is_linked(&nodes[0]));
+
+            TEST_END;
+        }
+
+        fiber::TestResult erase(){
+            TEST_START;
+
+            Node nodes[8] = {{4}, {8}, {2}, {6}, {1}, {5}, {7}, {3}};
+            Heap heap;
+            for(Node& node : nodes) heap.push(&node);
+            heap.pop(); // builds a deeper tree
+
+            heap.erase(&nodes[3]); // 6
+            heap.erase(&nodes[2]); // 2, the top
+            TEST_FALSE(heap.contains(&nodes[3]));
+            TEST_EQUAL(heap.size(), 5);
+
+            Heap other;
+            TEST_THROW(other.erase(&nodes[0]));
+
+            const int expected[5] = {3, 4, 5, 7, 8};
+            for(int key : expected){
+                TEST_EQUAL(heap.top_pop()->key, key);
+            }
+
+            TEST_END;
+        }
+
+        fiber::TestResult random_against_sorted(){
+            TEST_START;
+
+            constexpr std::size_t n = 200;
+            std::array<Node, n> nodes;
+            std::array<int, n> reference;
+            std::size_t reference_size = 0;
+            Heap heap;
+
+            uint32_t state = 0x12345678;
+            for(int round = 0; round < 4000; ++round){
+                Node& node = nodes[xorshift(state) % n];
+                const uint32_t action = xorshift(state) % 4;
+                if(!Heap::is_linked(&node)){
+                    node.key = static_cast<int>(xorshift(state) % 1000);
+                    heap.push(&node);
+                    reference[reference_size++] = node.key;
+                }else if(action == 0){
+                    heap.erase(&node);
+                    *std::find(reference.begin(), reference.begin() + reference_size, node.key) = reference[reference_size - 1];
+                    --reference_size;
+                }else if(action == 1){
+                    const int top = heap.top_pop()->key;
+                    const auto min = std::min_element(reference.begin(), reference.begin() + reference_size);
+                    TEST_EQUAL(top, *min);
+                    *min = reference[reference_size - 1];
+                    --reference_size;
+                }
+                TEST_EQUAL(heap.size(), reference_size);
+            }
+
+            std::sort(reference.begin(), reference.begin() + reference_size);
+            for(std::size_t i = 0; i < reference_size; ++i){
+                TEST_EQUAL(heap.top_pop()->key, reference[i]);
+            }
+            TEST_TRUE(heap.empty());
+
+            TEST_END;
+        }
+
+    } // private namespace
+
+    fiber::TestResult IntrusivePairingHeap_test(){
+        TEST_GROUP;
+
+        return fiber::TestResult()
+            | push_pop
+            | erase
+            | random_against_sorted
+            ;
+    }
+}
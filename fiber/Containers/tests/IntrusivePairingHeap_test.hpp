@@ -0,0 +1,8 @@
+#pragma once
+
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    fiber::TestResult IntrusivePairingHeap_test();
+} // namespace fiber
@@ -0,0 +1,172 @@
+#include "PriorityQueue_test.hpp"
+
+// std
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+
+// fiber
+#include <fiber/Containers/PriorityQueue.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber{
+
+    namespace{
+
+        struct Job{
+            int deadline = 0;
+            int id = 0;
+
+            Job() = default;
+            Job(int deadline, int id) : deadline(deadline), id(id){}
+        };
+
+        struct LaterDeadline{
+            constexpr bool operator()(const Job& lhs, const Job& rhs) const {return lhs.deadline > rhs.deadline;}
+        };
+
+        uint32_t xorshift(uint32_t& state){
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+
+        fiber::TestResult push_pop(){
+            TEST_START;
+
+            PriorityQueue<int, 8> queue;
+            for(int value : {5, 3, 9, 1, 7, 3, 0}) queue.push(value);
+            TEST_EQUAL(queue.size(), 7);
+            TEST_EQUAL(queue.reserve(), 1);
+
+            for(int expected : {9, 7, 5, 3, 3, 1, 0}){
+                TEST_EQUAL(queue.top_pop(), expected);
+            }
+            TEST_TRUE(queue.empty());
+
+            TEST_END;
+        }
+
+        fiber::TestResult update_and_erase(){
+            TEST_START;
+
+            PriorityQueue<Job, 8, LaterDeadline> queue;
+            auto a = queue.emplace(50, 1);
+            auto b = queue.emplace(20, 2);
+            auto c = queue.emplace(30, 3);
+            auto d = queue.emplace(40, 4);
+            TEST_EQUAL(queue.top().id, 2);
+            TEST_TRUE(queue.top_handle() == b);
+
+            // decrease key
+            queue[a].deadline = 10;
+            queue.update(a);
+            TEST_EQUAL(queue.top().id, 1);
+
+            // increase key
+            queue.update(a, Job(60, 1));
+            TEST_EQUAL(queue.top().id, 2);
+
+            queue.erase(c);
+            TEST_FALSE(queue.contains(c));
+            TEST_TRUE(queue.contains(d));
+            TEST_EQUAL(queue[d].id, 4);
+
+            TEST_EQUAL(queue.top_pop().id, 2);
+            TEST_EQUAL(queue.top_pop().id, 4);
+            TEST_EQUAL(queue.top_pop().id, 1);
+            TEST_TRUE(queue.empty());
+
+            TEST_END;
+        }
+
+        fiber::TestResult stale_handles(){
+            TEST_START;
+
+            PriorityQueue<int, 2> queue;
+            auto a = queue.push(1);
+            queue.pop();
+            TEST_FALSE(queue.contains(a));
+            TEST_FALSE(queue.contains(PriorityQueue<int, 2>::Handle()));
+
+            // the slot is reused, the old handle stays invalid
+            auto b = queue.push(2);
+            TEST_EQUAL(a.slot(), b.slot());
+            TEST_FALSE(queue.contains(a));
+            TEST_TRUE(queue.contains(b));
+            TEST_THROW(queue[a]);
+
+            queue.clear();
+            TEST_FALSE(queue.contains(b));
+
+            TEST_END;
+        }
+
+        fiber::TestResult random_against_sorted(){
+            TEST_START;
+
+            constexpr std::size_t N = 64;
+            PriorityQueue<Job, N, LaterDeadline> queue;
+            std::array<PriorityQueue<Job, N, LaterDeadline>::Handle, N> handles{};
+            std::array<int, N> deadlines{};
+            std::size_t size = 0;
+            uint32_t state = 0xBADC0DE;
+
+            for(int i = 0; i < 3000; ++i){
+                const uint32_t random = xorshift(state);
+                const int deadline = static_cast<int>((random >> 8) % 1000);
+                const uint32_t operation = random % 4;
+                if(operation == 0 && size < N){
+                    handles[size] = queue.emplace(deadline, 0);
+                    deadlines[size] = deadline;
+                    ++size;
+                }else if(operation == 1 && size > 0){
+                    const std::size_t i = (random >> 20) % size;
+                    queue[handles[i]].deadline = deadline;
+                    queue.update(handles[i]);
+                    deadlines[i] = deadline;
+                }else if(operation == 2 && size > 0){
+                    const std::size_t i = (random >> 20) % size;
+                    queue.erase(handles[i]);
+                    TEST_FALSE(queue.contains(handles[i]));
+                    --size;
+                    handles[i] = handles[size];
+                    deadlines[i] = deadlines[size];
+                }else if(size > 0){
+                    const auto top = queue.top_handle();
+                    const auto min = std::min_element(deadlines.begin(), deadlines.begin() + size);
+                    TEST_EQUAL(queue.top().deadline, *min);
+                    const std::size_t i = static_cast<std::size_t>(std::find(handles.begin(), handles.begin() + size, top) - handles.begin());
+                    TEST_TRUE(i < size);
+                    queue.pop();
+                    --size;
+                    handles[i] = handles[size];
+                    deadlines[i] = deadlines[size];
+                }
+                TEST_EQUAL(queue.size(), size);
+            }
+
+            std::sort(deadlines.begin(), deadlines.begin() + size);
+            for(std::size_t i = 0; i < size; ++i){
+                TEST_EQUAL(queue.top_pop().deadline, deadlines[i]);
+            }
+            TEST_TRUE(queue.empty());
+
+            TEST_END;
+        }
+
+    } // private namespace
+
+    fiber::TestResult PriorityQueue_test(){
+        TEST_GROUP;
+
+        return fiber::TestResult()
+            | push_pop
+            | update_and_erase
+            | stale_handles
+            | random_against_sorted
+            ;
+    }
+}
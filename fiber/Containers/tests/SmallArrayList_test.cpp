@@ -0,0 +1,251 @@
+#include "SmallArrayList_test.hpp"
+
+// std
+#include <array>
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+// fiber
+#include <fiber/Containers/SmallArrayList.hpp>
+#include <fiber/Memory/StaticLinearAllocator.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber{
+
+    namespace{
+
+        struct Counted{
+            static int alive;
+            std::string value; // not trivially relocatable
+
+            Counted(const char* value) : value(value){++alive;}
+            Counted(const Counted& other) : value(other.value){++alive;}
+            Counted(Counted&& other) : value(std::move(other.value)){++alive;}
+            Counted& operator=(const Counted& other) = default;
+            ~Counted(){--alive;}
+
+            friend bool operator==(const Counted& lhs, const Counted& rhs){return lhs.value == rhs.value;}
+        };
+
+        int Counted::alive = 0;
+
+        fiber::TestResult stays_inline(){
+            TEST_START;
+
+            StaticLinearAllocatorDebug<512> memory;
+            SmallArrayList<int, 4> list(&memory);
+            for(int i = 0; i < 4; ++i) list.emplace_back(i);
+            TEST_TRUE(list.is_inline());
+            TEST_TRUE(list.full());
+            TEST_EQUAL(list.capacity(), 4);
+            TEST_EQUAL(memory.nalloc(), 0);
+
+            list.erase(list.begin());
+            list.insert(list.begin(), 9);
+            TEST_TRUE(list.is_inline());
+            TEST_EQUAL(list, (SmallArrayList<int, 4>{9, 1, 2, 3}));
+            TEST_EQUAL(memory.nalloc(), 0);
+
+            TEST_END;
+        }
+
+        fiber::TestResult spills_and_shrinks(){
+            TEST_START;
+
+            StaticLinearAllocatorDebug<1024> memory;
+            {
+                SmallArrayList<int, 4> list(&memory);
+                for(int i = 0; i < 5; ++i) list.emplace_back(i);
+                TEST_FALSE(list.is_inline());
+                TEST_EQUAL(list.capacity(), 8);
+                TEST_EQUAL(memory.nalloc(), 1);
+
+                for(int i = 5; i < 20; ++i) list.emplace_back(i);
+                TEST_EQUAL(list.size(), 20);
+                TEST_EQUAL(list.capacity(), 32);
+                TEST_EQUAL(memory.nalloc(), 3);
+                TEST_EQUAL(memory.nfree(), 2);
+                for(int i = 0; i < 20; ++i) TEST_EQUAL(list[i], i);
+
+                list.erase(3, 20);
+                TEST_FALSE(list.is_inline());
+                list.shrink_to_fit();
+                TEST_TRUE(list.is_inline());
+                TEST_EQUAL(list.capacity(), 4);
+                TEST_EQUAL(memory.nfree(), 3);
+                TEST_EQUAL(list, (SmallArrayList<int, 4>{0, 1, 2}));
+
+                list.ensure_capacity(10);
+                TEST_FALSE(list.is_inline());
+                TEST_EQUAL(list.capacity(), 10);
+                TEST_EQUAL(list, (SmallArrayList<int, 4>{0, 1, 2}));
+            }
+            TEST_EQUAL(memory.nalloc(), memory.nfree());
+            TEST_TRUE(memory.empty());
+
+            TEST_END;
+        }
+
+        fiber::TestResult insert_while_growing(){
+            TEST_START;
+
+            StaticLinearAllocatorDebug<1024> memory;
+            {
+                SmallArrayList<int, 4> list({1, 2, 4, 5}, &memory);
+                list.insert(list.begin() + 2, 3);
+                TEST_EQUAL(list, (SmallArrayList<int, 4>({1, 2, 3, 4, 5}, &memory)));
+
+                const std::array<int, 6> range{-5, -4, -3, -2, -1, 0};
+                list.insert(list.begin(), range);
+                TEST_EQUAL(list, (SmallArrayList<int, 4>({-5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5}, &memory)));
+
+                list.insert(-1, 6);
+                TEST_EQUAL(list.back(), 6);
+                TEST_EQUAL(list.size(), 12);
+            }
+            {
+                // the new element refers to an element that moves when the list grows
+                SmallArrayList<Counted, 2> list(&memory);
+                list.emplace_back("a");
+                list.emplace_back("b");
+                list.emplace_back(list.front());
+                list.insert(list.begin(), list.back());
+                TEST_EQUAL(list.size(), 4);
+                TEST_TRUE(list[0].value == "a");
+                TEST_TRUE(list[1].value == "a");
+                TEST_TRUE(list[2].value == "b");
+                TEST_TRUE(list[3].value == "a");
+                TEST_EQUAL(Counted::alive, 4);
+            }
+            {
+                // appending a spilled list to itself grows into a new buffer while the range still reads the old one
+                SmallArrayList<int, 4> list({1, 2, 3, 4}, &memory);
+                list.append({5, 6, 7, 8});
+                TEST_FALSE(list.is_inline());
+                TEST_TRUE(list.full());
+                list.append(list);
+                TEST_EQUAL(list, (SmallArrayList<int, 4>({1, 2, 3, 4, 5, 6, 7, 8, 1, 2, 3, 4, 5, 6, 7, 8}, &memory)));
+            }
+            {
+                SmallArrayList<Counted, 2> list(&memory);
+                for(const char* value : {"a", "b", "c", "d"}) list.emplace_back(value);
+                TEST_FALSE(list.is_inline());
+                TEST_TRUE(list.full());
+                list.insert(list.begin() + 1, list.begin(), list.end());
+                TEST_EQUAL(list.size(), 8);
+                const std::array<const char*, 8> expected{"a", "a", "b", "c", "d", "b", "c", "d"};
+                for(std::size_t i = 0; i < expected.size(); ++i) TEST_TRUE(list[i].value == expected[i]);
+                TEST_EQUAL(Counted::alive, 8);
+            }
+            TEST_EQUAL(Counted::alive, 0);
+            TEST_TRUE(memory.empty());
+
+            TEST_END;
+        }
+
+        fiber::TestResult copy_and_move(){
+            TEST_START;
+
+            StaticLinearAllocatorDebug<1024> memory;
+            {
+                SmallArrayList<Counted, 2> spilled(&memory);
+                for(const char* value : {"a", "b", "c"}) spilled.emplace_back(value);
+                const std::size_t nalloc = memory.nalloc();
+
+                // moving a spilled list takes its buffer
+                SmallArrayList<Counted, 2> moved(std::move(spilled));
+                TEST_EQUAL(memory.nalloc(), nalloc);
+                TEST_TRUE(spilled.empty());
+                TEST_TRUE(spilled.is_inline());
+                TEST_EQUAL(moved.size(), 3);
+                TEST_TRUE(moved.resource() == &memory);
+
+                // copies use the resource of the source
+                SmallArrayList<Counted, 2> copy(moved);
+                TEST_EQUAL(memory.nalloc(), nalloc + 1);
+                TEST_TRUE(copy == moved);
+                TEST_EQUAL(Counted::alive, 6);
+
+                // moving an inline list relocates the elements
+                SmallArrayList<Counted, 2> small(&memory);
+                small.emplace_back("x");
+                moved = std::move(small);
+                TEST_EQUAL(moved.size(), 1);
+                TEST_TRUE(moved[0].value == "x");
+                TEST_EQUAL(Counted::alive, 4);
+
+                copy = moved;
+                TEST_TRUE(copy == moved);
+            }
+            TEST_EQUAL(Counted::alive, 0);
+            TEST_EQUAL(memory.nalloc(), memory.nfree());
+
+            TEST_END;
+        }
+
+        fiber::TestResult array_list_api(){
+            TEST_START;
+
+            StaticLinearAllocatorDebug<1024> memory;
+            SmallArrayList<int, 4> list({0, 1, 2, 3, 4, 5, 6, 7}, &memory);
+            TEST_EQUAL(list.at(-1), 7);
+            TEST_EQUAL(list.front(), 0);
+            TEST_THROW(list.at(8));
+
+            TEST_EQUAL(list.erase_if([](int i){return i % 3 == 0;}), 3);
+            TEST_EQUAL(list, (SmallArrayList<int, 4>({1, 2, 4, 5, 7}, &memory)));
+
+            const SmallArrayList<bool, 4> mask({true, false, true, false, true}, &memory);
+            TEST_EQUAL(list[mask], (SmallArrayList<int, 4>{1, 4, 7}));
+            TEST_TRUE(fiber::any(mask));
+            TEST_FALSE(fiber::all(mask));
+            TEST_TRUE(fiber::none(!SmallArrayList<bool, 4>({true, true}, &memory)));
+
+            list.for_each([](int i){return i * 2;});
+            TEST_EQUAL(list, (SmallArrayList<int, 4>({2, 4, 8, 10, 14}, &memory)));
+            TEST_TRUE(list < (SmallArrayList<int, 4>{2, 4, 9}));
+
+            list.pop_back();
+            list.assign(2, 3);
+            TEST_EQUAL(list, (SmallArrayList<int, 4>{3, 3}));
+            list.clear();
+            TEST_TRUE(list.empty());
+
+            TEST_END;
+        }
+
+        fiber::TestResult no_heap_by_default(){
+            TEST_START;
+
+            // without a memory resource the list does not spill into the heap
+            SmallArrayList<int, 4> list;
+            TEST_TRUE(list.resource() == std::pmr::null_memory_resource());
+            for(int i = 0; i < 4; ++i) list.emplace_back(i);
+            TEST_THROW(list.emplace_back(4));
+            TEST_EQUAL(list.size(), 4);
+            TEST_TRUE(list.is_inline());
+
+            // spilling into the heap has to be asked for
+            SmallArrayList<int, 4> heap_list({0, 1, 2, 3, 4}, std::pmr::get_default_resource());
+            TEST_FALSE(heap_list.is_inline());
+            TEST_EQUAL(heap_list.back(), 4);
+
+            TEST_END;
+        }
+
+    } // private namespace
+
+    fiber::TestResult SmallArrayList_test(){
+        TEST_GROUP;
+
+        return fiber::TestResult()
+            | stays_inline
+            | spills_and_shrinks
+            | insert_while_growing
+            | copy_and_move
+            | array_list_api
+            | no_heap_by_default
+            ;
+    }
+}
@@ -0,0 +1,144 @@
+#include "SpscRing_test.hpp"
+
+// std
+#include <array>
+#include <cstdint>
+
+// fiber
+#include <fiber/Containers/SpscRing.hpp>
+#include <fiber/OS/Scheduler.hpp>
+#include <fiber/OS/Task.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber{
+
+    namespace{
+
+        TimePoint g_mock_time(0);
+        TimePoint get_time(){return g_mock_time;}
+
+        fiber::TestResult push_pop_wraps(){
+            TEST_START;
+
+            SpscRing<int, 4> ring;
+            TEST_TRUE(ring.empty());
+            TEST_EQUAL(ring.capacity(), 4);
+
+            int next_push = 0;
+            int next_pop = 0;
+            for(int round = 0; round < 5; ++round){
+                while(ring.try_push(next_push)) ++next_push;
+                TEST_TRUE(ring.full());
+                TEST_EQUAL(ring.size(), 4);
+                TEST_EQUAL(*ring.front(), next_pop);
+                for(int i = 0; i < 3; ++i){
+                    auto value = ring.try_pop();
+                    TEST_TRUE(value.has_value());
+                    TEST_EQUAL(*value, next_pop);
+                    ++next_pop;
+                }
+                TEST_EQUAL(ring.reserve(), 3);
+            }
+            while(auto value = ring.try_pop()){
+                TEST_EQUAL(*value, next_pop);
+                ++next_pop;
+            }
+            TEST_EQUAL(next_pop, next_push);
+            TEST_TRUE(ring.front() == nullptr);
+
+            TEST_END;
+        }
+
+        fiber::TestResult bulk(){
+            TEST_START;
+
+            SpscRing<uint8_t, 8> ring;
+            const std::array<uint8_t, 6> in = {1, 2, 3, 4, 5, 6};
+            std::array<uint8_t, 8> out{};
+
+            TEST_EQUAL(ring.push(in.data(), in.size()), 6);
+            TEST_EQUAL(ring.pop(out.data(), 4), 4);
+            TEST_EQUAL(ring.push(in.data(), in.size()), 6); // wraps around the end of the buffer
+            TEST_EQUAL(ring.push(in.data(), in.size()), 0);
+            TEST_EQUAL(ring.pop(out.data(), out.size()), 8);
+            const std::array<uint8_t, 8> expected = {5, 6, 1, 2, 3, 4, 5, 6};
+            TEST_TRUE(out == expected);
+
+            TEST_END;
+        }
+
+        fiber::TestResult awaitables(){
+            TEST_START;
+
+            SpscRing<int, 4> ring;
+            TEST_FALSE(ring.data_available().await_ready());
+            TEST_TRUE(ring.space_available(4).await_ready());
+            ring.try_push(1);
+            ring.try_push(2);
+            TEST_TRUE(ring.data_available().await_ready());
+            TEST_FALSE(ring.data_available(3).await_ready());
+            TEST_TRUE(ring.space_available(2).await_ready());
+            TEST_FALSE(ring.space_available(3).await_ready());
+
+            TEST_END;
+        }
+
+        fiber::TestResult consumer_task_suspends(){
+            TEST_START;
+
+            g_mock_time = TimePoint(0);
+
+            struct Consumer{
+                SpscRing<int, 8> ring;
+                int sum = 0;
+                int wakeups = 0;
+
+                static Coroutine<Exit> main(Consumer& self){
+                    while(self.sum < 10){
+                        co_await self.ring.data_available();
+                        ++self.wakeups;
+                        while(auto value = self.ring.try_pop()) self.sum += *value;
+                    }
+                    co_return Exit::Success;
+                }
+            };
+
+            Consumer consumer;
+            Task<512> task("consumer", get_time(), 1ms, Consumer::main, consumer);
+            Scheduler<1> scheduler(get_time);
+            scheduler.add(&task);
+
+            scheduler.spin();
+            scheduler.spin();
+            TEST_EQUAL(scheduler.n_awaiting(), 1);
+            TEST_EQUAL(consumer.wakeups, 0);
+
+            // the 'interrupt' pushes data, the task runs once for both values
+            consumer.ring.try_push(3);
+            consumer.ring.try_push(4);
+            scheduler.spin();
+            TEST_EQUAL(consumer.wakeups, 1);
+            TEST_EQUAL(consumer.sum, 7);
+
+            consumer.ring.try_push(3);
+            scheduler.spin();
+            scheduler.spin();
+            TEST_TRUE(task.is_done());
+            TEST_EQUAL(consumer.wakeups, 2);
+
+            TEST_END;
+        }
+
+    } // private namespace
+
+    fiber::TestResult SpscRing_test(){
+        TEST_GROUP;
+
+        return fiber::TestResult()
+            | push_pop_wraps
+            | bulk
+            | awaitables
+            | consumer_task_suspends
+            ;
+    }
+}
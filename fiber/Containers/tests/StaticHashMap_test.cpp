@@ -0,0 +1,222 @@
+#include "StaticHashMap_test.hpp"
+
+// std
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+// fiber
+#include <fiber/Containers/StaticHashMap.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber{
+
+    namespace{
+
+        uint32_t xorshift(uint32_t& state){
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+
+        /// sends every key into one of four home slots, so that clusters form and elements have to move
+        struct CollidingHash{
+            constexpr std::size_t operator()(int key) const {return static_cast<std::size_t>(key % 4);}
+        };
+
+        struct StringHash{
+            using is_transparent = void;
+            std::size_t operator()(std::string_view key) const {return std::hash<std::string_view>()(key);}
+        };
+
+        struct Counted{
+            static int alive;
+            int value = 0;
+
+            Counted(int value) : value(value){++alive;}
+            Counted(const Counted& other) : value(other.value){++alive;}
+            ~Counted(){--alive;}
+        };
+
+        int Counted::alive = 0;
+
+        fiber::TestResult insert_find_erase(){
+            TEST_START;
+
+            StaticHashMap<int, int, 8> map;
+            TEST_TRUE(map.empty());
+            TEST_TRUE(map.try_emplace(1, 10).second);
+            TEST_TRUE(map.try_emplace(2, 20).second);
+            TEST_TRUE(map.insert({3, 30}).second);
+            TEST_FALSE(map.try_emplace(1, 99).second);
+            TEST_EQUAL(map.size(), 3);
+            TEST_EQUAL(map.at(1), 10);
+
+            TEST_FALSE(map.insert_or_assign(2, 21).second);
+            TEST_EQUAL(map.at(2), 21);
+            map[4] = 40;
+            TEST_EQUAL(map[4], 40);
+            TEST_EQUAL(map.size(), 4);
+
+            auto itr = map.find(3);
+            TEST_TRUE(itr != map.end());
+            TEST_EQUAL(itr->first, 3);
+            TEST_EQUAL(itr->second, 30);
+            TEST_TRUE(map.find(5) == map.end());
+
+            TEST_EQUAL(map.erase(3), 1);
+            TEST_EQUAL(map.erase(3), 0);
+            TEST_FALSE(map.contains(3));
+            TEST_THROW(map.at(3));
+
+            int sum = 0;
+            for(const auto& [key, value] : map) sum += key + value;
+            TEST_EQUAL(sum, 1 + 10 + 2 + 21 + 4 + 40);
+
+            map.erase(map.find(1));
+            TEST_FALSE(map.contains(1));
+            TEST_EQUAL(map.size(), 2);
+
+            TEST_END;
+        }
+
+        fiber::TestResult full_with_collisions(){
+            TEST_START;
+
+            StaticHashMap<int, int, 16, CollidingHash> map;
+            for(int key = 0; key < 16; ++key) TEST_TRUE(map.try_emplace(key, key * 2).second);
+            TEST_TRUE(map.full());
+            TEST_THROW(map.try_emplace(16, 0));
+            TEST_FALSE(map.try_emplace(5, 0).second);
+            TEST_FALSE(map.contains(16));
+            for(int key = 0; key < 16; ++key) TEST_EQUAL(map.at(key), key * 2);
+
+            for(int key = 0; key < 16; key += 2) TEST_EQUAL(map.erase(key), 1);
+            for(int key = 0; key < 16; ++key) TEST_EQUAL(map.contains(key), (key % 2) == 1);
+
+            TEST_END;
+        }
+
+        fiber::TestResult heterogeneous_lookup(){
+            TEST_START;
+
+            StaticHashMap<std::string, int, 8, StringHash, std::equal_to<>> map;
+            map.try_emplace(std::string("scheduler"), 1);
+            map.try_emplace("timer", 2);
+
+            const std::string_view key = "timer";
+            TEST_TRUE(map.contains(key));
+            TEST_EQUAL(map.at(key), 2);
+            TEST_EQUAL(map.find(std::string_view("scheduler"))->second, 1);
+            TEST_EQUAL(map.erase(key), 1);
+            TEST_FALSE(map.contains("timer"));
+
+            TEST_END;
+        }
+
+        fiber::TestResult erase_if_and_lifetime(){
+            TEST_START;
+
+            {
+                StaticHashMap<int, Counted, 32, CollidingHash> map;
+                for(int key = 0; key < 24; ++key) map.try_emplace(key, key);
+                TEST_EQUAL(Counted::alive, 24);
+
+                int calls = 0;
+                const std::size_t n_erased = map.erase_if([&](const auto& element){
+                    ++calls;
+                    return element.second.value % 3 == 0;
+                });
+                TEST_EQUAL(calls, 24);
+                TEST_EQUAL(n_erased, 8);
+                TEST_EQUAL(map.size(), 16);
+                TEST_EQUAL(Counted::alive, 16);
+                for(int key = 0; key < 24; ++key) TEST_EQUAL(map.contains(key), (key % 3) != 0);
+            }
+            TEST_EQUAL(Counted::alive, 0);
+
+            TEST_END;
+        }
+
+        constexpr int constexpr_lookup(){
+            StaticHashMap<int, int, 8, CollidingHash> map;
+            for(int key = 0; key < 6; ++key) map.try_emplace(key, key * key);
+            map.erase(2);
+            return map.at(5) + static_cast<int>(map.size()) + (map.contains(2) ? 100 : 0);
+        }
+
+        static_assert(constexpr_lookup() == 25 + 5);
+
+        fiber::TestResult random_against_array(){
+            TEST_START;
+
+            constexpr int n_keys = 96;
+            StaticHashMap<int, int, 64, CollidingHash> map;
+            std::array<int, n_keys> values{};
+            std::array<bool, n_keys> present{};
+            std::size_t size = 0;
+            uint32_t state = 0x5EED;
+
+            for(int i = 0; i < 5000; ++i){
+                const uint32_t random = xorshift(state);
+                const int key = static_cast<int>((random >> 4) % n_keys);
+                const int value = static_cast<int>(random >> 16);
+                const std::size_t k = static_cast<std::size_t>(key);
+                if(random % 64 == 0){
+                    // erase the odd values, every element has to be visited exactly once
+                    std::size_t calls = 0;
+                    const std::size_t n_erased = map.erase_if([&](const auto& element){
+                        ++calls;
+                        return element.second % 2 != 0;
+                    });
+                    TEST_EQUAL(calls, size);
+                    std::size_t expected = 0;
+                    for(std::size_t j = 0; j < present.size(); ++j){
+                        if(present[j] && values[j] % 2 != 0){
+                            present[j] = false;
+                            ++expected;
+                        }
+                    }
+                    TEST_EQUAL(n_erased, expected);
+                    size -= expected;
+                }else if(random % 3 != 0){
+                    if(!present[k] && size == map.capacity()) continue;
+                    const bool inserted = map.insert_or_assign(key, value).second;
+                    TEST_EQUAL(inserted, !present[k]);
+                    if(inserted) ++size;
+                    present[k] = true;
+                    values[k] = value;
+                }else{
+                    TEST_EQUAL(map.erase(key), present[k] ? 1 : 0);
+                    if(present[k]) --size;
+                    present[k] = false;
+                }
+                TEST_EQUAL(map.size(), size);
+            }
+
+            for(int key = 0; key < n_keys; ++key){
+                const std::size_t k = static_cast<std::size_t>(key);
+                TEST_EQUAL(map.contains(key), present[k]);
+                if(present[k]) TEST_EQUAL(map.at(key), values[k]);
+            }
+
+            TEST_END;
+        }
+
+    } // private namespace
+
+    fiber::TestResult StaticHashMap_test(){
+        TEST_GROUP;
+
+        return fiber::TestResult()
+            | insert_find_erase
+            | full_with_collisions
+            | heterogeneous_lookup
+            | erase_if_and_lifetime
+            | random_against_array
+            ;
+    }
+}
@@ -1,9 +1,25 @@
 target_sources(fiber
     PUBLIC
         ${CMAKE_CURRENT_LIST_DIR}/ArrayList_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/BipBuffer_test.hpp
         ${CMAKE_CURRENT_LIST_DIR}/DualArrayList_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/DualPriorityQueue_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/IntrusiveList_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/IntrusivePairingHeap_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/PriorityQueue_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/SmallArrayList_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/SpscRing_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/StaticHashMap_test.hpp
 
     PRIVATE
         ${CMAKE_CURRENT_LIST_DIR}/ArrayList_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/BipBuffer_test.cpp
         ${CMAKE_CURRENT_LIST_DIR}/DualArrayList_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/DualPriorityQueue_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/IntrusiveList_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/IntrusivePairingHeap_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/PriorityQueue_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/SmallArrayList_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/SpscRing_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/StaticHashMap_test.cpp
 )
\ No newline at end of file
@@ -55,4 +55,11 @@
 #else
     #define FIBER_WEAK
     #warning "FIBER_WEAK not defined for this compiler. Please file an issue at the repository, state the compiler you use and how one defines weak symbols for it."
-#endif
\ No newline at end of file
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    // allows word wise access to memory of any type without violating strict aliasing
+    #define FIBER_MAY_ALIAS __attribute__((may_alias))
+#else
+    #define FIBER_MAY_ALIAS
+#endif
@@ -2,6 +2,7 @@
 #pragma once
 
 #include <cstdint>
+#include <type_traits>
 
 namespace fiber
 {
@@ -61,5 +62,25 @@ namespace fiber
     struct make_fast<SInt>{ 
         using type = int_fast64_t; 
     };
-    
+
+// ---------------------------------------------------------------------------
+//                          is_trivially_relocatable
+// ---------------------------------------------------------------------------
+
+    /**
+     * @brief `true` if moving an object to a new address and ending the lifetime of the old one is the same as copying its bytes
+     *
+     * Containers like `fiber::ArrayList` shift such elements with a single `memmove` instead of moving them one by one.
+     * Defaults to `std::is_trivially_copyable`. Types that own resources but do not point to themselves
+     * (no pointers into their own storage, no registration of their address) may specialise it:
+     * ```C++
+     * template<> struct fiber::is_trivially_relocatable<MyHandle> : std::true_type {};
+     * ```
+     */
+    template<class T>
+    struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>>{};
+
+    template<class T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
 } // namespace fiber
@@ -0,0 +1,262 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+// fiber
+#include <fiber/Exceptions/Exceptions.hpp>
+#include <fiber/Future/ContinuationNode.hpp>
+#include <fiber/Future/Future.hpp>
+
+#if !defined(FIBER_CONTINUATION_SIZE)
+    /// @brief Maximum size in bytes of a callable that is stored inline in a `fiber::Continuation`
+    #define FIBER_CONTINUATION_SIZE 16
+#endif
+
+namespace fiber{
+
+    template<class Source, class F>
+    class Continuation;
+
+    namespace detail{
+
+        template<class Source, class F>
+        class ContinuationStage;
+
+        template<class Source>
+        struct continuation_stage_traits;
+
+        template<class T>
+        struct continuation_stage_traits<Future<T>>{
+            using value_type = T;
+            using root_type = T;
+        };
+
+        template<class Source, class F>
+        struct continuation_stage_traits<ContinuationStage<Source, F>>{
+            using value_type = typename ContinuationStage<Source, F>::value_type;
+            using root_type = typename ContinuationStage<Source, F>::root_type;
+        };
+
+        /**
+         * \brief The steps of a pipeline: the future at its root and the callables.
+         *
+         * The callables are applied in one go once the root future has a value, so the intermediate results are passed on
+         * directly and never stored. A step costs the size of its callable, nothing for a lambda without captures.
+         */
+        template<class Source, class F>
+        class ContinuationStage{
+        public:
+            using source_type = typename continuation_stage_traits<Source>::value_type;
+            using root_type = typename continuation_stage_traits<Source>::root_type;
+            using value_type = std::remove_cvref_t<std::invoke_result_t<F&, source_type&&>>;
+
+        private:
+            Source _source;
+            [[no_unique_address]] F _callable;
+
+        public:
+            template<class G>
+            ContinuationStage(Source&& source, G&& callable)
+                : _source(std::move(source))
+                , _callable(std::forward<G>(callable)){}
+
+            /// @brief returns the future at the root of the pipeline
+            Future<root_type>& root(){
+                if constexpr (std::is_same_v<Source, Future<root_type>>){
+                    return this->_source;
+                }else{
+                    return this->_source.root();
+                }
+            }
+
+            /// @brief runs all callables up to this step with the value of the root future
+            value_type apply(root_type&& value){
+                if constexpr (std::is_same_v<Source, Future<root_type>>){
+                    return std::invoke(this->_callable, std::move(value));
+                }else{
+                    return std::invoke(this->_callable, this->_source.apply(std::move(value)));
+                }
+            }
+        };
+
+        template<class Source>
+        struct continuation_stage_of{
+            using type = Source;
+        };
+
+        template<class Source, class F>
+        struct continuation_stage_of<Continuation<Source, F>>{
+            using type = typename Continuation<Source, F>::stage_type;
+        };
+
+    } // namespace detail
+
+    /**
+     * \brief A light weight step that is run by the scheduler once its source is ready, without a task or coroutine frame of its own.
+     *
+     * Created with `Future::then(callable)` or `Continuation::then(callable)`. A pipeline is one object: the future at its root,
+     * the callables, one future that receives the result and one `ContinuationNode` for the scheduler.
+     * Each further step only adds the size of its callable, which is nothing for a lambda without captures,
+     * because the steps are run in one go and the intermediate results are passed on directly instead of being stored.
+     * Callables are limited to `FIBER_CONTINUATION_SIZE` bytes to keep the steps small.
+     *
+     * The result of the last step can be awaited through the future from `get_future()`.
+     * If the source is a broken promise, the callable is not run and the resulting future is broken as well.
+     *
+     * Example:
+     * ```cpp
+     * fiber::Future<uint32_t> crc = async_crc(data, length);
+     *
+     * auto pipeline = crc.then([](uint32_t crc){return ~crc;})
+     *                    .then([](uint32_t crc){return Frame(crc);});
+     *
+     * fiber::Future<Frame> frame = pipeline.get_future();
+     *
+     * // the scheduler runs the steps once the CRC is ready. Do not move or destroy the pipeline until it is done.
+     * scheduler.add(&pipeline);
+     * ```
+     *
+     * \tparam Source either a `fiber::Future` or a previous `fiber::Continuation`
+     * \tparam F a callable that accepts the value of the source and returns a non-void value
+     *
+     * \see fiber::Future::then()
+     * \see fiber::Scheduler::add(ContinuationNode*)
+     */
+    template<class Source, class F>
+    class Continuation : public ContinuationNode{
+    public:
+        using stage_type = detail::ContinuationStage<typename detail::continuation_stage_of<Source>::type, F>;
+        using source_type = typename stage_type::source_type;
+        using value_type = typename stage_type::value_type;
+
+        static_assert(sizeof(F) <= FIBER_CONTINUATION_SIZE, "The callable of the continuation is too large. S: Capture less, capture by reference or increase `FIBER_CONTINUATION_SIZE`.");
+        static_assert(!std::is_void_v<value_type>, "The callable of a continuation has to return a value");
+
+    private:
+        enum class State{
+            Busy,   ///< waits on the source
+            HasValue,   ///< the callable ran and the value can be read
+            BrokenPromise, ///< the source was broken
+        };
+
+        /// a `fiber::Future` needs a default constructible value, without one the result can only be passed on to the next step
+        static constexpr bool has_result = std::is_default_constructible_v<value_type>;
+        struct NoResult{};
+
+        stage_type _stage;
+        [[no_unique_address]] std::conditional_t<has_result, Future<value_type>, NoResult> _future; // receives the result, until `get_future()` hands it out
+        [[no_unique_address]] std::conditional_t<has_result, Promise<value_type>, NoResult> _promise;
+        State _state = State::Busy;
+        bool _has_future = false;
+
+        template<class, class>
+        friend class Continuation;
+
+        template<class T>
+        static Future<T>&& take_stage(Future<T>& future){return std::move(future);}
+
+        template<class S, class G>
+        static typename Continuation<S, G>::stage_type&& take_stage(Continuation<S, G>& previous){
+            FIBER_ASSERT_O1_MSG(!previous._has_future, "The result of this continuation is already passed to a future. S: Call `get_future()` on the last step only.");
+            return std::move(previous._stage);
+        }
+
+        static bool handle(ContinuationNode& node, Operation operation){
+            Continuation& continuation = static_cast<Continuation&>(node);
+            return (operation == Operation::Poll) ? continuation.poll() : continuation.subscribe();
+        }
+
+    public:
+
+        /// @brief takes the steps of `source`, a future or the previous continuation, and appends `callable`
+        template<class G>
+        Continuation(Source&& source, G&& callable)
+            : ContinuationNode(&Continuation::handle)
+            , _stage(Continuation::take_stage(source), std::forward<G>(callable))
+        {
+            if constexpr (has_result){
+                auto [future, promise] = make_future_promise<value_type>();
+                this->_future = std::move(future);
+                this->_promise = std::move(promise);
+            }
+        }
+
+        /// @brief moves an unregistered continuation
+        Continuation(Continuation&&) = default;
+
+        /**
+         * @brief Chains another step that runs with the result of this one
+         *
+         * Moves the steps of this continuation into the new one. Only the returned, outermost continuation has to be added to a scheduler.
+         */
+        template<class G>
+        [[nodiscard]]Continuation<Continuation, std::decay_t<G>> then(G&& callable){
+            return Continuation<Continuation, std::decay_t<G>>(std::move(*this), std::forward<G>(callable));
+        }
+
+        /**
+         * @brief Returns the future that receives the result of this continuation
+         *
+         * Can only be called once and only on the last step of a pipeline.
+         * The value is set directly in the future, it is not copied.
+         */
+        [[nodiscard]]Future<value_type> get_future(){
+            static_assert(has_result, "A future needs a default constructible value. S: Chain a step that converts the value.");
+            FIBER_ASSERT_O1_MSG(!this->_has_future, "`get_future()` can only be called once per continuation.");
+            this->_has_future = true;
+            return std::move(this->_future);
+        }
+
+        /// @brief returns `true` once the continuation has run or its source has been broken
+        [[nodiscard]]bool is_done() const {return this->_state != State::Busy;}
+
+        /// @brief returns `true` if the callable ran and produced a value
+        [[nodiscard]]bool is_ready() const {return this->_state == State::HasValue;}
+
+        /// @brief returns `true` if the source has been broken and the callable will never run
+        [[nodiscard]]bool is_broken_promise() const {return this->_state == State::BrokenPromise;}
+
+        /// @brief returns the value, or a `nullptr` if the callable did not run (yet), its value has been handed out with `get_future()` or is not default constructible
+        value_type* value_if(){
+            if constexpr (has_result){
+                return this->_has_future ? nullptr : this->_future.get_if();
+            }else{
+                return nullptr;
+            }
+        }
+
+        /**
+         * @brief Polls the root future and runs all callables once it has a value
+         * @returns `true` if the continuation is done
+         */
+        bool poll(){
+            if(this->_state != State::Busy){return true;}
+            Future<typename stage_type::root_type>& root = this->_stage.root();
+            if(!root.await_ready()){return false;}
+
+            typename stage_type::root_type* root_value = root.is_ready() ? root.get_if() : nullptr;
+            if(root_value == nullptr){
+                this->_state = State::BrokenPromise;
+                if constexpr (has_result){this->_promise = Promise<value_type>();} // break the promise
+            }else{
+                this->_state = State::HasValue;
+                if constexpr (has_result){
+                    this->_promise.set_value(this->_stage.apply(std::move(*root_value)));
+                }else{
+                    this->_stage.apply(std::move(*root_value));
+                }
+            }
+            return true;
+        }
+
+        /// @brief subscribes this continuation at the future at the root of the pipeline
+        bool subscribe(){
+            return this->_stage.root().subscribe(this);
+        }
+    };
+
+} // namespace fiber
@@ -0,0 +1,153 @@
+#pragma once
+
+// std
+#ifdef FIBER_MULTI_CORE
+    #include <atomic>
+#endif
+#include <cstddef>
+
+// fiber
+#include <fiber/interrupts/interrupts.hpp>
+
+namespace fiber{
+
+    class ContinuationList;
+
+    /**
+     * \brief Base of all continuations, so that the scheduler can keep the ready ones in an intrusive list.
+     *
+     * A continuation subscribes at the future at the root of its pipeline. Keeping or breaking the promise of that future
+     * pushes the continuation into the ready list of its scheduler, so the scheduler never polls continuations that still wait.
+     *
+     * \see fiber::Continuation
+     * \see fiber::ContinuationList
+     */
+    class ContinuationNode{
+    public:
+        enum class Operation{
+            Poll,       ///< runs `poll()` of the derived continuation
+            Subscribe,  ///< runs `subscribe()` of the derived continuation
+        };
+
+        /// @brief casts the node back to the derived continuation and runs the operation, one function per continuation type instead of a vtable
+        using Handler = bool(*)(ContinuationNode& node, Operation operation);
+
+    private:
+        Handler _handler;
+        ContinuationNode* _next = nullptr;
+        ContinuationList* _ready_list = nullptr;
+
+        friend class ContinuationList;
+
+    public:
+        explicit ContinuationNode(Handler handler) : _handler(handler){}
+
+        /// @brief does not copy the registration into the scheduler
+        ContinuationNode(const ContinuationNode& other) : _handler(other._handler){}
+
+        /// @brief does not copy the registration into the scheduler
+        ContinuationNode& operator=(const ContinuationNode& other){
+            this->_handler = other._handler;
+            return *this;
+        }
+
+        /**
+         * @brief runs the continuation if its source became ready
+         * @returns `true` if the continuation is done - it either ran or its source has been broken.
+         */
+        bool poll(){return this->_handler(*this, Operation::Poll);}
+
+        /**
+         * @brief Subscribes this continuation at the future at the root of its pipeline, so that completing the future calls `notify()`
+         * @returns `false` if the future already completed and will not notify
+         */
+        bool subscribe(){return this->_handler(*this, Operation::Subscribe);}
+
+        /// @brief pushes this continuation into the ready list of its scheduler, called once the future it subscribed at completed
+        inline void notify();
+    };
+
+    /**
+     * \brief An intrusive, singly linked list of continuations whose futures completed.
+     *
+     * Used by the `fiber::Scheduler` so that continuations cost no storage in the scheduler itself.
+     * Continuations are pushed when their promise is kept or broken, which may happen in an interrupt or, with `FIBER_MULTI_CORE`, on another core.
+     * In single core mode the list is protected by briefly disabling interrupts, in multi core mode pushing is lock-free.
+     */
+    class ContinuationList{
+    private:
+        #ifdef FIBER_MULTI_CORE
+            std::atomic<ContinuationNode*> _head = nullptr;
+        #else
+            ContinuationNode* volatile _head = nullptr;
+        #endif
+
+    public:
+
+        /**
+         * @brief Adds a continuation that will be pushed into this list once its future completes
+         *
+         * The continuation may not be moved or destroyed until it is done.
+         */
+        void add(ContinuationNode* continuation){
+            continuation->_ready_list = this;
+            if(!continuation->subscribe()){this->push(continuation);}
+        }
+
+        /// @brief pushes a continuation that is ready to run
+        void push(ContinuationNode* continuation){
+            #ifdef FIBER_MULTI_CORE
+                ContinuationNode* head = this->_head.load(std::memory_order_relaxed);
+                do{
+                    continuation->_next = head;
+                }while(!this->_head.compare_exchange_weak(head, continuation, std::memory_order_release, std::memory_order_relaxed));
+            #else
+                InterruptGuard guard;
+                continuation->_next = this->_head;
+                this->_head = continuation;
+            #endif
+        }
+
+        /**
+         * @brief Polls the continuations that got ready since the last call and removes the ones that are done
+         *
+         * A continuation that is not done yet subscribes again. Continuations pushed while polling are run by the next call.
+         *
+         * @returns the number of continuations that are done
+         */
+        std::size_t poll(){
+            #ifdef FIBER_MULTI_CORE
+                ContinuationNode* continuation = this->_head.exchange(nullptr, std::memory_order_acquire);
+            #else
+                ContinuationNode* continuation = nullptr;
+                {
+                    InterruptGuard guard;
+                    continuation = this->_head;
+                    this->_head = nullptr;
+                }
+            #endif
+
+            std::size_t n_done = 0;
+            while(continuation != nullptr){
+                ContinuationNode* next = continuation->_next;
+                continuation->_next = nullptr;
+                if(continuation->poll()){
+                    ++n_done;
+                }else{
+                    // in multi core mode the promise may close the subscription shortly before it publishes the value
+                    this->add(continuation);
+                }
+                continuation = next;
+            }
+            return n_done;
+        }
+
+        /// @brief returns `true` if no continuation is ready
+        bool empty() const {return this->_head == nullptr;}
+    };
+
+    inline void ContinuationNode::notify(){
+        this->_ready_list->push(this);
+    }
+
+} // namespace fiber
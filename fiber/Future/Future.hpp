@@ -3,6 +3,7 @@
 // std
 #ifdef FIBER_MULTI_CORE
     #include <atomic>
+    #include <cstdint>
 #endif
 #include <coroutine>
 #include <tuple>
@@ -10,6 +11,7 @@
 
 // fiber
 #include <fiber/Exceptions/Exceptions.hpp>
+#include <fiber/Future/ContinuationNode.hpp>
 #include <fiber/interrupts/interrupts.hpp>
 
 namespace fiber{    
@@ -23,12 +25,21 @@ namespace fiber{
     template<class T>
     class Promise;
 
+    template<class Source, class F>
+    class Continuation;
+
     /**
      * \brief Future and Promise pairs are used to synchronise values between asynchronous tasks.
      * 
      * If you are on a multi core bare-metal embedded system
-     * you can set the `FIBER_MULTI_CORE` definiteion flag that will enable safeguards and lock mechanisms - smaller binary and faster execution. 
-     * In single core mode (`FIBER_MULTI_CORE=OFF`), it will then remove all the locks and logic that is needed for multi-core thread safety.
+     * you can set the `FIBER_MULTI_CORE` definiteion flag that will enable safeguards for multi-core thread safety.
+     * In single core mode (`FIBER_MULTI_CORE=OFF`), critical sections are protected by briefly disabling interrupts - smaller binary and faster execution.
+     * 
+     * In multi core mode the connection state and the back-pointer of each side are held in a single atomic word
+     * that is only updated with compare-and-swap operations. No interrupts are masked and no spin locks are held:
+     * completing a promise (`set_value()`) from an interrupt service routine or another core never waits on the future side.
+     * Only moving or destroying a future while its promise is being completed or moved will wait for the few instructions it takes
+     * to publish the value or the new location.
      * 
      * Example: one wants to copy data asynchronously (for example with a DMA controller) while doing some computations in the mean time.
      * ```cpp
@@ -45,7 +56,7 @@ namespace fiber{
      *      // ...
      *      // ... some math ...
      *      // ...
-     *      
+     * 
      *      // later you you want to get the value from the future - aka. the CRC calculation you call:
      *      int crc = future_crc.get(); // the method waits and blocks this thread until the future value is ready
      * 
@@ -67,139 +78,80 @@ namespace fiber{
                 BrokenPromise, ///< signals that the promise was not kept --> throws an exception
             };
 
-            enum class Lock{
-                Open,   ///< the lock is open and can be acquired
-                Closed, ///< the lock is closed and cannot be acquired
-            };
-            
-            Promise<T>* _promisePtr = nullptr;
             T _value;
 
             #ifdef FIBER_MULTI_CORE
-                std::atomic<State> _state = State::BrokenPromise; // volatile because this will be set by a different threat.
-                std::atomic<Lock> _lock = Lock::Open;
+                /*
+                Link word encoding:
+                    - Busy:             `Promise<T>*` | moving_bit
+                    - HasValue:         finished_bit | value_bit
+                    - BrokenPromise:    finished_bit
+                The moving_bit is set while the future is being moved or destroyed and holds a reference to the promise it points to.
+                */
+                static constexpr std::uintptr_t moving_bit = 0b001;
+                static constexpr std::uintptr_t finished_bit = 0b010;
+                static constexpr std::uintptr_t value_bit = 0b100;
+
+                std::atomic<std::uintptr_t> _link = finished_bit;
+
+                /*
+                Subscription encoding:
+                    - none:             0
+                    - subscribed:       `ContinuationNode*`
+                    - closed:           closed_subscription, the promise completed or is about to publish its result
+                */
+                static constexpr std::uintptr_t closed_subscription = 0b001;
+
+                std::atomic<std::uintptr_t> _continuation = 0;
             #else
+                Promise<T>* _promisePtr = nullptr;
                 volatile State _state = State::BrokenPromise; // volatile because this will be set by a different threat.
+                ContinuationNode* _continuation = nullptr; // notified once the promise completes
             #endif
 
             friend class Promise<T>;
+
+            template<class Source, class F>
+            friend class Continuation;
         public:
-    
+
             friend FuturePromisePair<T> make_future_promise<T>();
 
             Future() = default;
             Future(const Future&) = delete;
             Future& operator=(const Future&) = delete;
 
+            /// @brief Thread and interrupt save move that re-registers the back-pointer of the promise
             Future& operator=(Future&& oldFuture){
                 if(this != &oldFuture){
-                    // detatch this
-                    if(this->_promisePtr){
-                        this->acquire_dual_locks();
-                        this->detatch_release_dual_locks();
-                    }
-
-                    switch(oldFuture.state()){
-                        case State::Busy:{
-                            // aquire old locks
-                            oldFuture.acquire_dual_locks();
-                            this->_promisePtr = oldFuture._promisePtr;
-                            this->set_state(oldFuture.state()) ;
-                            this->_value = std::move(oldFuture._value);
-
-                            // re-register
-                            if(this->is_waiting() && (this->_promisePtr != nullptr)){
-                                this->_promisePtr->_futurePtr = this;
-                            }
-
-                            // transfere locks
-                            #ifdef FIBER_MULTI_CORE
-                                this->_lock.store(oldFuture._lock.load(std::memory_order_acquire), std::memory_order_release);
-                            #endif
-
-                            // invalidate oldFuture
-                            oldFuture._promisePtr = nullptr;
-                            oldFuture.set_state(State::BrokenPromise);
-                            #ifdef FIBER_MULTI_CORE
-                                oldFuture._lock.store(Lock::Open, std::memory_order_release);
-                            #endif
-
-                            // handover complete, this has to release the lock now
-                            this->release_dual_locks();
-                        }break;
-                        case State::HasValue : {
-                            this->_value = std::move(oldFuture._value);
-                            this->set_state(State::HasValue);
-                        }break;
-                        case State::BrokenPromise : {
-                            this->set_state(State::BrokenPromise);
-                        }break;
-                    }
-                    
+                    this->detatch();
+                    this->take_over(oldFuture);
                 }
                 return *this;
             }
-            /// @brief Thread and interrupt save move that re-registers stack pointer in between the future and the promise
+
+            /// @brief Thread and interrupt save move that re-registers the back-pointer of the promise
             Future(Future&& oldFuture){
-                
-                switch(oldFuture.state()){
-                    case State::Busy:{
-                        // aquire old locks
-                        oldFuture.acquire_dual_locks();
-                        this->_promisePtr = oldFuture._promisePtr;
-                        this->set_state(oldFuture.state()) ;
-                        this->_value = std::move(oldFuture._value);
-
-                        // re-register
-                        if(this->is_waiting() && (this->_promisePtr != nullptr)){
-                            this->_promisePtr->_futurePtr = this;
-                        }
-
-                        // transfere locks
-                        #ifdef FIBER_MULTI_CORE
-                            this->_lock.store(oldFuture._lock.load(std::memory_order_acquire), std::memory_order_release);
-                        #endif
-
-                        // invalidate oldFuture
-                        oldFuture._promisePtr = nullptr;
-                        oldFuture.set_state(State::BrokenPromise);
-                        #ifdef FIBER_MULTI_CORE
-                            oldFuture._lock.store(Lock::Open, std::memory_order_release);
-                        #endif
-
-                        // handover complete, this has to release the lock now
-                        this->release_dual_locks();
-                    }break;
-                    case State::HasValue : {
-                        this->_value = std::move(oldFuture._value);
-                        this->set_state(State::HasValue);
-                    }break;
-                    case State::BrokenPromise : {
-                        this->set_state(State::BrokenPromise);
-                    }break;
-                }
-                    
-                
-                
+                this->take_over(oldFuture);
             }
 
             ~Future(){
-                if(this->_promisePtr){
-                    // detatch from the promise
-                    this->acquire_dual_locks();
-                    this->detatch_release_dual_locks();
-                }
+                this->detatch();
             }
 
-            inline bool is_connected() const {return this->_promisePtr != nullptr;}
-            inline bool is_detatched() const {return this->_promisePtr == nullptr;}
+            inline bool is_connected() const {return this->state() == State::Busy;}
+            inline bool is_detatched() const {return this->state() != State::Busy;}
 
             /**
              * @brief Checks if the promise is connected to the future
              * @returns `true` if the passed promise is the one connected to this future
              */
             inline bool is_connected_to(const Promise<T>& promise) const {
-                const bool result = this->_promisePtr == &promise;
+                #ifdef FIBER_MULTI_CORE
+                    const bool result = promise_of(this->_link.load(std::memory_order_acquire)) == &promise;
+                #else
+                    const bool result = this->_promisePtr == &promise;
+                #endif
                 return result;
             }
 
@@ -207,7 +159,7 @@ namespace fiber{
              * \brief Blocks the current thread until the value is ready or an error occured.
              */
             void wait() {while(this->is_waiting()){/* Do Nothing */}}
-    
+
             /**
              * \brief returns the value of the future and waits if necessary
              * \throws Exception of type fiber::Exception if an error occured.
@@ -232,33 +184,19 @@ namespace fiber{
                     return nullptr;
                 }
             }
-    
+
             [[nodiscard]]inline State get_state() const {
-                #ifdef FIBER_MULTI_CORE
-                    return this->_state.load(std::memory_order_acquire);
-                #else
-                    return this->_state;
-                #endif
+                return this->state();
             }
-        
+
             inline State state() const {
                 #ifdef FIBER_MULTI_CORE
-                    return this->_state.load(std::memory_order_acquire);
+                    return decode(this->_link.load(std::memory_order_acquire));
                 #else
                     return this->_state;
                 #endif
             }
 
-        private:
-            inline void set_state(State state) {
-                #ifdef FIBER_MULTI_CORE
-                    this->_state.store(state, std::memory_order_release);
-                #else
-                    this->_state = state;
-                #endif
-            }
-        public:
-
             /// \brief returns true if the value is ready to read 
             [[nodiscard]]constexpr bool is_ready() const {return this->get_state() == State::HasValue;}
 
@@ -267,7 +205,7 @@ namespace fiber{
 
             /// @brief returns true if the result is not finished yet and one has to wait
             [[nodiscard]]constexpr bool is_waiting() const {return this->get_state() == State::Busy;}
-    
+
             /**
              * \brief return true if the promise was not kept
              * 
@@ -275,7 +213,7 @@ namespace fiber{
              * If this happens an Exception (Derived from std::exception) will be thrown.
              */
             [[nodiscard]]constexpr bool is_broken_promise() const {return this->get_state() == State::BrokenPromise;}
-    
+
             /**
              * @brief `co_await` interoperability, returns true, if the future is no longer waiting.
              * 
@@ -288,7 +226,7 @@ namespace fiber{
             constexpr bool await_ready() const noexcept {
                 return !this->is_waiting();
             }
-            
+
             /**
              * @brief `co_await` interoperability and optionally returns a value if one has been set.
              * 
@@ -301,79 +239,155 @@ namespace fiber{
                     return std::nullopt;
                 }
             }
-            
+
+            /**
+             * @brief Creates a continuation that runs `callable` with the value of this future once it is ready
+             *
+             * The future is moved into the returned continuation. The continuation has to be added to a scheduler,
+             * which runs it without a task of its own. Chain further steps with `.then()` and receive the final
+             * result with `.get_future()`.
+             *
+             * @see fiber::Continuation
+             */
+            template<class F>
+            [[nodiscard]]Continuation<Future, std::decay_t<F>> then(F&& callable){
+                return Continuation<Future, std::decay_t<F>>(std::move(*this), std::forward<F>(callable));
+            }
+
         private:
 
-            /// \brief Used by the Future to set the lock for a critical section that affect both the future and the promise
-            /// \details Disables interrupts. Acquires own lock. Forcefully spins until the Promise lock becomes available.
-            void acquire_dual_locks() {
-                // return early - no need to lock if the future is detatched from the promise
-                if(this->_promisePtr == nullptr){return;}
-                
-                fiber::disable_interrupts();
+        #ifdef FIBER_MULTI_CORE
 
-                #ifdef FIBER_MULTI_CORE
-                    // lock its own lock
-                    while (_lock.exchange(Lock::Closed, std::memory_order_acquire) != Lock::Open) {/* spin */}
-
-                    // double check - because there might have been an interrupt between the first check and the disabling of the interrupt
-                    if(this->_promisePtr == nullptr){
-                        //cleanup if value changed
-
-                        // release own lock
-                        this->_lock.store(Lock::Open, std::memory_order_release);
-                        
-                        // re-enable interrupts
-                        fiber::enable_interrupts();
+            static constexpr State decode(std::uintptr_t link){
+                if(link & finished_bit){
+                    return (link & value_bit) ? State::HasValue : State::BrokenPromise;
+                }
+                return State::Busy;
+            }
+
+            static Promise<T>* promise_of(std::uintptr_t link){
+                return (link & finished_bit) ? nullptr : reinterpret_cast<Promise<T>*>(link & ~moving_bit);
+            }
+
+            /// \brief links this (fresh) future to the promise
+            void connect(Promise<T>& promise){
+                static_assert(alignof(Promise<T>) >= 4, "The two lowest bits of the promise address are used as flags");
+                this->_continuation.store(0, std::memory_order_relaxed);
+                this->_link.store(reinterpret_cast<std::uintptr_t>(&promise), std::memory_order_relaxed);
+            }
+
+            /**
+             * \brief Lets the promise notify `continuation` once it has been kept or broken
+             * \returns `false` if the future already completed or the promise is about to publish its result, the continuation will not be notified
+             */
+            bool subscribe(ContinuationNode* continuation){
+                const std::uintptr_t node = reinterpret_cast<std::uintptr_t>(continuation);
+                std::uintptr_t expected = 0;
+                if(!this->_continuation.compare_exchange_strong(expected, node, std::memory_order_acq_rel, std::memory_order_acquire)){
+                    return false;
+                }
+                if(this->_link.load(std::memory_order_acquire) & finished_bit){
+                    // finished without a promise that notifies: take the subscription back, unless the promise closed it in the mean time
+                    expected = node;
+                    return !this->_continuation.compare_exchange_strong(expected, 0, std::memory_order_acq_rel, std::memory_order_acquire);
+                }
+                return true;
+            }
+
+            /// \brief Marks this future as moving and returns the connected promise, or `nullptr` if the future already finished
+            Promise<T>* begin_move(){
+                std::uintptr_t link = this->_link.load(std::memory_order_acquire);
+                do{
+                    if(link & finished_bit){return nullptr;}
+                }while(!this->_link.compare_exchange_weak(link, link | moving_bit, std::memory_order_acq_rel, std::memory_order_acquire));
+                return promise_of(link);
+            }
+
+            /// \brief Moves the connection or the result of `other` into this detatched future
+            void take_over(Future& other){
+                Promise<T>* promise = other.begin_move();
+                while(promise != nullptr){
+                    // publish this future before the promise can see it
+                    this->connect(*promise);
+                    if(promise->redirect(&other, this)){
+                        other._link.store(finished_bit, std::memory_order_release);
                         return;
                     }
 
-                    // lock the promises lock
-                    while (this->_promisePtr->_lock.exchange(Promise<T>::Lock::Closed, std::memory_order_acquire) != Promise<T>::Lock::Open) {/* spin */}
-                #endif
-                // successfully acquired both locks
+                    // the promise has been kept or moved away while `other` was moving: let the old one go and follow
+                    promise->acknowledge();
+                    promise = other.begin_move();
+                }
+
+                // finished: take over the result, `other` keeps its state
+                const std::uintptr_t link = other._link.load(std::memory_order_acquire);
+                if(link & value_bit){this->_value = std::move(other._value);}
+                this->_link.store(link, std::memory_order_release);
             }
-            
-            /// \brief Used by the Future to set the lock for a critical section
-            void release_dual_locks() {
-                #ifdef FIBER_MULTI_CORE
-                    // release the lock of the promise
-                    if(this->_promisePtr != nullptr){
-                        this->_promisePtr->_lock.store(Promise<T>::Lock::Open,  std::memory_order_release);
+
+            /// \brief disconnects the future from the promise
+            void detatch(){
+                Promise<T>* promise = this->begin_move();
+                while(promise != nullptr){
+                    if(promise->redirect(this, nullptr)){
+                        this->_link.store(finished_bit, std::memory_order_release);
+                        return;
                     }
-                    // release the lock of this future
-                    this->_lock.store(Lock::Open, std::memory_order_release);
-                #endif
-                if(this->_promisePtr != nullptr){
-                    fiber::enable_interrupts();
+                    promise->acknowledge();
+                    promise = this->begin_move();
                 }
             }
 
-            /// \brief releases the locks and sets the pointers of the future and promise to each other to nullptr
-            void detatch_release_dual_locks() {
-                #ifdef FIBER_MULTI_CORE
-                    // release the lock of the promise
-                    if(this->_promisePtr != nullptr){
-                        this->_promisePtr->_futurePtr = nullptr; /// !!! only time allowed to clear the future pointer
-                        this->_promisePtr->_lock.store(Promise<T>::Lock::Open,  std::memory_order_release);
-                        
-                        // release the lock of this future
-                        this->_lock.store(Lock::Open, std::memory_order_release);
-
-                        // re-enable interrupts
-                        fiber::enable_interrupts();
+        #else
+
+            /// \brief links this (fresh) future to the promise
+            void connect(Promise<T>& promise){
+                this->_promisePtr = &promise;
+                this->_state = State::Busy;
+                this->_continuation = nullptr;
+            }
+
+            /**
+             * \brief Lets the promise notify `continuation` once it has been kept or broken
+             * \returns `false` if the future already completed, the continuation will not be notified
+             */
+            bool subscribe(ContinuationNode* continuation){
+                InterruptGuard guard;
+                if(this->_promisePtr == nullptr){return false;}
+                this->_continuation = continuation;
+                return true;
+            }
+
+            /// \brief Moves the connection or the result of `other` into this detatched future
+            void take_over(Future& other){
+                if(other._promisePtr != nullptr){
+                    InterruptGuard guard;
+
+                    // double check - the promise might have been kept before the interrupts were disabled
+                    if(other._promisePtr != nullptr){
+                        this->connect(*other._promisePtr);
+                        this->_promisePtr->_futurePtr = this;
+                        other._promisePtr = nullptr;
+                        other._state = State::BrokenPromise;
+                        return;
                     }
+                }
+                if(other.state() == State::HasValue){this->_value = std::move(other._value);}
+                this->_state = other.state();
+            }
 
-                #else
+            /// \brief disconnects the future from the promise
+            void detatch(){
+                if(this->_promisePtr != nullptr){
+                    InterruptGuard guard;
                     if(this->_promisePtr != nullptr){
                         this->_promisePtr->_futurePtr = nullptr;
-                        fiber::enable_interrupts();
                         this->_promisePtr = nullptr; // !!! only time allowed to clear the promise pointer
                     }
-                #endif
-
+                }
             }
 
+        #endif
         };
 
 
@@ -381,8 +395,16 @@ namespace fiber{
      * \brief Promise and Future pairs are used to synchronise values between asynchronous tasks.
      * 
      * If you are on a single core bare-metal embedded system (aka. all context switching is interrupt driven)
-     * you can set the `FIBER_MULTI_CORE` definiteion flag for optimizations - smaller binary and faster execution. 
-     * It will then remove all the locks and logic that is needed for multi-core thread safety.
+     * you can leave the `FIBER_MULTI_CORE` definiteion flag unset for optimizations - smaller binary and faster execution.
+     * It will then remove all the atomics and logic that is needed for multi-core thread safety.
+     * 
+     * In multi core mode `set_value()` is lock-free and never waits on the future, so it can be called from an interrupt
+     * service routine or another core. The destructor and the move assignment of a promise that has been completed while
+     * its future was being moved wait for the future to acknowledge the hand-over, because the moving future still
+     * references the promise. An interrupt that waits like that on the task it preempted would wait forever.
+     * So in multi core mode, only call `set_value()` from an interrupt, and destroy or re-assign the promise from a task,
+     * like the static `crc_promise` below. This is asserted if `fiber::is_interrupt_context()` is provided.
+     * In single core mode all operations briefly disable the interrupts instead and never wait.
      * 
      * Example: one wants to copy data asynchronously (for example with a DMA controller) while doing some computations in the mean time.
      * ```C++
@@ -405,10 +427,10 @@ namespace fiber{
      * 
      * // Once the CRC computation finished the interrupt will be called
      * void crc_complete_interrupt(){
-     *      
+     * 
      *      // keep the promise by assigning value to it
      *      crc_promise.set_value(CRC->result_register);
-     * }
+     * } 
      * 
      * int main(){
      *      // ...
@@ -416,13 +438,13 @@ namespace fiber{
      *      Future<uint32_t> crc_future = async_crc(message, length);
      * 
      *      // let the crc hardware do its thing and do some other math in the mean time
-     *      // ... 
+     *      // ...
      *      // ... some math ...
      *      // ...
      * 
      *      // now we need the crc. The .get() method will either wait for the value from the intterupt befor returning it.
      *      send_message(message, length, crc_future.get());
-     * }
+     * } 
      * 
      * ```
      */
@@ -432,22 +454,22 @@ namespace fiber{
 
         friend class Future<T>;
 
-        enum class Lock{
-            Open, ///< no one has the lock
-            Closed, ///< the lock is closed
-        };    
-
-        Future<T> *_futurePtr = nullptr;
-
         #ifdef FIBER_MULTI_CORE
-            std::atomic<Lock> _lock = Lock::Open;
+            /*
+            Link word encoding:
+                - connected:    `Future<T>*` | claimed_bit
+                - detatched:    0
+                - pending:      pending_bit, the promise has been kept or moved away while the future was moving and waits for its acknowledge
+            The claimed_bit is set while the promise writes to, or re-registers itself at the future.
+            */
+            static constexpr std::uintptr_t claimed_bit = 0b01;
+            static constexpr std::uintptr_t pending_bit = 0b10;
+
+            std::atomic<std::uintptr_t> _link = 0;
+        #else
+            Future<T> *_futurePtr = nullptr;
         #endif
-    
-        inline Promise(Future<T>* future) : _futurePtr(future){
-            // acquire lock - no lock needed since this function will always be called in the same thread as the Future
-            // register this promise
-            this->_futurePtr->_promisePtr = this;
-        }
+
     public:
 
         friend FuturePromisePair<T> make_future_promise<T>();
@@ -455,123 +477,52 @@ namespace fiber{
         Promise() = default;
         Promise(const Promise&) = delete;
 
-        /// @brief Thread and interrupt save move save move that re-registers stack pointers in between the future and the promise
+        /// @brief Thread and interrupt save move that re-registers the back-pointer of the future
+        /// @details In multi core mode, do not call it from an interrupt, see `~Promise()`
         Promise& operator=(Promise&& oldPromise){
             if(this != &oldPromise){
-                // detatch this
-                if(oldPromise._futurePtr){
-                    this->acquire_dual_locks();
-                    this->detatch_release_dual_locks();
-
-                    // lock old
-                    oldPromise.acquire_dual_locks();
-
-                    // copy data from oldPromise
-                    this->_futurePtr = oldPromise._futurePtr;
-                    
-                    // re-register
-                    if(this->_futurePtr){
-                        this->_futurePtr->_promisePtr = this;
-                    }
-                    
-                    // transfere locks
-                    #ifdef FIBER_MULTI_CORE
-                        this->_lock.store(oldPromise._lock.load(std::memory_order_acquire), std::memory_order_release);
-                    #endif
-                    
-                    // invalidate oldPromise
-                    oldPromise._futurePtr = nullptr;
-                    #ifdef FIBER_MULTI_CORE
-                        oldPromise._lock.store(Lock::Open);
-                    #endif
-
-                    // handover complete release this
-                    this->release_dual_locks();
-                }else{
-                    this->_futurePtr = nullptr;
-                }
-                
+                // the future of this promise will be left behind
+                this->template complete<false>([](T&){});
+                this->wait_for_acknowledge();
+
+                this->take_over(oldPromise);
             }
             return *this;
         }
 
+        /// @brief Thread and interrupt save move that re-registers the back-pointer of the future
         Promise(Promise&& oldPromise){
-            if(oldPromise._futurePtr){
-                // lock old
-                oldPromise.acquire_dual_locks();
-
-                // copy data from oldPromise
-                this->_futurePtr = oldPromise._futurePtr;
-                
-                // re-register
-                if(this->_futurePtr){
-                    this->_futurePtr->_promisePtr = this;
-                }
-                
-                // transfere locks
-                #ifdef FIBER_MULTI_CORE
-                    this->_lock.store(oldPromise._lock.load(std::memory_order_acquire), std::memory_order_release);
-                #endif
-                
-                // invalidate oldPromise
-                oldPromise._futurePtr = nullptr;
-                #ifdef FIBER_MULTI_CORE
-                    oldPromise._lock.store(Lock::Open);
-                #endif
-
-                // handover complete release this
-                this->release_dual_locks();
-            }else{
-                this->_futurePtr = nullptr;
-            }
+            this->take_over(oldPromise);
         }
 
-        
-
         /**
          * @brief Checks if the passed future is the one connected to this promise
          * @returns `true` if the passed future is the same that this promise is connected to.
          *  */ 
         bool is_connected_to(const Future<T>& future) const {
-            const bool result = this->_futurePtr == &future;
+            #ifdef FIBER_MULTI_CORE
+                const bool result = future_of(this->_link.load(std::memory_order_acquire)) == &future;
+            #else
+                const bool result = this->_futurePtr == &future;
+            #endif
             return result;
         }
 
         /// @brief Signals a broken promise to the future if no value has been assigned to the promise before destruction.
+        /// @details In multi core mode, this waits for a future that is being moved at the same time.
+        /// Do not destroy a promise from an interrupt, the task that the interrupt preempted might be moving the future.
         inline ~Promise() noexcept {
-            if(this->_futurePtr){
-                // acquire lock
-                this->acquire_dual_locks();
-
-                // double-check
-                if(this->_futurePtr != nullptr){
-                    // notify the future that the promise has been broken
-                    this->_futurePtr->set_state(Future<T>::State::BrokenPromise);
-                }
-
-                // release lock and detatch (futurePtr, promisePtr, clallback = nullptr)
-                this->detatch_release_dual_locks();
-            }
+            this->template complete<false>([](T&){});
+            this->wait_for_acknowledge();
         }
 
         /// @brief Sets a value to the future that this promise is based on.
+        /// @details Never waits on the future, so it may be called from an interrupt.
+        /// In multi core mode the promise itself must then outlive the interrupt and be destroyed or re-assigned from a task, see `~Promise()`.
         /// @param value The value that should be set to the Future and "keep the promise".
         /// @throws an std::exception on double writes
         void set_value(const T& value){
-            if(this->_futurePtr != nullptr){
-                // acquire lock
-                this->acquire_dual_locks();
-
-                // double check
-                if(this->_futurePtr != nullptr){
-                    // copy object
-                    this->_futurePtr->_value = value;
-                    this->_futurePtr->set_state(Future<T>::State::HasValue);
-                }
-
-                // release lock and detatch (futurePtr, promisePtr, clallback = nullptr)
-                this->detatch_release_dual_locks();
-            }else{
+            if(!this->template complete<true>([&value](T& dest){dest = value;})){
                 FIBER_THROW(Exception("Double assignment to already kept promise."));
             }
         }
@@ -583,24 +534,11 @@ namespace fiber{
         }
 
         /// @brief Sets a value to the future that this promise is based on.
+        /// @details Never waits on the future, so it may be called from an interrupt, see `set_value(const T&)`.
         /// @param value The value that should be set to the Future and "keep the promise"
         /// @throws an fiber::Exception on double writes
         void set_value(T&& value){
-            if(this->_futurePtr != nullptr){
-                
-                // acquire lock
-                this->acquire_dual_locks();
-
-                // double check
-                if(this->_futurePtr != nullptr){
-                    // move object
-                    this->_futurePtr->_value = std::move(value);
-                    this->_futurePtr->set_state(Future<T>::State::HasValue);
-                }
-
-                // release lock and detatch (futurePtr, clallback = nullptr)
-                this->detatch_release_dual_locks();
-            }else{
+            if(!this->template complete<true>([&value](T& dest){dest = std::move(value);})){
                 FIBER_THROW(Exception("Double assignment to already kept promise."));
             }
         }
@@ -611,101 +549,188 @@ namespace fiber{
             return *this;
         }
 
-    private:
-
-        /// @brief locks its and the futures lock.
-        /// @details Acquires its own lock. Attempts once to get the Future's lock. If it fails, releases its lock and retries, thereby giving Future a fair chance.
-        void acquire_dual_locks(){
-            // early return
-            if(this->_futurePtr == nullptr){return;}
-            
-            // disable interrupts to prevent deadlocks
-            fiber::disable_interrupts();
-            
-            #ifdef FIBER_MULTI_CORE
-                
+        /// @brief Sets a value to the future like `set_value()`, but does not throw if there is no future to receive it.
+        /// @returns `false` if the promise has already been kept or the future has been destroyed in the mean time
+        bool try_set_value(const T& value){
+            return this->template complete<true>([&value](T& dest){dest = value;});
+        }
 
-                while(true){
-                    // lock its own lock
-                    while (this->_lock.exchange(Lock::Closed, std::memory_order_acquire) != Lock::Open) {/* spin */}
+        /// @brief Sets a value to the future like `set_value()`, but does not throw if there is no future to receive it.
+        /// @returns `false` if the promise has already been kept or the future has been destroyed in the mean time
+        bool try_set_value(T&& value){
+            return this->template complete<true>([&value](T& dest){dest = std::move(value);});
+        }
 
-                    // double check - because there might have been an interrupt before the first check and the disabling of the interrupts
-                    if(this->_futurePtr == nullptr){
-                        // cleanup if value changed
+    private:    
 
-                        // open lock
-                        this->_lock.store(Lock::Open, std::memory_order_release);
+    #ifdef FIBER_MULTI_CORE
 
-                        // enable interrupts
-                        fiber::enable_interrupts();
+        static Future<T>* future_of(std::uintptr_t link){
+            return reinterpret_cast<Future<T>*>(link & ~(claimed_bit | pending_bit));
+        }
 
-                        return;
-                    }
+        /// \brief links this (fresh) promise to the future
+        void connect(Future<T>& future){
+            static_assert(alignof(Future<T>) >= 4, "The two lowest bits of the future address are used as flags");
+            this->_link.store(reinterpret_cast<std::uintptr_t>(&future), std::memory_order_relaxed);
+        }
 
-                    // try to lock the other lock once, if failed, open both locks so that the future can get both locks, then re-try
-                    if(this->_futurePtr->_lock.exchange(Future<T>::Lock::Closed, std::memory_order_acquire) != Future<T>::Lock::Open){
-                        // release the lock so that the future may acquire both locks
-                        this->_lock.store(Lock::Open, std::memory_order_release);
+        /// \brief Claims the connected future, so that it cannot re-register itself. Returns `nullptr` if there is none.
+        Future<T>* claim(){
+            std::uintptr_t link = this->_link.load(std::memory_order_acquire);
+            do{
+                if(future_of(link) == nullptr){return nullptr;}
+            }while(!this->_link.compare_exchange_weak(link, link | claimed_bit, std::memory_order_acq_rel, std::memory_order_acquire));
+            return future_of(link);
+        }
 
-                        // failed to get the lock --> contine loop and retry
-                        continue;
-                    }else{
-                        // succeeded in acquireing both locks --> stop trying and exit loop
-                        break;
-                    }
-                }
-            #endif
+        /**
+         * \brief Releases the claimed future after the link of the future has been updated to `future_link`.
+         *
+         * A future that has been moving at that time still references this promise and will acknowledge once it followed the update.
+         */
+        void let_go(std::uintptr_t future_link){
+            this->_link.store((future_link & Future<T>::moving_bit) ? pending_bit : 0, std::memory_order_release);
+        }
+
+        /**
+         * \brief Keeps or breaks the promise.
+         *
+         * Claims the future, lets `write` assign the value and publishes the final state with a single atomic exchange.
+         * Never waits on the future side.
+         *
+         * \returns `false` if the promise is not connected to a future
+         */
+        template<bool has_value, class Writer>
+        bool complete(Writer&& write){
+            Future<T>* future = this->claim();
+            if(future == nullptr){return false;}
+
+            if constexpr (has_value){
+                write(future->_value);
+            }
+
+            // close the subscription while the future cannot go away, a continuation that subscribes later runs by itself
+            const std::uintptr_t continuation = future->_continuation.exchange(Future<T>::closed_subscription, std::memory_order_acq_rel);
 
-            // successfully acquired both locks
+            // publish the result
+            constexpr std::uintptr_t final_link = Future<T>::finished_bit | (has_value ? Future<T>::value_bit : 0);
+            const std::uintptr_t future_link = future->_link.exchange(final_link, std::memory_order_acq_rel);
+
+            this->let_go(future_link);
+
+            // a subscribed continuation is not done before it has been notified, so it is still alive
+            if(continuation > Future<T>::closed_subscription){
+                reinterpret_cast<ContinuationNode*>(continuation)->notify();
+            }
+            return true;
         }
 
-        /// \brief Used by the Future to set the lock for a critical section
-        void release_dual_locks() {
-            #ifdef FIBER_MULTI_CORE
-                // release the lock of the future
-                if(this->_futurePtr != nullptr){
-                    this->_futurePtr->_lock.store(Future<T>::Lock::Open,  std::memory_order_release);
+        /**
+         * \brief Used by a moving or dying future to re-register itself
+         * \returns `true` on success, `false` if the promise has been kept or moved away in the mean time and waits for `acknowledge()`
+         */
+        bool redirect(Future<T>* from, Future<T>* to){
+            const std::uintptr_t expected = reinterpret_cast<std::uintptr_t>(from);
+            while(true){
+                std::uintptr_t link = expected;
+                if(this->_link.compare_exchange_weak(link, reinterpret_cast<std::uintptr_t>(to), std::memory_order_acq_rel, std::memory_order_acquire)){
+                    return true;
                 }
+                if(link & pending_bit){
+                    return false;
+                }
+                // claimed by the other side: it is only held for a few instructions --> retry
+            }
+        }
 
-                // release the lock of this promise
-                this->_lock.store(Lock::Open, std::memory_order_release);
-            #endif
-            if(this->_futurePtr != nullptr){
-                fiber::enable_interrupts();
+        /// \brief Used by the future to release a promise that has been let go while the future was moving
+        void acknowledge(){
+            this->_link.store(0, std::memory_order_release);
+        }
+
+        /// \brief waits until a moving future does no longer reference this promise
+        void wait_for_acknowledge(){
+            if(this->_link.load(std::memory_order_acquire) & pending_bit){
+                // the moving future might belong to the task that this interrupt preempted, which would never continue
+                FIBER_ASSERT_CRITICAL_MSG(!is_interrupt_context(), "A promise that has been kept while its future was moving cannot be destroyed or re-assigned from an interrupt.");
+                while(this->_link.load(std::memory_order_acquire) & pending_bit){/* spin */}
             }
         }
 
-        /// \brief releases the locks and sets the pointers of the future and promise to each other to nullptr
-        void detatch_release_dual_locks() {
-            #ifdef FIBER_MULTI_CORE
-                // release the lock of the future
-                if(this->_futurePtr != nullptr){
-                    // delete the promises connection before opening the lock
-                    this->_futurePtr->_promisePtr = nullptr;
-
-                    // unlock the future
-                    this->_futurePtr->_lock.store(Future<T>::Lock::Open,  std::memory_order_release);
-                    this->_lock.store(Lock::Open, std::memory_order_release);
-                    fiber::enable_interrupts();
-                }
-                
-                // release the lock of this promise
-            #else
-                if(this->_futurePtr != nullptr){
-                    this->_futurePtr->_promisePtr = nullptr;
-                    fiber::enable_interrupts();
+        /// \brief Moves the connection of `other` into this detatched promise
+        void take_over(Promise& other){
+            Future<T>* future = other.claim();
+            if(future == nullptr){return;}
+
+            // publish this promise before the future can see it
+            this->connect(*future);
+
+            // re-register, a moving future will follow once the old promise let go
+            const std::uintptr_t future_link = future->_link.exchange(reinterpret_cast<std::uintptr_t>(this), std::memory_order_acq_rel);
+
+            other.let_go(future_link);
+        }
+
+    #else
+
+        /// \brief links this (fresh) promise to the future
+        void connect(Future<T>& future){
+            this->_futurePtr = &future;
+        }
+
+        /**
+         * \brief Keeps or breaks the promise.
+         * \returns `false` if the promise is not connected to a future
+         */
+        template<bool has_value, class Writer>
+        bool complete(Writer&& write){
+            if(this->_futurePtr == nullptr){return false;}
+
+            ContinuationNode* continuation = nullptr;
+            {
+                InterruptGuard guard;
+
+                // double check - the future might have detatched before the interrupts were disabled
+                if(this->_futurePtr == nullptr){return false;}
+
+                if constexpr (has_value){
+                    write(this->_futurePtr->_value);
+                    this->_futurePtr->_state = Future<T>::State::HasValue;
+                }else{
+                    this->_futurePtr->_state = Future<T>::State::BrokenPromise;
                 }
-            #endif
+                continuation = this->_futurePtr->_continuation;
+                this->_futurePtr->_continuation = nullptr;
+                this->_futurePtr->_promisePtr = nullptr;
+                this->_futurePtr = nullptr;
+            }
+
+            // outside of the guard, the ready list disables the interrupts itself
+            if(continuation != nullptr){continuation->notify();}
+            return true;
+        }
 
+        inline void wait_for_acknowledge(){}
 
-            // detatch this
-            this->_futurePtr = nullptr;
+        /// \brief Moves the connection of `other` into this detatched promise
+        void take_over(Promise& other){
+            if(other._futurePtr != nullptr){
+                InterruptGuard guard;
+                if(other._futurePtr != nullptr){
+                    this->_futurePtr = other._futurePtr;
+                    this->_futurePtr->_promisePtr = this;
+                    other._futurePtr = nullptr;
+                }
+            }
         }
 
+    #endif
+
     };
 }// namespace fiber
 
-namespace fiber{
+namespace fiber{    
     template<class T>
     struct FuturePromisePair{
         Future<T> future;
@@ -724,7 +749,7 @@ namespace std {
 
 
 
-namespace fiber{
+namespace fiber{    
 
     // provide `get<>()`
     template<std::size_t I, class T>
@@ -753,12 +778,14 @@ namespace fiber{
         FuturePromisePair<T> pair;
 
         // link pair
-        pair.future._promisePtr = &pair.promise;
-        pair.future.set_state(Future<T>::State::Busy);
-        pair.promise._futurePtr = &pair.future;
+        pair.future.connect(pair.promise);
+        pair.promise.connect(pair.future);
 
         // return pair
         return pair;
     }
 
-} // namespace fiber
\ No newline at end of file
+} // namespace fiber
+
+// continuations are used by `Future::then()`
+#include <fiber/Future/Continuation.hpp>
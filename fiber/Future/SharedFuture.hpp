@@ -0,0 +1,435 @@
+#pragma once
+
+// std
+#ifdef FIBER_MULTI_CORE
+    #include <atomic>
+#endif
+#include <cstddef>
+
+// fiber
+#include <fiber/Exceptions/Exceptions.hpp>
+#include <fiber/interrupts/interrupts.hpp>
+
+namespace fiber{
+
+    template<class T>
+    class SharedFuture;
+
+    template<class T>
+    class BroadcastPromise;
+
+    namespace detail{
+
+        #ifdef FIBER_MULTI_CORE
+            /// \brief one lock for all broadcast lists, so that a dying promise never frees the lock a future is waiting on
+            inline std::atomic_flag broadcast_lock;
+        #endif
+
+        /**
+         * \brief Protects the waiter lists of all `BroadcastPromise`s
+         *
+         * In single core mode this disables the interrupts.
+         * In multi core mode it additionally spins on a lock that is shared by all broadcast lists.
+         * It is only held to re-link futures and to walk the waiters once on completion.
+         */
+        class BroadcastGuard{
+        private:
+            InterruptGuard _interrupt_guard;
+
+        public:
+            #ifdef FIBER_MULTI_CORE
+                inline BroadcastGuard(){while(broadcast_lock.test_and_set(std::memory_order_acquire)){/* spin */}}
+                inline ~BroadcastGuard(){broadcast_lock.clear(std::memory_order_release);}
+            #else
+                inline BroadcastGuard() = default;
+                inline ~BroadcastGuard() = default;
+            #endif
+        };
+
+    } // namespace detail
+
+    /**
+     * \brief A future that shares the value of one `BroadcastPromise` with any number of other shared futures.
+     *
+     * Where `Future`/`Promise` are strictly one-to-one, one `BroadcastPromise` can hand out an arbitrary number of
+     * `SharedFuture`s. A single `set_value()` on the promise wakes all of them. The value is stored only once - inside
+     * the promise - and the futures read it by const reference. Copying a shared future subscribes another waiter, but never copies `T`.
+     *
+     * Each shared future is an intrusive node in the waiter list of the promise, so subscribing and unsubscribing
+     * costs O(1) and completing the promise costs O(number of futures) without any allocation.
+     *
+     * Because the value lives in the promise, the promise has to outlive all reads of the value.
+     * If the promise is destroyed, all its futures become broken - whether or not a value had been set.
+     *
+     * Example:
+     * ```cpp
+     * // owned by the sensor driver
+     * static fiber::BroadcastPromise<Frame> frame_ready;
+     *
+     * // any number of tasks
+     * fiber::Coroutine<fiber::Exit> consumer(){
+     *      fiber::SharedFuture<Frame> future = frame_ready.get_future();
+     *      const Frame* frame = co_await future; // `nullptr` if the promise has been broken
+     *      // ...
+     * }
+     *
+     * // once, from the interrupt of the sensor
+     * void frame_complete_interrupt(){
+     *      frame_ready.set_value(read_frame());
+     * }
+     * ```
+     *
+     * \see fiber::BroadcastPromise
+     */
+    template<class T>
+    class SharedFuture{
+    private:
+        enum class State{
+            Busy,   ///< signals that the object is not finished and one has to wait
+            HasValue,   ///< signal that the object is finished and can be accessed
+            BrokenPromise, ///< signals that the promise was not kept --> throws an exception
+        };
+
+        // the following members are guarded by `detail::BroadcastGuard`
+        BroadcastPromise<T>* _promisePtr = nullptr;
+        SharedFuture* _prev = nullptr;
+        SharedFuture* _next = nullptr;
+
+        #ifdef FIBER_MULTI_CORE
+            std::atomic<State> _state = State::BrokenPromise;
+        #else
+            volatile State _state = State::BrokenPromise; // volatile because this will be set by a different threat.
+        #endif
+
+        friend class BroadcastPromise<T>;
+
+    public:
+
+        SharedFuture() = default;
+
+        /// @brief Subscribes another future to the same promise
+        SharedFuture(const SharedFuture& other){
+            detail::BroadcastGuard guard;
+            this->attach_like(other);
+        }
+
+        /// @brief Subscribes this future to the same promise as `other`
+        SharedFuture& operator=(const SharedFuture& other){
+            if(this != &other){
+                detail::BroadcastGuard guard;
+                this->detatch();
+                this->attach_like(other);
+            }
+            return *this;
+        }
+
+        /// @brief Thread and interrupt save move that replaces `other` in the waiter list of the promise
+        SharedFuture(SharedFuture&& other){
+            detail::BroadcastGuard guard;
+            this->take_over(other);
+        }
+
+        /// @brief Thread and interrupt save move that replaces `other` in the waiter list of the promise
+        SharedFuture& operator=(SharedFuture&& other){
+            if(this != &other){
+                detail::BroadcastGuard guard;
+                this->detatch();
+                this->take_over(other);
+            }
+            return *this;
+        }
+
+        ~SharedFuture(){
+            detail::BroadcastGuard guard;
+            this->detatch();
+        }
+
+        /**
+         * @brief Checks if the future is subscribed to the passed promise
+         * @returns `true` if the passed promise is the one this future reads from
+         */
+        inline bool is_connected_to(const BroadcastPromise<T>& promise) const {
+            detail::BroadcastGuard guard;
+            return this->_promisePtr == &promise;
+        }
+
+        /**
+         * \brief Blocks the current thread until the value is ready or an error occured.
+         */
+        void wait() const {while(this->is_waiting()){/* Do Nothing */}}
+
+        /**
+         * \brief returns a reference to the shared value and waits if necessary
+         * \throws Exception of type fiber::Exception if the promise has been broken.
+         */
+        [[nodiscard]]const T& get() const {
+            this->wait();
+            if(this->is_ready()){
+                return this->_promisePtr->_value;
+            }else{
+                FIBER_THROW(Exception("Read from broken promise."));
+            }
+        }
+
+        /**
+         * \brief returns a pointer to the shared value and waits if necessary. If the value does not exist, a `nullptr` is being returned
+         */
+        [[nodiscard]]inline const T* get_if() const {
+            this->wait();
+            return this->await_resume();
+        }
+
+        [[nodiscard]]inline State get_state() const {
+            return this->state();
+        }
+
+        inline State state() const {
+            #ifdef FIBER_MULTI_CORE
+                return this->_state.load(std::memory_order_acquire);
+            #else
+                return this->_state;
+            #endif
+        }
+
+        /// \brief returns true if the value is ready to read
+        [[nodiscard]]constexpr bool is_ready() const {return this->get_state() == State::HasValue;}
+
+        /// \brief converts to a boolean. same as calling `is_ready()`.
+        [[nodiscard]]constexpr operator bool() const {return this->is_ready();}
+
+        /// @brief returns true if the result is not finished yet and one has to wait
+        [[nodiscard]]constexpr bool is_waiting() const {return this->get_state() == State::Busy;}
+
+        /**
+         * \brief return true if the promise was not kept or does no longer exist
+         */
+        [[nodiscard]]constexpr bool is_broken_promise() const {return this->get_state() == State::BrokenPromise;}
+
+        /**
+         * @brief `co_await` interoperability, returns true, if the future is no longer waiting.
+         *
+         * Only reads the state of this future, so polling many shared futures of the same promise does not contend on the promise.
+         *
+         * @return `true` if the SharedFuture is no longer waiting on the BroadcastPromise
+         */
+        constexpr bool await_ready() const noexcept {
+            return !this->is_waiting();
+        }
+
+        /**
+         * @brief `co_await` interoperability, returns a pointer to the shared value.
+         *
+         * @returns a pointer to the value in the promise if one has been set and `is_ready()` would also return `true`, a `nullptr` otherwise.
+         */
+        const T* await_resume() const noexcept {
+            if(this->is_ready()){
+                return &(this->_promisePtr->_value);
+            }else{
+                return nullptr;
+            }
+        }
+
+    private:
+
+        /// \brief subscribes this detatched future to `promise`. Requires the `BroadcastGuard`.
+        void attach(BroadcastPromise<T>& promise){
+            this->_promisePtr = &promise;
+            this->_prev = nullptr;
+            this->_next = promise._head;
+            if(this->_next != nullptr){this->_next->_prev = this;}
+            promise._head = this;
+            this->set_state(promise._kept ? State::HasValue : State::Busy);
+        }
+
+        /// \brief subscribes this detatched future to the promise of `other`. Requires the `BroadcastGuard`.
+        void attach_like(const SharedFuture& other){
+            if(other._promisePtr != nullptr){
+                this->attach(*other._promisePtr);
+            }else{
+                this->set_state(other.state());
+            }
+        }
+
+        /// \brief replaces `other` with this detatched future in the waiter list. Requires the `BroadcastGuard`.
+        void take_over(SharedFuture& other){
+            this->_promisePtr = other._promisePtr;
+            this->_prev = other._prev;
+            this->_next = other._next;
+            this->set_state(other.state());
+            if(this->_promisePtr != nullptr){
+                if(this->_prev != nullptr){
+                    this->_prev->_next = this;
+                }else{
+                    this->_promisePtr->_head = this;
+                }
+                if(this->_next != nullptr){this->_next->_prev = this;}
+            }
+            other._promisePtr = nullptr;
+            other._prev = nullptr;
+            other._next = nullptr;
+            other.set_state(State::BrokenPromise);
+        }
+
+        /// \brief unsubscribes this future from its promise. Requires the `BroadcastGuard`.
+        void detatch(){
+            if(this->_promisePtr != nullptr){
+                if(this->_prev != nullptr){
+                    this->_prev->_next = this->_next;
+                }else{
+                    this->_promisePtr->_head = this->_next;
+                }
+                if(this->_next != nullptr){this->_next->_prev = this->_prev;}
+                this->_promisePtr = nullptr;
+                this->_prev = nullptr;
+                this->_next = nullptr;
+            }
+            this->set_state(State::BrokenPromise);
+        }
+
+        void set_state(State state){
+            #ifdef FIBER_MULTI_CORE
+                this->_state.store(state, std::memory_order_release);
+            #else
+                this->_state = state;
+            #endif
+        }
+    };
+
+    /**
+     * \brief A promise that is kept once and wakes any number of `SharedFuture`s
+     *
+     * The value is stored once inside the promise and read by const reference from all of its futures.
+     * `set_value()` walks the waiter list once and marks every subscribed future as ready - O(number of futures), no copies of `T`.
+     * Futures that subscribe after the promise has been kept are ready immediately.
+     *
+     * The futures point to the promise, so a broadcast promise can neither be copied nor moved.
+     * It is meant to live as long as the readers need the value, for example as a static or as member of the producing driver or task.
+     * On destruction all subscribed futures become broken.
+     *
+     * Like `Promise`, `set_value()` is interrupt safe. The waiter list is protected by briefly disabling interrupts and
+     * in `FIBER_MULTI_CORE` mode additionally by a spin lock that is only held to re-link a future or to walk the list on completion.
+     *
+     * \see fiber::SharedFuture
+     */
+    template<class T>
+    class BroadcastPromise{
+    private:
+        T _value;
+
+        // the following members are guarded by `detail::BroadcastGuard`
+        SharedFuture<T>* _head = nullptr;
+        bool _kept = false;
+        bool _claimed = false;
+
+        friend class SharedFuture<T>;
+
+    public:
+
+        BroadcastPromise() = default;
+        BroadcastPromise(const BroadcastPromise&) = delete;
+        BroadcastPromise(BroadcastPromise&&) = delete;
+        BroadcastPromise& operator=(const BroadcastPromise&) = delete;
+        BroadcastPromise& operator=(BroadcastPromise&&) = delete;
+
+        /// @brief Signals a broken promise to all futures that are still subscribed
+        ~BroadcastPromise() noexcept {
+            detail::BroadcastGuard guard;
+            SharedFuture<T>* future = this->_head;
+            while(future != nullptr){
+                SharedFuture<T>* next = future->_next;
+                future->_promisePtr = nullptr;
+                future->_prev = nullptr;
+                future->_next = nullptr;
+                future->set_state(SharedFuture<T>::State::BrokenPromise);
+                future = next;
+            }
+            this->_head = nullptr;
+        }
+
+        /**
+         * @brief Creates a new future that is subscribed to this promise
+         *
+         * Can be called any number of times. If the promise has already been kept, the returned future is ready immediately.
+         */
+        [[nodiscard]]SharedFuture<T> get_future(){
+            SharedFuture<T> future;
+            {
+                detail::BroadcastGuard guard;
+                future.attach(*this);
+            }
+            return future;
+        }
+
+        /// @brief returns true if a value has been set and published to the futures
+        [[nodiscard]]bool is_kept() const {
+            detail::BroadcastGuard guard;
+            return this->_kept;
+        }
+
+        /// @brief returns the number of futures that are currently subscribed to this promise
+        [[nodiscard]]std::size_t n_futures() const {
+            detail::BroadcastGuard guard;
+            std::size_t n = 0;
+            for(const SharedFuture<T>* future = this->_head; future != nullptr; future = future->_next){++n;}
+            return n;
+        }
+
+        /// @brief Sets the value once and wakes all subscribed futures.
+        /// @param value The value that should be shared with all futures
+        /// @throws an fiber::Exception on double writes
+        void set_value(const T& value){
+            if(!this->complete([&value](T& dest){dest = value;})){
+                FIBER_THROW(Exception("Double assignment to already kept promise."));
+            }
+        }
+
+        /// @brief equivalent to `set_value()`
+        BroadcastPromise& operator=(const T& value){
+            this->set_value(value);
+            return *this;
+        }
+
+        /// @brief Sets the value once and wakes all subscribed futures.
+        /// @param value The value that should be shared with all futures
+        /// @throws an fiber::Exception on double writes
+        void set_value(T&& value){
+            if(!this->complete([&value](T& dest){dest = std::move(value);})){
+                FIBER_THROW(Exception("Double assignment to already kept promise."));
+            }
+        }
+
+        /// @brief equivalent to `set_value()`
+        BroadcastPromise& operator=(T&& value){
+            this->set_value(std::move(value));
+            return *this;
+        }
+
+    private:
+
+        /**
+         * \brief Writes the value and publishes it to all futures
+         *
+         * The value is written outside of the guard, so that large values do not prolong the critical section.
+         *
+         * \returns `false` if the promise has already been kept
+         */
+        template<class Writer>
+        bool complete(Writer&& write){
+            {
+                detail::BroadcastGuard guard;
+                if(this->_claimed){return false;}
+                this->_claimed = true;
+            }
+
+            write(this->_value);
+
+            detail::BroadcastGuard guard;
+            this->_kept = true;
+            for(SharedFuture<T>* future = this->_head; future != nullptr; future = future->_next){
+                future->set_state(SharedFuture<T>::State::HasValue);
+            }
+            return true;
+        }
+    };
+
+} // namespace fiber
@@ -0,0 +1,93 @@
+#include "Future_benchmark.hpp"
+
+// std
+#if defined(FIBER_MULTI_CORE) && defined(FIBER_BENCHMARK)
+    #include <atomic>
+    #include <thread>
+#endif
+
+// fiber
+#include <fiber/Future/Future.hpp>
+#include <fiber/BenchmarkFramework/BenchmarkFramework.hpp>
+
+namespace fiber
+{
+    static constexpr uint64_t iterations = 1'000'000;
+
+    static void make_future_promise_benchmark(){
+        fiber::benchmark("make_future_promise + broken promise", iterations, [](){
+            auto [future, promise] = fiber::make_future_promise<int>();
+            fiber::do_not_optimize(future);
+            fiber::do_not_optimize(promise);
+        });
+    }
+
+    static void set_value_benchmark(){
+        int value = 0;
+        fiber::benchmark("make_future_promise + set_value", iterations, [&value](){
+            auto [future, promise] = fiber::make_future_promise<int>();
+            fiber::do_not_optimize(promise);
+            promise.set_value(++value);
+            fiber::do_not_optimize(future);
+        });
+    }
+
+    static void handover_benchmark(){
+        int value = 0;
+        fiber::benchmark("make_future_promise + 2x move + set_value", iterations, [&value](){
+            auto [future, promise] = fiber::make_future_promise<int>();
+            Future<int> moved_future = std::move(future);
+            Promise<int> moved_promise = std::move(promise);
+            fiber::do_not_optimize(moved_promise);
+            moved_promise.set_value(++value);
+            fiber::do_not_optimize(moved_future);
+        });
+    }
+
+#if defined(FIBER_MULTI_CORE) && defined(FIBER_BENCHMARK)
+
+    /// measures the round trip: hand the promise over to another thread, that completes it while this thread spins on the future
+    static void cross_thread_set_value_benchmark(){
+        static constexpr uint64_t cross_thread_iterations = 10'000;
+
+        std::atomic<Promise<int>*> mailbox = nullptr;
+        std::atomic<bool> stop = false;
+
+        std::thread producer([&](){
+            int value = 0;
+            while(!stop.load(std::memory_order_acquire)){
+                Promise<int>* mail = mailbox.exchange(nullptr, std::memory_order_acq_rel);
+                if(mail != nullptr){
+                    // take ownership, the mailbox is left behind once the future is ready
+                    Promise<int> promise = std::move(*mail);
+                    promise.set_value(++value);
+                }else{
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        fiber::benchmark("cross thread set_value round trip", cross_thread_iterations, [&](){
+            auto [future, promise] = fiber::make_future_promise<int>();
+            mailbox.store(&promise, std::memory_order_release);
+            while(future.is_waiting()){std::this_thread::yield();}
+            fiber::do_not_optimize(future);
+        });
+
+        stop.store(true, std::memory_order_release);
+        producer.join();
+    }
+
+#endif
+
+    void Future_benchmark(){
+        BENCHMARK_GROUP;
+
+        make_future_promise_benchmark();
+        set_value_benchmark();
+        handover_benchmark();
+        #if defined(FIBER_MULTI_CORE) && defined(FIBER_BENCHMARK)
+            cross_thread_set_value_benchmark();
+        #endif
+    }
+} // namespace fiber
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace fiber
+{
+    /**
+     * @brief Benchmarks creating, completing and handing over Future Promise pairs
+     * 
+     * With `FIBER_MULTI_CORE` and `FIBER_BENCHMARK` also measures the `set_value()` to `is_ready()` latency across two host threads.
+     */
+    void Future_benchmark();
+} // namespace fiber
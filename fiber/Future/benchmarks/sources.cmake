@@ -0,0 +1,7 @@
+target_sources(fiber
+    PUBLIC
+        ${CMAKE_CURRENT_LIST_DIR}/Future_benchmark.hpp
+        
+    PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/Future_benchmark.cpp
+)
@@ -1,6 +1,9 @@
 target_sources(fiber
     PUBLIC
+    ${CMAKE_CURRENT_LIST_DIR}/Continuation.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/ContinuationNode.hpp
     ${CMAKE_CURRENT_LIST_DIR}/Future.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/SharedFuture.hpp
 
     PRIVATE
         
@@ -11,4 +14,10 @@ if(FIBER_COMPILE_TESTS)
 
     include(${CMAKE_CURRENT_LIST_DIR}/tests/sources.cmake)
 
-endif()
\ No newline at end of file
+endif()
+
+if(FIBER_COMPILE_BENCHMARKS)
+
+    include(${CMAKE_CURRENT_LIST_DIR}/benchmarks/sources.cmake)
+
+endif()
@@ -0,0 +1,288 @@
+#include "Continuation_test.hpp"
+
+#include <fiber/Future/Future.hpp>
+#include <fiber/Future/Continuation.hpp>
+#include <fiber/OS/Scheduler.hpp>
+#include <fiber/OS/Task.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        TimePoint g_mock_time(0);
+        TimePoint get_time(){return g_mock_time;}
+    }
+
+    static fiber::TestResult then_runs_when_ready_test(){
+        TEST_START;
+
+        auto [future, promise] = fiber::make_future_promise<int>();
+
+        int n_calls = 0;
+        auto continuation = future.then([&n_calls](int value){++n_calls; return value * 2;});
+
+        TEST_TRUE(future.is_broken_promise()); // moved into the continuation
+        TEST_FALSE(continuation.poll());
+        TEST_FALSE(continuation.is_done());
+        TEST_EQUAL(n_calls, 0);
+
+        promise.set_value(21);
+
+        TEST_TRUE(continuation.poll());
+        TEST_TRUE(continuation.is_ready());
+        TEST_EQUAL(*continuation.value_if(), 42);
+        TEST_EQUAL(n_calls, 1);
+
+        // polling again does not run the callable again
+        TEST_TRUE(continuation.poll());
+        TEST_EQUAL(n_calls, 1);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult chain_into_future_test(){
+        TEST_START;
+
+        auto [future, promise] = fiber::make_future_promise<int>();
+
+        auto pipeline = future
+            .then([](int value){return value + 1;})
+            .then([](int value){return static_cast<float>(value) / 2.f;});
+
+        fiber::Future<float> result = pipeline.get_future();
+
+        TEST_FALSE(pipeline.poll());
+        TEST_TRUE(result.is_waiting());
+
+        promise = 4;
+
+        TEST_TRUE(pipeline.poll());
+        TEST_TRUE(result.is_ready());
+        TEST_EQUAL(result.get(), 2.5f);
+        TEST_TRUE(pipeline.value_if() == nullptr); // moved into the future, no copy is kept
+
+        TEST_END;
+    }
+
+    static fiber::TestResult get_future_after_done_test(){
+        TEST_START;
+
+        auto [future, promise] = fiber::make_future_promise<int>();
+        auto continuation = future.then([](int value){return value - 1;});
+
+        promise.set_value(1);
+        TEST_TRUE(continuation.poll());
+
+        fiber::Future<int> result = continuation.get_future();
+        TEST_TRUE(result.is_ready());
+        TEST_EQUAL(result.get(), 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult broken_promise_test(){
+        TEST_START;
+
+        int n_calls = 0;
+        fiber::Future<int> result;
+        {
+            auto [future, promise] = fiber::make_future_promise<int>();
+            auto pipeline = future
+                .then([&n_calls](int value){++n_calls; return value;})
+                .then([&n_calls](int value){++n_calls; return value;});
+            result = pipeline.get_future();
+
+            promise = fiber::Promise<int>(); // break the promise
+
+            TEST_TRUE(pipeline.poll());
+            TEST_TRUE(pipeline.is_broken_promise());
+            TEST_TRUE(result.is_broken_promise());
+        }
+
+        TEST_EQUAL(n_calls, 0);
+        TEST_TRUE(result.is_broken_promise());
+
+        TEST_END;
+    }
+
+    static fiber::TestResult scheduler_runs_continuations_test(){
+        TEST_START;
+
+        g_mock_time = TimePoint(0);
+
+        // a task that awaits the end of the pipeline
+        class Task : public fiber::Task<256>{
+            public:
+            int proof = 0;
+            fiber::Future<int> future;
+
+            Task(fiber::Future<int>&& future)
+                : fiber::Task<256>("awaits pipeline", get_time(), 1ms, Task::main, this)
+                , future(std::move(future)){}
+
+            static Coroutine<Exit> main(Task* This){
+                std::optional<int> value = co_await This->future;
+                This->proof = value.value_or(-1);
+                co_return Exit::Success;
+            }
+        };
+
+        auto [future, promise] = fiber::make_future_promise<int>();
+        auto pipeline = future
+            .then([](int value){return value * 10;})
+            .then([](int value){return value + 3;});
+        Task task(pipeline.get_future());
+
+        Scheduler<1> scheduler(get_time);
+        scheduler.add(&pipeline);
+        scheduler.add(&task);
+
+        TEST_EQUAL(scheduler.n_continuations(), 1);
+        TEST_EQUAL(scheduler.size(), 1); // continuations do not take up task slots
+
+        scheduler.spin();
+        scheduler.spin();
+
+        TEST_EQUAL(scheduler.n_continuations(), 1);
+        TEST_EQUAL(scheduler.n_awaiting(), 1);
+        TEST_FALSE(scheduler.is_done());
+
+        promise.set_value(4);
+
+        // the continuation runs and the task awaiting its future is promoted in the same spin
+        scheduler.spin();
+
+        TEST_EQUAL(scheduler.n_continuations(), 0);
+        TEST_TRUE(scheduler.is_done());
+        TEST_EQUAL(task.proof, 43);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult not_default_constructible_test(){
+        TEST_START;
+
+        struct Meters{
+            int value;
+            explicit Meters(int value) : value(value){}
+        };
+
+        auto [future, promise] = fiber::make_future_promise<int>();
+        auto pipeline = future
+            .then([](int value){return Meters(value);})
+            .then([](Meters meters){return meters.value * 100;});
+        fiber::Future<int> centimeters = pipeline.get_future();
+
+        promise.set_value(3);
+
+        TEST_TRUE(pipeline.poll());
+        TEST_EQUAL(centimeters.get(), 300);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult scheduler_polls_ready_continuations_only_test(){
+        TEST_START;
+
+        class CountingNode : public ContinuationNode{
+            public:
+            int n_polls = 0;
+            bool is_ready = false;
+
+            CountingNode() : ContinuationNode(&CountingNode::handle){}
+
+            static bool handle(ContinuationNode& node, Operation operation){
+                CountingNode& counting = static_cast<CountingNode&>(node);
+                if(operation == Operation::Subscribe){return !counting.is_ready;}
+                ++counting.n_polls;
+                return counting.is_ready;
+            }
+        };
+
+        CountingNode node;
+        Scheduler<1> scheduler(get_time);
+        scheduler.add(&node);
+
+        for(int i = 0; i < 10; ++i){scheduler.spin();}
+        TEST_EQUAL(node.n_polls, 0);
+        TEST_EQUAL(scheduler.n_continuations(), 1);
+
+        // what the promise does once it is kept
+        node.is_ready = true;
+        node.notify();
+
+        scheduler.spin();
+        scheduler.spin();
+        TEST_EQUAL(node.n_polls, 1);
+        TEST_EQUAL(scheduler.n_continuations(), 0);
+        TEST_TRUE(scheduler.is_done());
+
+        TEST_END;
+    }
+
+    static fiber::TestResult scheduler_runs_completed_continuations_test(){
+        TEST_START;
+
+        auto [future, promise] = fiber::make_future_promise<int>();
+        int result = 0;
+        auto continuation = future.then([&result](int value){result = value; return value;});
+
+        // the future completes before the continuation is added
+        promise.set_value(5);
+
+        Scheduler<1> scheduler(get_time);
+        scheduler.add(&continuation);
+        scheduler.spin();
+
+        TEST_EQUAL(result, 5);
+        TEST_EQUAL(scheduler.n_continuations(), 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult stage_size_test(){
+        TEST_START;
+
+        auto [future, promise] = fiber::make_future_promise<int>();
+        int offset = 1;
+
+        auto one = future.then([](int value){return value + 1;});
+        using One = decltype(one);
+        using Two = decltype(std::declval<One&>().then([](int value){return value * 2;}));
+        using Three = decltype(std::declval<Two&>().then([&offset](int value){return value + offset;}));
+
+        // the node, the root future and the result are paid once per pipeline
+        static_assert(sizeof(One) <= sizeof(ContinuationNode) + 2 * sizeof(fiber::Future<int>) + sizeof(fiber::Promise<int>) + 2 * sizeof(void*));
+
+        // a step without captures is free, a step with a reference capture costs that reference
+        static_assert(sizeof(Two) == sizeof(One));
+        static_assert(sizeof(Three) == sizeof(Two) + sizeof(int*));
+
+        auto pipeline = std::move(one)
+            .then([](int value){return value * 2;})
+            .then([&offset](int value){return value + offset;});
+        fiber::Future<int> result = pipeline.get_future();
+        promise.set_value(4);
+        TEST_TRUE(pipeline.poll());
+        TEST_EQUAL(result.get(), 11);
+
+        TEST_END;
+    }
+
+    fiber::TestResult Continuation_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | then_runs_when_ready_test
+            | chain_into_future_test
+            | get_future_after_done_test
+            | broken_promise_test
+            | scheduler_runs_continuations_test
+            | not_default_constructible_test
+            | scheduler_polls_ready_continuations_only_test
+            | scheduler_runs_completed_continuations_test
+            | stage_size_test
+            ;
+    }
+} // namespace fiber
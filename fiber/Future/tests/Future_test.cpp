@@ -1,5 +1,10 @@
 #include "Future_test.hpp"
 
+#if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+    #include <atomic>
+    #include <thread>
+#endif
+
 #include <fiber/Future/Future.hpp>
 #include <fiber/OStream/OStream.hpp>
 #include <fiber/TestFramework/TestFramework.hpp>
@@ -140,6 +145,81 @@ namespace fiber
         TEST_END;
     }
 
+    static fiber::TestResult promise_move_assign_test(){
+        TEST_START;
+
+        auto [future1, promise1] = fiber::make_future_promise<int>();
+        auto [future2, promise2] = fiber::make_future_promise<int>();
+
+        // the future of the overwritten promise is left behind with a broken promise
+        promise1 = std::move(promise2);
+
+        TEST_TRUE(future1.is_broken_promise());
+        TEST_TRUE(future2.is_waiting());
+        TEST_TRUE(promise1.is_connected_to(future2));
+        TEST_TRUE(future2.is_connected_to(promise1));
+        TEST_FALSE(promise2.is_connected_to(future2));
+
+        promise1.set_value(7);
+        TEST_EQUAL(future2.get(), 7);
+        TEST_THROW(promise1.set_value(8));
+
+        TEST_END;
+    }
+
+#if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+
+    /// @brief Keeps and breaks promises on a second thread while the futures are being moved back and forth
+    static fiber::TestResult multi_core_stress_test(){
+        TEST_START;
+
+        static constexpr int n_rounds = 20000;
+
+        std::atomic<Promise<int>*> mailbox = nullptr;
+        std::atomic<int> finished_round = -1;
+
+        std::thread producer([&](){
+            for(int round = 0; round < n_rounds; ++round){
+                Promise<int>* mail = nullptr;
+                while((mail = mailbox.exchange(nullptr, std::memory_order_acq_rel)) == nullptr){std::this_thread::yield();}
+                {
+                    Promise<int> promise = std::move(*mail);
+                    if(round % 4 != 0){
+                        promise.set_value(round);
+                    } // else: break the promise
+                }
+                finished_round.store(round, std::memory_order_release);
+            }
+        });
+
+        int n_wrong = 0;
+        for(int round = 0; round < n_rounds; ++round){
+            auto [future, promise] = fiber::make_future_promise<int>();
+            mailbox.store(&promise, std::memory_order_release);
+
+            // race the hand-over and completion of the promise with moves of the future
+            Future<int> other;
+            while(finished_round.load(std::memory_order_acquire) != round){
+                other = std::move(future);
+                future = std::move(other);
+                std::this_thread::yield();
+            }
+
+            if(round % 4 != 0){
+                n_wrong += !(future.is_ready() && (*future.get_if() == round));
+            }else{
+                n_wrong += !future.is_broken_promise();
+            }
+        }
+        producer.join();
+
+        TEST_EQUAL(n_wrong, 0);
+
+        TEST_END;
+    }
+
+#endif
+
     fiber::TestResult Future_test(){
         TEST_GROUP;
 
@@ -148,6 +228,11 @@ namespace fiber
             | promise_set_value_test
             | promise_assign_value_test
             | handover_test
-            | broken_promise_test;
+            | broken_promise_test
+            | promise_move_assign_test
+            #if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+            | multi_core_stress_test
+            #endif
+            ;
     }
 } // namespace fiber
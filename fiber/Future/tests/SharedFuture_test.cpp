@@ -0,0 +1,277 @@
+#include "SharedFuture_test.hpp"
+
+#if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+    #include <atomic>
+    #include <thread>
+#endif
+
+#include <fiber/Future/SharedFuture.hpp>
+#include <fiber/OS/Scheduler.hpp>
+#include <fiber/OS/Task.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        /// counts how often it has been copied
+        struct CopyCounter{
+            static inline int n_copies = 0;
+            int value = 0;
+
+            CopyCounter() = default;
+            CopyCounter(int value) : value(value){}
+            CopyCounter(const CopyCounter& other) : value(other.value){++n_copies;}
+            CopyCounter(CopyCounter&&) = default;
+            CopyCounter& operator=(const CopyCounter& other){value = other.value; ++n_copies; return *this;}
+            CopyCounter& operator=(CopyCounter&&) = default;
+        };
+
+        TimePoint g_mock_time(0);
+        TimePoint get_time(){return g_mock_time;}
+    }
+
+    static fiber::TestResult get_future_test(){
+        TEST_START;
+
+        fiber::BroadcastPromise<int> promise;
+        fiber::SharedFuture<int> future1 = promise.get_future();
+        fiber::SharedFuture<int> future2 = promise.get_future();
+
+        TEST_EQUAL(promise.n_futures(), 2);
+        TEST_FALSE(promise.is_kept());
+        TEST_TRUE(future1.is_connected_to(promise));
+        TEST_TRUE(future2.is_connected_to(promise));
+        TEST_TRUE(future1.is_waiting());
+        TEST_TRUE(future2.is_waiting());
+        TEST_FALSE(future1.await_ready());
+        TEST_EQUAL(future1.await_resume(), nullptr);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult set_value_wakes_all_test(){
+        TEST_START;
+
+        fiber::BroadcastPromise<CopyCounter> promise;
+        fiber::SharedFuture<CopyCounter> futures[5] = {
+            promise.get_future(), promise.get_future(), promise.get_future(), promise.get_future(), promise.get_future()
+        };
+
+        TEST_EQUAL(promise.n_futures(), 5);
+
+        CopyCounter::n_copies = 0;
+        promise.set_value(CopyCounter(42));
+
+        TEST_TRUE(promise.is_kept());
+        for(const fiber::SharedFuture<CopyCounter>& future : futures){
+            TEST_TRUE(future.is_ready());
+            TEST_TRUE(future.await_ready());
+            TEST_EQUAL(future.get().value, 42);
+        }
+
+        // all read the same, single value
+        TEST_EQUAL(futures[0].await_resume(), &futures[4].get());
+        TEST_EQUAL(futures[1].get_if(), &futures[3].get());
+        TEST_EQUAL(CopyCounter::n_copies, 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult late_subscriber_test(){
+        TEST_START;
+
+        fiber::BroadcastPromise<int> promise;
+        promise = 7;
+
+        fiber::SharedFuture<int> future = promise.get_future();
+        TEST_TRUE(future.is_ready());
+        TEST_EQUAL(future.get(), 7);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult copy_and_move_test(){
+        TEST_START;
+
+        fiber::BroadcastPromise<CopyCounter> promise;
+        fiber::SharedFuture<CopyCounter> future1 = promise.get_future();
+
+        // copy subscribes another waiter
+        fiber::SharedFuture<CopyCounter> future2 = future1;
+        TEST_EQUAL(promise.n_futures(), 2);
+        TEST_TRUE(future2.is_connected_to(promise));
+
+        // move replaces the waiter
+        fiber::SharedFuture<CopyCounter> future3 = std::move(future1);
+        TEST_EQUAL(promise.n_futures(), 2);
+        TEST_FALSE(future1.is_connected_to(promise));
+        TEST_TRUE(future1.is_broken_promise());
+        TEST_TRUE(future3.is_connected_to(promise));
+
+        fiber::SharedFuture<CopyCounter> future4;
+        TEST_TRUE(future4.is_broken_promise());
+        future4 = std::move(future2);
+        TEST_EQUAL(promise.n_futures(), 2);
+        TEST_TRUE(future4.is_connected_to(promise));
+
+        {
+            fiber::SharedFuture<CopyCounter> future5;
+            future5 = future4;
+            TEST_EQUAL(promise.n_futures(), 3);
+        }
+        TEST_EQUAL(promise.n_futures(), 2);
+
+        CopyCounter::n_copies = 0;
+        promise.set_value(CopyCounter(3));
+
+        TEST_FALSE(future1.is_ready());
+        TEST_FALSE(future2.is_ready());
+        TEST_TRUE(future3.is_ready());
+        TEST_TRUE(future4.is_ready());
+        TEST_EQUAL(future3.get().value, 3);
+        TEST_EQUAL(&future3.get(), &future4.get());
+
+        // copies of ready futures are ready too
+        fiber::SharedFuture<CopyCounter> future6 = future3;
+        TEST_TRUE(future6.is_ready());
+        TEST_EQUAL(&future6.get(), &future4.get());
+        TEST_EQUAL(CopyCounter::n_copies, 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult broken_promise_test(){
+        TEST_START;
+
+        fiber::SharedFuture<int> future1;
+        fiber::SharedFuture<int> future2;
+        {
+            fiber::BroadcastPromise<int> promise;
+            future1 = promise.get_future();
+            future2 = promise.get_future();
+            TEST_TRUE(future1.is_waiting());
+        }
+        TEST_TRUE(future1.is_broken_promise());
+        TEST_TRUE(future2.is_broken_promise());
+        TEST_TRUE(future1.await_ready());
+        TEST_EQUAL(future1.await_resume(), nullptr);
+        TEST_EQUAL(future2.get_if(), nullptr);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult scheduler_wakes_all_test(){
+        TEST_START;
+
+        g_mock_time = TimePoint(0);
+
+        class Task : public fiber::Task<256>{
+            public:
+            int proof = 0;
+            fiber::SharedFuture<int> future;
+
+            Task(std::string_view name, fiber::BroadcastPromise<int>& promise)
+                : fiber::Task<256>(name, get_time(), 1ms, Task::main, this)
+                , future(promise.get_future()){}
+
+            static Coroutine<Exit> main(Task* This){
+                const int* value = co_await This->future;
+                This->proof = (value != nullptr) ? *value : -1;
+                co_return Exit::Success;
+            }
+        };
+
+        fiber::BroadcastPromise<int> promise;
+        Task task1("task1", promise);
+        Task task2("task2", promise);
+        Task task3("task3", promise);
+
+        Scheduler<3> scheduler(get_time);
+        scheduler.add(&task1);
+        scheduler.add(&task2);
+        scheduler.add(&task3);
+
+        for(int i = 0; i < 3; ++i){scheduler.spin();}
+
+        TEST_EQUAL(scheduler.n_awaiting(), 3);
+        TEST_EQUAL(task1.proof, 0);
+
+        promise.set_value(11);
+
+        for(int i = 0; i < 3; ++i){scheduler.spin();}
+
+        TEST_TRUE(scheduler.is_done());
+        TEST_EQUAL(task1.proof, 11);
+        TEST_EQUAL(task2.proof, 11);
+        TEST_EQUAL(task3.proof, 11);
+
+        TEST_END;
+    }
+
+#if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+
+    /**
+     * Several threads subscribe, copy and move shared futures while the promise is being kept from another thread
+     */
+    static fiber::TestResult multi_core_stress_test(){
+        TEST_START;
+
+        constexpr int n_rounds = 2000;
+        constexpr int n_consumers = 3;
+
+        std::atomic<int> n_wrong = 0;
+
+        for(int round = 0; round < n_rounds; ++round){
+            fiber::BroadcastPromise<int> promise;
+            std::atomic<int> n_subscribed = 0;
+
+            std::thread consumers[n_consumers];
+            for(std::thread& consumer : consumers){
+                consumer = std::thread([&promise, &n_subscribed, &n_wrong, round](){
+                    fiber::SharedFuture<int> future = promise.get_future();
+                    n_subscribed.fetch_add(1);
+                    fiber::SharedFuture<int> copy = future;
+                    while(!future.await_ready()){
+                        fiber::SharedFuture<int> moved = std::move(future);
+                        future = std::move(moved);
+                        std::this_thread::yield();
+                    }
+                    if(future.get() != round || copy.get() != round || &future.get() != &copy.get()){
+                        n_wrong.fetch_add(1);
+                    }
+                });
+            }
+
+            // let some of the consumers subscribe late
+            if(round % 2 == 0){
+                while(n_subscribed.load() < n_consumers){std::this_thread::yield();}
+            }
+            promise.set_value(round);
+
+            for(std::thread& consumer : consumers){consumer.join();}
+        }
+
+        TEST_EQUAL(n_wrong.load(), 0);
+
+        TEST_END;
+    }
+
+#endif
+
+    fiber::TestResult SharedFuture_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | get_future_test
+            | set_value_wakes_all_test
+            | late_subscriber_test
+            | copy_and_move_test
+            | broken_promise_test
+            | scheduler_wakes_all_test
+            #if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+            | multi_core_stress_test
+            #endif
+            ;
+    }
+} // namespace fiber
@@ -1,7 +1,11 @@
 target_sources(fiber
     PUBLIC
+        ${CMAKE_CURRENT_LIST_DIR}/Continuation_test.hpp
         ${CMAKE_CURRENT_LIST_DIR}/Future_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/SharedFuture_test.hpp
         
     PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/Continuation_test.cpp
         ${CMAKE_CURRENT_LIST_DIR}/Future_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/SharedFuture_test.cpp
 )
@@ -0,0 +1,91 @@
+#include "AsyncMemcpyTask.hpp"
+
+// fiber
+#include <fiber/interrupts/interrupts.hpp>
+#include <fiber/Memory/memory.hpp>
+#include <fiber/OS/NextCycle.hpp>
+
+namespace fiber{
+
+    namespace{
+        AsyncMemcpyTask* active_async_memcpy_task = nullptr;
+
+        /// installed as the `fiber::async_memcpy_backend` while a task exists
+        bool push_to_active_task(void* dest, const void* source, std::size_t count, Promise<int>& promise){
+            AsyncMemcpyTask* task = active_async_memcpy_task;
+            return task != nullptr && task->push(dest, source, count, promise);
+        }
+    }
+
+    AsyncMemcpyTask::AsyncMemcpyTask(std::size_t chunk_size, uint16_t priority, std::string_view name)
+        : Task<256>(name, priority, AsyncMemcpyTask::main, this)
+        , _chunk_size((chunk_size > 0) ? chunk_size : 1)
+    {
+        InterruptGuard guard;
+        FIBER_ASSERT_O1_MSG(active_async_memcpy_task == nullptr, "Only one AsyncMemcpyTask can exist at a time.");
+        active_async_memcpy_task = this;
+        async_memcpy_backend = push_to_active_task;
+    }
+
+    AsyncMemcpyTask::~AsyncMemcpyTask(){
+        InterruptGuard guard;
+        if(active_async_memcpy_task == this){
+            active_async_memcpy_task = nullptr;
+            async_memcpy_backend = nullptr;
+        }
+    }
+
+    AsyncMemcpyTask* AsyncMemcpyTask::instance(){
+        return active_async_memcpy_task;
+    }
+
+    bool AsyncMemcpyTask::push(void* dest, const void* source, std::size_t count, Promise<int>& promise){
+        FIBER_ASSERT_CRITICAL_MSG(!is_interrupt_context(), "Copies cannot be queued to the AsyncMemcpyTask from an interrupt.");
+
+        #ifdef FIBER_MULTI_CORE
+            while(this->_push_lock.test_and_set(std::memory_order_acquire)){}
+        #endif
+
+        const std::size_t head = this->_head.load(std::memory_order_relaxed);
+        const bool queued = (head - this->_tail.load(std::memory_order_acquire)) != max_jobs;
+        if(queued){
+            Job& job = this->_jobs[head % max_jobs];
+            job.dest = reinterpret_cast<unsigned char*>(dest);
+            job.source = reinterpret_cast<const unsigned char*>(source);
+            job.remaining = count;
+            job.count = count;
+            job.promise = std::move(promise);
+            this->_head.store(head + 1, std::memory_order_release);
+        }
+
+        #ifdef FIBER_MULTI_CORE
+            this->_push_lock.clear(std::memory_order_release);
+        #endif
+        return queued;
+    }
+
+    void AsyncMemcpyTask::copy_chunk(){
+        // only this task removes jobs, and a job is not reused before the tail passed it
+        const std::size_t tail = this->_tail.load(std::memory_order_relaxed);
+        Job& job = this->_jobs[tail % max_jobs];
+        const std::size_t n = (job.remaining < this->_chunk_size) ? job.remaining : this->_chunk_size;
+        fiber::memcpy(job.dest, job.source, n);
+        job.dest += n;
+        job.source += n;
+        job.remaining -= n;
+
+        if(job.remaining == 0){
+            job.promise.try_set_value(static_cast<int>(job.count)); // the future may have been dropped
+            this->_tail.store(tail + 1, std::memory_order_release);
+        }
+    }
+
+    Coroutine<Exit> AsyncMemcpyTask::main(AsyncMemcpyTask* This){
+        while(true){
+            co_await JobsPending(This);
+            This->copy_chunk();
+            co_await NextCycle();
+        }
+    }
+
+} // namespace fiber
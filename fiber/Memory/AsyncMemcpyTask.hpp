@@ -0,0 +1,116 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// fiber
+#include <fiber/Future/Future.hpp>
+#include <fiber/OS/Task.hpp>
+
+namespace fiber{
+
+    /**
+     * \brief Background task that performs the copies of the default `fiber::async_memcpy` in bounded chunks.
+     *
+     * Without it, the default `fiber::async_memcpy` copies blocking. Once a task exists, copies are queued and
+     * the task copies at most `chunk_size()` bytes per cycle with `fiber::memcpy`, so a large copy does not stall the scheduler.
+     * When a copy completes, its promise is kept with the number of copied bytes.
+     * If the queue is full `fiber::async_memcpy` falls back to a blocking copy.
+     *
+     * It is a priority based task with the lowest priority by default, so it only runs when no other task is ready.
+     * Only one instance can exist at a time, constructing a second one while the first still exists is asserted.
+     *
+     * Copies are queued from tasks, not from interrupts, because queuing moves the promise and thereby touches its future.
+     * The queue is a ring with acquire/release indices, so with `FIBER_MULTI_CORE` tasks on other cores can queue copies
+     * while this task copies.
+     *
+     * Example:
+     * ```cpp
+     * static fiber::AsyncMemcpyTask async_memcpy_task(512);
+     * scheduler.add(&async_memcpy_task);
+     *
+     * // later in some task
+     * auto [future, promise] = fiber::make_future_promise<int>();
+     * fiber::async_memcpy(dest, source, size, std::move(promise));
+     * co_await future;
+     * ```
+     */
+    class AsyncMemcpyTask : public Task<256>{
+    public:
+        /// @brief the maximal number of copies that can be queued at the same time
+        static constexpr std::size_t max_jobs = 4;
+
+    private:
+        struct Job{
+            unsigned char* dest = nullptr;
+            const unsigned char* source = nullptr;
+            std::size_t remaining = 0;
+            std::size_t count = 0;
+            Promise<int> promise;
+        };
+
+        /// awaitable that is ready once a copy has been queued
+        class JobsPending{
+        private:
+            const AsyncMemcpyTask* _task;
+        public:
+            constexpr JobsPending(const AsyncMemcpyTask* task) : _task(task){}
+            bool await_ready() const noexcept {return this->_task->n_jobs() != 0;}
+            constexpr void await_resume() const noexcept {}
+        };
+
+        Job _jobs[max_jobs];
+        std::atomic<std::size_t> _head = 0; // number of queued jobs, written by the queuing tasks
+        std::atomic<std::size_t> _tail = 0; // number of completed jobs, written by this task
+        #ifdef FIBER_MULTI_CORE
+            std::atomic_flag _push_lock = ATOMIC_FLAG_INIT; // serializes tasks that queue from different cores
+        #endif
+        std::size_t _chunk_size;
+
+        static Coroutine<Exit> main(AsyncMemcpyTask* This);
+
+        /// copies the next chunk of the oldest job and keeps its promise once it is complete
+        void copy_chunk();
+
+    public:
+
+        /**
+         * @brief Creates the task and installs it as the `fiber::async_memcpy_backend` of the default `fiber::async_memcpy`
+         * @param chunk_size the maximal number of bytes that are copied per cycle
+         * @param priority the priority of the task. A higher number corresponds to a higher execution priority.
+         * @param name the name of the task
+         */
+        AsyncMemcpyTask(std::size_t chunk_size = 256, uint16_t priority = 0, std::string_view name = "async_memcpy");
+
+        AsyncMemcpyTask(const AsyncMemcpyTask&) = delete;
+        AsyncMemcpyTask& operator=(const AsyncMemcpyTask&) = delete;
+
+        /// @brief uninstalls the `fiber::async_memcpy_backend`. Queued copies are broken promises.
+        ~AsyncMemcpyTask();
+
+        /**
+         * @brief Queues a copy, may not be called from an interrupt
+         *
+         * The job, including its promise, is written completely before it is published to this task with a release store.
+         *
+         * @param promise is moved from only if the copy has been queued
+         * @returns `false` if the queue is full
+         */
+        bool push(void* dest, const void* source, std::size_t count, Promise<int>& promise);
+
+        /// @brief returns the number of queued copies
+        std::size_t n_jobs() const {
+            return this->_head.load(std::memory_order_acquire) - this->_tail.load(std::memory_order_acquire);
+        }
+
+        /// @brief returns the maximal number of bytes that are copied per cycle
+        std::size_t chunk_size() const {return this->_chunk_size;}
+
+        /// @brief returns the active task, or a `nullptr` if there is none
+        static AsyncMemcpyTask* instance();
+    };
+
+} // namespace fiber
@@ -0,0 +1,89 @@
+#include "memory_benchmark.hpp"
+
+// std
+#include <cstddef>
+
+// fiber
+#include <fiber/Memory/memory.hpp>
+#include <fiber/BenchmarkFramework/BenchmarkFramework.hpp>
+
+namespace fiber
+{
+    static constexpr uint64_t iterations = 100'000;
+    static constexpr size_t size = 4096;
+
+    alignas(alignof(std::max_align_t)) static unsigned char source[size + 16];
+    alignas(alignof(std::max_align_t)) static unsigned char dest[size + 16];
+
+    /// the default `fiber::_memcpy` before the word-wise copy, as a baseline
+    static void previous_memcpy(void* dest, const void* source, size_t count){
+        size_t i = 0;
+        char* cdest = reinterpret_cast<char*>(dest);
+        const char* csource = reinterpret_cast<const char*>(source);
+        for(; i < count; ++i, (void)++cdest, (void)++csource){
+            *cdest = *csource;
+        }
+    }
+
+    /// called through a function pointer like `fiber::memcpy`, so it is not inlined into the benchmark
+    static void(* volatile previous_memcpy_ptr)(void* dest, const void* source, size_t count) = previous_memcpy;
+
+    static void memcpy_benchmark(){
+        fiber::benchmark("previous fiber::memcpy 4KiB aligned", iterations, [](){
+            previous_memcpy_ptr(dest, source, size);
+            fiber::do_not_optimize(dest);
+        });
+        fiber::benchmark("previous fiber::memcpy 4KiB different misalignment", iterations, [](){
+            previous_memcpy_ptr(dest + 1, source + 3, size);
+            fiber::do_not_optimize(dest);
+        });
+        fiber::benchmark("fiber::memcpy 4KiB aligned", iterations, [](){
+            fiber::memcpy(dest, source, size);
+            fiber::do_not_optimize(dest);
+        });
+        fiber::benchmark("fiber::memcpy 4KiB same misalignment", iterations, [](){
+            fiber::memcpy(dest + 3, source + 3, size);
+            fiber::do_not_optimize(dest);
+        });
+        fiber::benchmark("fiber::memcpy 4KiB different misalignment", iterations, [](){
+            fiber::memcpy(dest + 1, source + 3, size);
+            fiber::do_not_optimize(dest);
+        });
+        fiber::benchmark("fiber::memcpy 13B", iterations * 10, [](){
+            fiber::memcpy(dest + 1, source + 1, 13);
+            fiber::do_not_optimize(dest);
+        });
+    }
+
+    static void memset_benchmark(){
+        fiber::benchmark("fiber::memset 4KiB", iterations, [](){
+            fiber::memset(dest + 1, ' ', size);
+            fiber::do_not_optimize(dest);
+        });
+    }
+
+    static void memmove_benchmark(){
+        fiber::benchmark("fiber::memmove 4KiB overlapping backward", iterations, [](){
+            fiber::memmove(dest + 8, dest, size);
+            fiber::do_not_optimize(dest);
+        });
+    }
+
+    static void memcmp_benchmark(){
+        fiber::memcpy(dest, source, size);
+        int result = 0;
+        fiber::benchmark("fiber::memcmp 4KiB equal", iterations, [&result](){
+            result += fiber::memcmp(dest, source, size);
+            fiber::do_not_optimize(result);
+        });
+    }
+
+    void memory_benchmark(){
+        BENCHMARK_GROUP;
+
+        memcpy_benchmark();
+        memset_benchmark();
+        memmove_benchmark();
+        memcmp_benchmark();
+    }
+} // namespace fiber
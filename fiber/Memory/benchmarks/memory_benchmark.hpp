@@ -0,0 +1,9 @@
+#pragma once
+
+namespace fiber
+{
+    /**
+     * @brief Benchmarks `fiber::memcpy`, `fiber::memset`, `fiber::memmove` and `fiber::memcmp` against a byte wise loop
+     */
+    void memory_benchmark();
+} // namespace fiber
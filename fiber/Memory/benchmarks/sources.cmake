@@ -0,0 +1,7 @@
+target_sources(fiber
+    PUBLIC
+        ${CMAKE_CURRENT_LIST_DIR}/memory_benchmark.hpp
+        
+    PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/memory_benchmark.cpp
+)
@@ -1,21 +1,162 @@
 #include <fiber/Memory/memory.hpp>
 
+// std
+#include <cstdint>
+
+// fiber
+#include <fiber/Core/definitions.hpp>
+
 namespace fiber{
 
+    namespace{
+
+        typedef std::uintptr_t FIBER_MAY_ALIAS word;
+
+        constexpr std::uintptr_t word_mask = sizeof(word) - 1;
+
+        /// ranges shorter than this are not worth aligning
+        constexpr size_t min_word_count = 2 * sizeof(word);
+
+        inline std::uintptr_t address(const void* ptr){return reinterpret_cast<std::uintptr_t>(ptr);}
+
+        inline bool is_aligned(const void* ptr){return (address(ptr) & word_mask) == 0;}
+
+        /// `true` if both pointers become word aligned after the same number of bytes
+        inline bool same_alignment(const void* lhs, const void* rhs){return ((address(lhs) ^ address(rhs)) & word_mask) == 0;}
+
+        void copy_forward(unsigned char* dest, const unsigned char* source, size_t count){
+            if(count >= min_word_count && same_alignment(dest, source)){
+                // unaligned head
+                for(; !is_aligned(dest); --count){*dest++ = *source++;}
+
+                // aligned body
+                word* wdest = reinterpret_cast<word*>(dest);
+                const word* wsource = reinterpret_cast<const word*>(source);
+                for(; count >= 4 * sizeof(word); count -= 4 * sizeof(word), wdest += 4, wsource += 4){
+                    wdest[0] = wsource[0];
+                    wdest[1] = wsource[1];
+                    wdest[2] = wsource[2];
+                    wdest[3] = wsource[3];
+                }
+                for(; count >= sizeof(word); count -= sizeof(word)){*wdest++ = *wsource++;}
+
+                dest = reinterpret_cast<unsigned char*>(wdest);
+                source = reinterpret_cast<const unsigned char*>(wsource);
+            }
+
+            // unaligned tail
+            for(; count > 0; --count){*dest++ = *source++;}
+        }
+
+        void copy_backward(unsigned char* dest, const unsigned char* source, size_t count){
+            // start past the end
+            dest += count;
+            source += count;
+
+            if(count >= min_word_count && same_alignment(dest, source)){
+                // unaligned tail
+                for(; !is_aligned(dest); --count){*--dest = *--source;}
+
+                // aligned body
+                word* wdest = reinterpret_cast<word*>(dest);
+                const word* wsource = reinterpret_cast<const word*>(source);
+                for(; count >= sizeof(word); count -= sizeof(word)){*--wdest = *--wsource;}
+
+                dest = reinterpret_cast<unsigned char*>(wdest);
+                source = reinterpret_cast<const unsigned char*>(wsource);
+            }
+
+            // unaligned head
+            for(; count > 0; --count){*--dest = *--source;}
+        }
+
+    } // namespace
+
     void _memcpy(void* dest, const void* source, size_t count){
-        size_t i = 0;
-        char* cdest = reinterpret_cast<char*>(dest);
-        const char* csource = reinterpret_cast<const char*>(source);
-        for(; i < count; ++i, (void)++cdest, (void)++csource){
-            *cdest = *csource;
+        copy_forward(reinterpret_cast<unsigned char*>(dest), reinterpret_cast<const unsigned char*>(source), count);
+    }
+
+    void _memset(void* dest, int value, size_t count){
+        unsigned char* cdest = reinterpret_cast<unsigned char*>(dest);
+        const unsigned char byte = static_cast<unsigned char>(value);
+
+        if(count >= min_word_count){
+            // unaligned head
+            for(; !is_aligned(cdest); --count){*cdest++ = byte;}
+
+            // aligned body: repeat the byte in every byte of the word
+            const word pattern = (~word(0) / 0xFF) * byte;
+            word* wdest = reinterpret_cast<word*>(cdest);
+            for(; count >= 4 * sizeof(word); count -= 4 * sizeof(word), wdest += 4){
+                wdest[0] = pattern;
+                wdest[1] = pattern;
+                wdest[2] = pattern;
+                wdest[3] = pattern;
+            }
+            for(; count >= sizeof(word); count -= sizeof(word)){*wdest++ = pattern;}
+
+            cdest = reinterpret_cast<unsigned char*>(wdest);
+        }
+
+        // unaligned tail
+        for(; count > 0; --count){*cdest++ = byte;}
+    }
+
+    void _memmove(void* dest, const void* source, size_t count){
+        unsigned char* cdest = reinterpret_cast<unsigned char*>(dest);
+        const unsigned char* csource = reinterpret_cast<const unsigned char*>(source);
+        if(cdest == csource || count == 0){
+            return;
+        }else if(address(cdest) < address(csource) || address(cdest) >= address(csource) + count){
+            // a forward copy only overwrites source bytes that have already been read
+            copy_forward(cdest, csource, count);
+        }else{
+            copy_backward(cdest, csource, count);
         }
     }
 
-    void _async_memcpy(void* dest, const void* source, size_t count, [[maybe_unused]]Promise<int> promise){
-        _memcpy(dest, source, count);
+    int _memcmp(const void* lhs, const void* rhs, size_t count){
+        const unsigned char* clhs = reinterpret_cast<const unsigned char*>(lhs);
+        const unsigned char* crhs = reinterpret_cast<const unsigned char*>(rhs);
+
+        if(count >= min_word_count && same_alignment(clhs, crhs)){
+            // unaligned head
+            for(; !is_aligned(clhs); --count, (void)++clhs, (void)++crhs){
+                if(*clhs != *crhs){return static_cast<int>(*clhs) - static_cast<int>(*crhs);}
+            }
+
+            // aligned body: skip equal words, the differing byte is found by the tail loop
+            const word* wlhs = reinterpret_cast<const word*>(clhs);
+            const word* wrhs = reinterpret_cast<const word*>(crhs);
+            for(; count >= sizeof(word) && *wlhs == *wrhs; count -= sizeof(word)){++wlhs; ++wrhs;}
+
+            clhs = reinterpret_cast<const unsigned char*>(wlhs);
+            crhs = reinterpret_cast<const unsigned char*>(wrhs);
+        }
+
+        // unaligned tail
+        for(; count > 0; --count, (void)++clhs, (void)++crhs){
+            if(*clhs != *crhs){return static_cast<int>(*clhs) - static_cast<int>(*crhs);}
+        }
+        return 0;
+    }
+
+    void _async_memcpy(void* dest, const void* source, size_t count, Promise<int> promise){
+        bool(*backend)(void*, const void*, size_t, Promise<int>&) = async_memcpy_backend;
+        if(backend != nullptr && backend(dest, source, count, promise)){
+            return;
+        }
+
+        // no backend or its queue is full: copy right away
+        fiber::memcpy(dest, source, count);
+        promise.try_set_value(static_cast<int>(count));
     }
 
     void(*memcpy)(void* dest, const void* source, size_t count) = _memcpy;
+    void(*memset)(void* dest, int value, size_t count) = _memset;
+    void(*memmove)(void* dest, const void* source, size_t count) = _memmove;
+    int(*memcmp)(const void* lhs, const void* rhs, size_t count) = _memcmp;
     void(*async_memcpy)(void* dest, const void* source, size_t count, Promise<int> promise) = _async_memcpy;
+    bool(*async_memcpy_backend)(void* dest, const void* source, size_t count, Promise<int>& promise) = nullptr;
 
-}
\ No newline at end of file
+}
@@ -1,5 +1,9 @@
 #pragma once
 
+// std
+#include <cstddef>
+
+// fiber
 #include <fiber/Future/Future.hpp>
 
 namespace fiber{
@@ -8,6 +12,9 @@ namespace fiber{
      * \brief Copies count many bytes from `source` to `dest` in a blocking behaviour.
      * 
      * Internal/default implementation for fiber::memcpy that the fiber library uses to copy data.
+     * If `dest` and `source` share the same alignment, copies an unaligned head byte wise, the body in whole machine words
+     * (four per iteration, which compilers are free to vectorise) and the remaining tail byte wise.
+     * Otherwise it falls back to a byte wise copy, so it never performs unaligned word accesses.
      * Redirect the `fiber::memcpy` and `fiber::async_memcpy` function pinters to overload it with your custom copy implementation,
      * that for example uses a direct memory access controller (DMA).
      * 
@@ -18,9 +25,34 @@ namespace fiber{
     void _memcpy(void* dest, const void* source, size_t count);
 
     /**
-     * \brief Copies count many bytes from `source` to `dest` in a blocking behaviour.
+     * \brief Fills `count` many bytes at `dest` with the byte `value`.
+     * 
+     * Internal/default implementation for fiber::memset. Writes whole machine words to the aligned body.
+     */
+    void _memset(void* dest, int value, size_t count);
+
+    /**
+     * \brief Copies count many bytes from `source` to `dest`. The two ranges may overlap.
+     * 
+     * Internal/default implementation for fiber::memmove. Copies forward or backward, word wise like `_memcpy()`.
+     */
+    void _memmove(void* dest, const void* source, size_t count);
+
+    /**
+     * \brief Compares `count` many bytes of `lhs` and `rhs` as unsigned chars.
+     * 
+     * Internal/default implementation for fiber::memcmp. Compares whole machine words until they differ.
+     * 
+     * \returns a negative value if the first differing byte is smaller in `lhs`, a positive one if it is larger and `0` if all are equal.
+     */
+    int _memcmp(const void* lhs, const void* rhs, size_t count);
+
+    /**
+     * \brief Copies count many bytes from `source` to `dest` in chunks or blocking as a fallback.
      * 
      * Internal/default implementation for fiber::async_memcpy that the fiber library uses to copy data.
+     * If a backend is installed in `fiber::async_memcpy_backend`, like the one of a `fiber::AsyncMemcpyTask`, and it has space,
+     * the copy is queued and done by that backend. Otherwise the copy is done immediately. In both cases the promise is kept with the number of copied bytes.
      * Redirect the `fiber::memcpy` and `fiber::async_memcpy` function pinters to overload it with your custom copy implementation,
      * that for example uses a direct memory access controller (DMA).
      * 
@@ -32,6 +64,14 @@ namespace fiber{
      */
     void _async_memcpy(void* dest, const void* source, size_t count, Promise<int> promise);
 
+    /**
+     * \brief Backend to which `fiber::_async_memcpy` queues copies, or a `nullptr` to copy blocking
+     * 
+     * A `fiber::AsyncMemcpyTask` installs itself here while it exists, so this module does not depend on the scheduler.
+     * The backend returns `false` if it cannot queue the copy, and only moves from the promise if it queued it.
+     */
+    extern bool(*async_memcpy_backend)(void* dest, const void* source, size_t count, Promise<int>& promise);
+
     /**
      * \brief Function that the fiber:: library uses to copy memory
      * 
@@ -46,6 +86,40 @@ namespace fiber{
      */
     extern void(*memcpy)(void* dest, const void* source, size_t count);
 
+    /**
+     * \brief Function that the fiber library uses to fill memory
+     * 
+     * This function pointer can be overloaded by the user for a concrete implementation that uses hardware acceleration.
+     * 
+     * \param dest Pointer to the destination to which `count` many bytes will be written
+     * \param value The byte value that will be written
+     * \param count The number of bytes that will be written
+     */
+    extern void(*memset)(void* dest, int value, size_t count);
+
+    /**
+     * \brief Function that the fiber library uses to copy memory between ranges that may overlap
+     * 
+     * This function pointer can be overloaded by the user for a concrete implementation that uses hardware acceleration.
+     * 
+     * \param dest Pointer to the destination to which `count` many bytes will be written
+     * \param source Pointer to the source from which `count` many bytes will be read
+     * \param count The number of bytes that will be copied
+     */
+    extern void(*memmove)(void* dest, const void* source, size_t count);
+
+    /**
+     * \brief Function that the fiber library uses to compare memory
+     * 
+     * This function pointer can be overloaded by the user for a concrete implementation that uses hardware acceleration.
+     * 
+     * \param lhs Pointer to the first range
+     * \param rhs Pointer to the second range
+     * \param count The number of bytes that will be compared
+     * \returns a negative value, zero or a positive value if `lhs` is less, equal or greater than `rhs`
+     */
+    extern int(*memcmp)(const void* lhs, const void* rhs, size_t count);
+
     /**
      * \brief copies from source to dest so that no more bytes than destSize or sourceSize are written
      * \param dest a pointer to the destination that data should be written to
@@ -79,7 +153,8 @@ namespace fiber{
      * This function pointer can be overloaded by the user for a concrete implementation that uses hardware acceleration, 
      * like f.e. a DMA controller that can copy data independently of the main prozessing thread.
      * 
-     * Note: the default implementation is a blocking one.
+     * Note: the default implementation queues the copy to `fiber::async_memcpy_backend` if one is installed,
+     * for example the bounded chunks of a `fiber::AsyncMemcpyTask`, and is otherwise a blocking one. Both keep the promise with the number of copied bytes.
      * 
      * \param dest Pointer to the destination to which `count` many bytes will be written
      * \param source Pointer to the source from which `count` many bytes will be read
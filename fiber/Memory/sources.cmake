@@ -1,10 +1,24 @@
 target_sources(fiber
     PUBLIC
+        ${CMAKE_CURRENT_LIST_DIR}/AsyncMemcpyTask.hpp
         ${CMAKE_CURRENT_LIST_DIR}/memory.hpp
         ${CMAKE_CURRENT_LIST_DIR}/StaticLinearAllocator.hpp
         ${CMAKE_CURRENT_LIST_DIR}/StackAllocator.hpp
 
     PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/AsyncMemcpyTask.cpp
         ${CMAKE_CURRENT_LIST_DIR}/memory.cpp
         ${CMAKE_CURRENT_LIST_DIR}/StackAllocator.cpp
-)
\ No newline at end of file
+)
+
+if(FIBER_COMPILE_TESTS)
+
+    include(${CMAKE_CURRENT_LIST_DIR}/tests/sources.cmake)
+
+endif()
+
+if(FIBER_COMPILE_BENCHMARKS)
+
+    include(${CMAKE_CURRENT_LIST_DIR}/benchmarks/sources.cmake)
+
+endif()
@@ -0,0 +1,321 @@
+#include "memory_test.hpp"
+
+#if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+    #include <atomic>
+    #include <thread>
+#endif
+
+#include <fiber/Memory/memory.hpp>
+#include <fiber/Memory/AsyncMemcpyTask.hpp>
+#include <fiber/OS/Scheduler.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        constexpr int max_offset = 2 * sizeof(void*);
+        constexpr int max_count = 80;
+        constexpr int buffer_size = 2 * max_offset + max_count + max_offset;
+
+        void fill_pattern(unsigned char* buffer, int size, int seed){
+            for(int i = 0; i < size; ++i){
+                buffer[i] = static_cast<unsigned char>(i * 7 + seed);
+            }
+        }
+
+        /// byte wise reference for overlapping and non overlapping copies
+        void reference_memmove(unsigned char* dest, const unsigned char* source, int count){
+            unsigned char tmp[buffer_size];
+            for(int i = 0; i < count; ++i){tmp[i] = source[i];}
+            for(int i = 0; i < count; ++i){dest[i] = tmp[i];}
+        }
+
+        bool equal(const unsigned char* lhs, const unsigned char* rhs, int size){
+            for(int i = 0; i < size; ++i){
+                if(lhs[i] != rhs[i]){return false;}
+            }
+            return true;
+        }
+
+        int sign(int value){return (value > 0) - (value < 0);}
+
+        TimePoint g_mock_time(0);
+        TimePoint get_time(){return g_mock_time;}
+    }
+
+    static fiber::TestResult memcpy_test(){
+        TEST_START;
+
+        alignas(alignof(std::max_align_t)) unsigned char source[buffer_size];
+        alignas(alignof(std::max_align_t)) unsigned char dest[buffer_size];
+        alignas(alignof(std::max_align_t)) unsigned char expected[buffer_size];
+
+        int n_wrong = 0;
+        for(int dest_offset = 0; dest_offset < max_offset; ++dest_offset){
+            for(int source_offset = 0; source_offset < max_offset; ++source_offset){
+                for(int count = 0; count < max_count; ++count){
+                    fill_pattern(source, buffer_size, 1);
+                    fill_pattern(dest, buffer_size, 2);
+                    fill_pattern(expected, buffer_size, 2);
+
+                    fiber::memcpy(dest + dest_offset, source + source_offset, count);
+                    reference_memmove(expected + dest_offset, source + source_offset, count);
+
+                    n_wrong += !equal(dest, expected, buffer_size);
+                }
+            }
+        }
+        TEST_EQUAL(n_wrong, 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult memset_test(){
+        TEST_START;
+
+        alignas(alignof(std::max_align_t)) unsigned char dest[buffer_size];
+        alignas(alignof(std::max_align_t)) unsigned char expected[buffer_size];
+
+        int n_wrong = 0;
+        for(int offset = 0; offset < max_offset; ++offset){
+            for(int count = 0; count < max_count; ++count){
+                fill_pattern(dest, buffer_size, 3);
+                fill_pattern(expected, buffer_size, 3);
+
+                fiber::memset(dest + offset, 0x1A5, count); // only the lowest byte is used
+                for(int i = 0; i < count; ++i){expected[offset + i] = 0xA5;}
+
+                n_wrong += !equal(dest, expected, buffer_size);
+            }
+        }
+        TEST_EQUAL(n_wrong, 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult memmove_test(){
+        TEST_START;
+
+        alignas(alignof(std::max_align_t)) unsigned char buffer[buffer_size];
+        alignas(alignof(std::max_align_t)) unsigned char expected[buffer_size];
+
+        // overlapping in both directions, including distances that keep the word alignment
+        int n_wrong = 0;
+        for(int dest_offset = 0; dest_offset < 2 * max_offset; ++dest_offset){
+            for(int source_offset = 0; source_offset < 2 * max_offset; ++source_offset){
+                for(int count = 0; count < max_count; ++count){
+                    fill_pattern(buffer, buffer_size, 4);
+                    fill_pattern(expected, buffer_size, 4);
+
+                    fiber::memmove(buffer + dest_offset, buffer + source_offset, count);
+                    reference_memmove(expected + dest_offset, expected + source_offset, count);
+
+                    n_wrong += !equal(buffer, expected, buffer_size);
+                }
+            }
+        }
+        TEST_EQUAL(n_wrong, 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult memcmp_test(){
+        TEST_START;
+
+        alignas(alignof(std::max_align_t)) unsigned char lhs[buffer_size];
+        alignas(alignof(std::max_align_t)) unsigned char rhs[buffer_size];
+
+        int n_wrong = 0;
+        for(int offset = 0; offset < max_offset; ++offset){
+            for(int count = 0; count < max_count; ++count){
+                fill_pattern(lhs, buffer_size, 5);
+                fill_pattern(rhs, buffer_size, 5);
+                n_wrong += fiber::memcmp(lhs + offset, rhs + offset, count) != 0;
+
+                // every position of the first difference, the later bytes differ in the opposite direction
+                for(int diff = 0; diff < count; ++diff){
+                    fill_pattern(rhs, buffer_size, 5);
+                    rhs[offset + diff] = static_cast<unsigned char>(lhs[offset + diff] + 1);
+                    for(int i = diff + 1; i < count; ++i){rhs[offset + i] = static_cast<unsigned char>(lhs[offset + i] - 1);}
+
+                    n_wrong += sign(fiber::memcmp(lhs + offset, rhs + offset, count)) != -1;
+                    n_wrong += sign(fiber::memcmp(rhs + offset, lhs + offset, count)) != 1;
+                }
+            }
+        }
+        TEST_EQUAL(n_wrong, 0);
+
+        // unsigned comparison
+        const unsigned char small[] = {0x01};
+        const unsigned char large[] = {0xFF};
+        TEST_TRUE(fiber::memcmp(small, large, 1) < 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult async_memcpy_blocking_fallback_test(){
+        TEST_START;
+
+        TEST_EQUAL(fiber::AsyncMemcpyTask::instance(), nullptr);
+        TEST_TRUE(fiber::async_memcpy_backend == nullptr);
+
+        unsigned char source[100];
+        unsigned char dest[100] = {};
+        fill_pattern(source, 100, 6);
+
+        auto [future, promise] = fiber::make_future_promise<int>();
+        fiber::async_memcpy(dest, source, 100, std::move(promise));
+
+        TEST_TRUE(future.is_ready());
+        TEST_EQUAL(future.get(), 100);
+        TEST_TRUE(equal(dest, source, 100));
+
+        // the future may be dropped before the copy completes
+        fiber::async_memcpy(dest, source, 100, fiber::Promise<int>());
+
+        TEST_END;
+    }
+
+    static fiber::TestResult async_memcpy_task_test(){
+        TEST_START;
+
+        g_mock_time = TimePoint(0);
+
+        unsigned char source[1000];
+        unsigned char dest[1000] = {};
+        fill_pattern(source, 1000, 7);
+
+        {
+            fiber::AsyncMemcpyTask task(100);
+            TEST_EQUAL(fiber::AsyncMemcpyTask::instance(), &task);
+            TEST_TRUE(fiber::async_memcpy_backend != nullptr);
+
+            // a second task would silently take over the copies
+            TEST_THROW(fiber::AsyncMemcpyTask(100));
+            TEST_EQUAL(fiber::AsyncMemcpyTask::instance(), &task);
+
+            Scheduler<1> scheduler(get_time);
+            scheduler.add(&task);
+
+            auto [future1, promise1] = fiber::make_future_promise<int>();
+            auto [future2, promise2] = fiber::make_future_promise<int>();
+            fiber::async_memcpy(dest, source, 950, std::move(promise1));
+            fiber::async_memcpy(dest + 950, source + 950, 50, std::move(promise2));
+
+            TEST_EQUAL(task.n_jobs(), 2);
+            TEST_TRUE(future1.is_waiting());
+
+            // one chunk per cycle
+            int n_spins = 0;
+            while(future1.is_waiting() && n_spins < 100){
+                scheduler.spin();
+                ++n_spins;
+            }
+            TEST_EQUAL(n_spins, 10);
+            TEST_EQUAL(future1.get(), 950);
+            TEST_TRUE(future2.is_waiting());
+
+            scheduler.spin();
+            TEST_EQUAL(future2.get(), 50);
+            TEST_EQUAL(task.n_jobs(), 0);
+            TEST_TRUE(equal(dest, source, 1000));
+
+            // idle: the task waits for new copies
+            scheduler.spin();
+            scheduler.spin();
+            TEST_EQUAL(scheduler.n_awaiting(), 1);
+
+            // a full queue falls back to a blocking copy
+            fiber::Future<int> futures[fiber::AsyncMemcpyTask::max_jobs + 1];
+            for(fiber::Future<int>& future : futures){
+                auto [f, p] = fiber::make_future_promise<int>();
+                future = std::move(f);
+                fiber::async_memcpy(dest, source, 10, std::move(p));
+            }
+            TEST_EQUAL(task.n_jobs(), fiber::AsyncMemcpyTask::max_jobs);
+            TEST_TRUE(futures[0].is_waiting());
+            TEST_TRUE(futures[fiber::AsyncMemcpyTask::max_jobs].is_ready());
+
+            for(int i = 0; i < 20 && task.n_jobs() != 0; ++i){scheduler.spin();}
+            for(fiber::Future<int>& future : futures){
+                TEST_EQUAL(future.get(), 10);
+            }
+
+            task.destroy();
+        }
+
+        TEST_EQUAL(fiber::AsyncMemcpyTask::instance(), nullptr);
+        TEST_TRUE(fiber::async_memcpy_backend == nullptr);
+
+        TEST_END;
+    }
+
+#if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+
+    /// @brief Two threads queue copies while the task copies them on a third one
+    static fiber::TestResult async_memcpy_task_multi_core_test(){
+        TEST_START;
+
+        static constexpr int n_copies = 500;
+        static constexpr int size = 64;
+
+        g_mock_time = TimePoint(0);
+        unsigned char source[size];
+        fill_pattern(source, size, 8);
+
+        fiber::AsyncMemcpyTask task(16);
+        std::atomic<bool> stop = false;
+
+        std::thread copy_core([&](){
+            Scheduler<1> scheduler(get_time);
+            scheduler.add(&task);
+            while(!stop.load(std::memory_order_acquire)){
+                scheduler.spin();
+            }
+            task.destroy();
+        });
+
+        std::atomic<int> n_correct = 0;
+        auto producer = [&](){
+            unsigned char dest[size];
+            for(int i = 0; i < n_copies; ++i){
+                for(unsigned char& c : dest){c = 0;}
+                auto [future, promise] = fiber::make_future_promise<int>();
+                fiber::async_memcpy(dest, source, size, std::move(promise));
+                while(!future.is_ready()){std::this_thread::yield();}
+                n_correct += (future.get() == size) && equal(dest, source, size);
+            }
+        };
+
+        std::thread producer_core(producer);
+        producer();
+        producer_core.join();
+
+        stop.store(true, std::memory_order_release);
+        copy_core.join();
+
+        TEST_EQUAL(n_correct.load(), 2 * n_copies);
+        TEST_EQUAL(task.n_jobs(), 0);
+
+        TEST_END;
+    }
+
+#endif
+
+    fiber::TestResult memory_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | memcpy_test
+            | memset_test
+            | memmove_test
+            | memcmp_test
+            | async_memcpy_blocking_fallback_test
+            | async_memcpy_task_test
+            #if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+            | async_memcpy_task_multi_core_test
+            #endif
+            ;
+    }
+} // namespace fiber
@@ -9,6 +9,8 @@
 #include <utility>
 
 //fiber
+#include <fiber/Containers/IntrusiveList.hpp>
+#include <fiber/Containers/IntrusivePairingHeap.hpp>
 #include <fiber/Exceptions/Exceptions.hpp>
 #include <fiber/OS/Exit.hpp>
 #include <fiber/Memory/StackAllocator.hpp>
@@ -249,9 +251,16 @@ namespace fiber{
         uint32_t _priority = 0; // higher number = higher priority
         Schedule _schedule;
         TimePoint _execution_start;
+        TimePoint _cycle_start; // start of the first resume since the last cycle or delay
         
         uint16_t _id = 0;
 
+        bool _cycle_started = false;
+
+        // links of the scheduler queues, a task is in at most one of them, see `fiber::Scheduler`
+        PairingHeapHook<TaskBase> _heap_hook; // waiting or running queue
+        ListHook<TaskBase> _list_hook; // awaiting list
+
         bool _instant_resume = false;
         bool _immediatelly_ready = false; // if true, ignores `_ready_time` when entering the scheduler
 
@@ -273,7 +282,9 @@ namespace fiber{
             , _priority(other._priority)
             , _schedule(other._schedule)
             , _execution_start(other._execution_start)
+            , _cycle_start(other._cycle_start)
             , _id(other._id)
+            , _cycle_started(other._cycle_started)
             , _instant_resume(other._instant_resume)
             , _immediatelly_ready(other._immediatelly_ready)
         {
@@ -292,7 +303,9 @@ namespace fiber{
                 this->_priority = other._priority;
                 this->_schedule = other._schedule;
                 this->_execution_start = other._execution_start;
+                this->_cycle_start = other._cycle_start;
                 this->_id = other._id;
+                this->_cycle_started = other._cycle_started;
                 this->_instant_resume = other._instant_resume;
                 this->_immediatelly_ready = other._immediatelly_ready;
 
@@ -430,6 +443,7 @@ namespace fiber{
          * @brief Overrideable: Gets called after a `co_await NextCycle;` to calculate the schedule of the next cycle.
          * 
          * Note that `previous_execution.end` is equivalent to the current time .aka `now()`
+         * and `previous_execution.start` is the start of the first resume of this cycle, even if the task awaited in between.
          * 
          * @param previous_schedule the previous schedule of this task
          * @param previous_execution the previous execution time from the start of the cycle to the end of the cycle
@@ -574,7 +588,7 @@ namespace fiber{
                     lhs_deadline_rhs_priority = 0b10,
                     both_deadline = 0b11
                 };
-                const Cases Case = static_cast<Cases>((static_cast<unsigned int>(lhs->is_deadline_based()) << 1) || (static_cast<unsigned int>(rhs->is_deadline_based()) << 0));
+                const Cases Case = static_cast<Cases>((static_cast<unsigned int>(lhs->is_deadline_based()) << 1) | (static_cast<unsigned int>(rhs->is_deadline_based()) << 0));
                 bool result = false;
                 switch(Case){
                     case Cases::both_priority: result = lhs->_priority < rhs->_priority; break;
@@ -1,59 +1,346 @@
 #pragma once
 
+// std
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// fiber
+#include <fiber/Chrono/Duration.hpp>
 #include <fiber/Chrono/TimePoint.hpp>
+#include <fiber/Exceptions/Exceptions.hpp>
+#include <fiber/OS/NextCycle.hpp>
 #include <fiber/OS/Task.hpp>
 
 namespace fiber{
 
-    class PeriodicTask : public Task{
+    /**
+     * \brief A histogram of durations with `n_bins` bins of equal width
+     *
+     * Bin `i` counts the durations in `[i * bin_width, (i+1) * bin_width)`,
+     * the last bin also counts all durations that are longer.
+     *
+     * \tparam n_bins The number of bins, at least one
+     */
+    template<std::size_t n_bins>
+    class TimingHistogram{
+        static_assert(n_bins > 0, "A histogram needs at least one bin");
+    private:
+        std::array<uint32_t, n_bins> _bins{};
+        Duration _bin_width = Duration(1u);
+        Duration _max = Duration(0u);
+        uint32_t _count = 0;
+
     public:
+        constexpr TimingHistogram() = default;
+
+        /// @param bin_width the width of each bin, larger than zero
+        constexpr explicit TimingHistogram(Duration bin_width){this->reset(bin_width);}
+
+        /// @brief clears all bins and keeps the bin width
+        constexpr void reset(){
+            this->_bins.fill(0);
+            this->_max = Duration(0u);
+            this->_count = 0;
+        }
+
+        /// @brief clears all bins and sets a new bin width, larger than zero
+        constexpr void reset(Duration bin_width){
+            FIBER_ASSERT_O1_MSG(bin_width != Duration(0u), "The bin width of a histogram has to be larger than zero!");
+            this->_bin_width = bin_width;
+            this->reset();
+        }
+
+        /// @brief counts the duration in its bin, negative durations count as zero
+        constexpr void record(Duration d){
+            if(d < Duration(0u)) d = Duration(0u);
+            const auto index = static_cast<std::size_t>(d.count().value / this->_bin_width.count().value);
+            this->_bins[(index < n_bins) ? index : n_bins - 1] += 1;
+            if(this->_max < d) this->_max = d;
+            this->_count += 1;
+        }
+
+        /// @brief returns the number of bins
+        static constexpr std::size_t size(){return n_bins;}
+
+        /// @brief returns the number of recorded durations in bin `i`
+        constexpr uint32_t operator[](std::size_t i) const {return this->_bins[i];}
+
+        /// @brief returns all bins
+        constexpr const std::array<uint32_t, n_bins>& bins() const {return this->_bins;}
+
+        /// @brief returns the width of each bin
+        constexpr Duration bin_width() const {return this->_bin_width;}
+
+        /// @brief returns the number of recorded durations
+        constexpr uint32_t count() const {return this->_count;}
+
+        /// @brief returns the longest recorded duration
+        constexpr Duration max() const {return this->_max;}
+
+        /// @brief returns the number of recorded durations that were at least as long as the last bin starts
+        constexpr uint32_t overflows() const {return this->_bins[n_bins - 1];}
+    };
+
+    /**
+     * \brief Release jitter and response time statistics of a periodic task
+     *
+     * - `release`: the time from the planned release (ready time) to the first resume of the cycle
+     * - `response`: the time from the planned release to the `co_await NextCycle()` that ends the cycle
+     *
+     * \tparam n_bins The number of bins of each histogram
+     */
+    template<std::size_t n_bins>
+    class CycleStatistics{
+    private:
+        TimingHistogram<n_bins> _release;
+        TimingHistogram<n_bins> _response;
+        uint32_t _deadline_misses = 0;
+        uint32_t _overruns = 0;
+
+    public:
+        constexpr CycleStatistics() = default;
+
+        /// @param bin_width the bin width of both histograms
+        constexpr explicit CycleStatistics(Duration bin_width)
+            : _release(bin_width)
+            , _response(bin_width){}
+
+        /// @brief records a finished cycle
+        constexpr void record(Schedule schedule, ExecutionTime execution){
+            this->_release.record(execution.start - schedule.ready);
+            this->_response.record(execution.end - schedule.ready);
+            if(schedule.deadline < execution.end) this->_deadline_misses += 1;
+        }
+
+        /// @brief counts releases that have been skipped
+        constexpr void record_overruns(uint32_t n){this->_overruns += n;}
+
+        /// @brief clears all statistics
+        constexpr void reset(){
+            this->_release.reset();
+            this->_response.reset();
+            this->_deadline_misses = 0;
+            this->_overruns = 0;
+        }
+
+        /// @brief histogram of the times from the planned release to the start of the cycle
+        constexpr TimingHistogram<n_bins>& release_jitter(){return this->_release;}
+        constexpr const TimingHistogram<n_bins>& release_jitter() const {return this->_release;}
+
+        /// @brief histogram of the times from the planned release to the end of the cycle
+        constexpr TimingHistogram<n_bins>& response_time(){return this->_response;}
+        constexpr const TimingHistogram<n_bins>& response_time() const {return this->_response;}
+
+        /// @brief returns the number of finished cycles
+        constexpr uint32_t cycles() const {return this->_response.count();}
+
+        /// @brief returns the number of cycles that ended after their deadline
+        constexpr uint32_t deadline_misses() const {return this->_deadline_misses;}
+
+        /// @brief returns the number of releases that have been skipped, because a cycle ended later than the next release
+        constexpr uint32_t overruns() const {return this->_overruns;}
+    };
+
+    namespace detail{
+
+        /// spreads the deadline over the bins, at least one tick per bin
+        constexpr Duration default_bin_width(Duration deadline, std::size_t n_bins){
+            const Duration width(deadline.count() / Duration::rep(n_bins));
+            return (width == Duration(0u)) ? Duration(1u) : width;
+        }
+
+    } // namespace detail
+
+    /**
+     * \brief A deadline-based task that is released at a fixed period
+     *
+     * Each `co_await NextCycle()` ends a cycle. The next release is exactly one period after the previous release,
+     * so the releases never drift, no matter how late the task has been started.
+     * If a cycle ends after one or more of the following releases, these are skipped and counted as overruns.
+     *
+     * Tasks that share the same `epoch` and harmonic periods are released at the same ticks.
+     * Pass different `phase`s to spread them out:
+     *
+     * ```C++
+     * Coroutine<Exit> control_loop(){
+     *     while(true){
+     *         // ...
+     *         co_await NextCycle();
+     *     }
+     * }
+     *
+     * const TimePoint epoch = scheduler.now();
+     * PeriodicTask<256> fast("fast", epoch, 1ms, 100us, control_loop);
+     * PeriodicTask<256> slow("slow", epoch, 4ms, 1ms, 500us, control_loop); // released 500us after `fast`
+     * ```
+     *
+     * The task records the release jitter and the response time of each cycle in `statistics()`.
+     * The bin width of the histograms defaults to the deadline divided by `n_bins`.
+     *
+     * \tparam frame_size The number of bytes of the tasks frame allocator
+     * \tparam n_bins The number of bins of the jitter and response time histograms
+     */
+    template<std::size_t frame_size, std::size_t n_bins = 8>
+    class PeriodicTask : public Task<frame_size>{
+    private:
         Duration _period;
         Duration _deadline;
+        CycleStatistics<n_bins> _statistics;
 
-    private:
+    public:
 
-        PeriodicTask(Coroutine<fiber::Exit>&& main, std::string_view name, Duration period, Duration deadline, TimePoint first_ready)
-            : Task<Clock>(std::move(main), name, first_ready, deadline)
+        /**
+         * \brief creates a periodic task that is first released at `epoch + phase`
+         * \param period the time between two releases, larger than zero
+         * \param deadline the deadline relative to each release
+         * \param phase the offset of the releases from the `epoch`
+         */
+        template <class F, class... Args>
+        requires
+            std::invocable<F, Args...> &&
+            std::same_as<std::invoke_result_t<F, Args...>, Coroutine<fiber::Exit>>
+        constexpr PeriodicTask(std::string_view task_name, TimePoint epoch, Duration period, Duration deadline, Duration phase, F&& function, Args&&... args)
+            : Task<frame_size>(task_name, epoch + phase, deadline, std::forward<F>(function), std::forward<Args>(args)...)
             , _period(period)
-            , _deadline(deadline){}
+            , _deadline(deadline)
+            , _statistics(detail::default_bin_width(deadline, n_bins))
+        {
+            FIBER_ASSERT_O1_MSG(period != Duration(0u), "A periodic task needs a period larger than zero!");
+        }
+
+        /**
+         * \brief creates a periodic task that is first released at `epoch`
+         * \param period the time between two releases, larger than zero
+         * \param deadline the deadline relative to each release
+         */
+        template <class F, class... Args>
+        requires
+            std::invocable<F, Args...> &&
+            std::same_as<std::invoke_result_t<F, Args...>, Coroutine<fiber::Exit>>
+        constexpr PeriodicTask(std::string_view task_name, TimePoint epoch, Duration period, Duration deadline, F&& function, Args&&... args)
+            : PeriodicTask(task_name, epoch, period, deadline, Duration(0u), std::forward<F>(function), std::forward<Args>(args)...){}
 
-        RealTimeSchedule<Clock> next_schedule(RealTimeSchedule schedule, [[maybe_unused]]ExecutionTime execution){
+        Schedule next_schedule(Schedule schedule, ExecutionTime execution) override {
+            this->_statistics.record(schedule, execution);
             schedule.ready += this->_period;
+            uint32_t overruns = 0;
+            while(schedule.ready + this->_period <= execution.end){
+                schedule.ready += this->_period;
+                ++overruns;
+            }
+            this->_statistics.record_overruns(overruns);
             schedule.deadline = schedule.ready + this->_deadline;
             return schedule;
         }
 
-    };
+        /// @brief returns the time between two releases
+        constexpr Duration period() const {return this->_period;}
 
-    class SoftPeriodicTask : public Task{
-    public:
+        /// @brief returns the deadline relative to each release
+        constexpr Duration relative_deadline() const {return this->_deadline;}
+
+        /// @brief returns the release jitter and response time statistics
+        constexpr CycleStatistics<n_bins>& statistics(){return this->_statistics;}
+        constexpr const CycleStatistics<n_bins>& statistics() const {return this->_statistics;}
+    };
 
-        TimePoint _prev_execution;
+    /**
+     * \brief A deadline-based task whose measured period follows the nominal period
+     *
+     * Unlike `fiber::PeriodicTask`, the next release is computed from the actual start of the cycle.
+     * A systematic release latency would make such a task run slower than its period, so the task
+     * measures the time between two cycle starts and sums up the errors. The release is shifted by
+     * the sum divided by `2^gain_shift`, like the integral part of a phase-locked loop,
+     * so even errors smaller than a tick accumulate. The offset settles at the negative release latency,
+     * so the average period matches the nominal period without the releases being tied to a fixed grid.
+     *
+     * Use it for loops that should keep their rate, but may shift their phase, for example after long cycles.
+     *
+     * \tparam frame_size The number of bytes of the tasks frame allocator
+     * \tparam n_bins The number of bins of the jitter and response time histograms
+     */
+    template<std::size_t frame_size, std::size_t n_bins = 8>
+    class SoftPeriodicTask : public Task<frame_size>{
+    private:
+        TimePoint _previous_start;
         Duration _period;
         Duration _deadline;
-        Duration _offset = 0;
+        Duration _integrator = Duration(0u); // sum of all period errors, the offset is a fraction of it
+        CycleStatistics<n_bins> _statistics;
 
-    private:
+    public:
+        /// the offset is the sum of all period errors divided by `2^gain_shift`
+        static constexpr unsigned int gain_shift = 5;
 
-        PeriodicTask(Coroutine<fiber::Exit>&& main, std::string_view name, Duration period, Duration deadline, TimePoint first_ready)
-            : Task<Clock>(std::move(main), name, first_ready, deadline)
-            , _prev_execution(first_ready - period)
+        /**
+         * \brief creates a soft periodic task that is first released at `epoch + phase`
+         * \param period the nominal time between two releases, larger than zero
+         * \param deadline the deadline relative to each release
+         * \param phase the offset of the first release from the `epoch`
+         */
+        template <class F, class... Args>
+        requires
+            std::invocable<F, Args...> &&
+            std::same_as<std::invoke_result_t<F, Args...>, Coroutine<fiber::Exit>>
+        constexpr SoftPeriodicTask(std::string_view task_name, TimePoint epoch, Duration period, Duration deadline, Duration phase, F&& function, Args&&... args)
+            : Task<frame_size>(task_name, epoch + phase, deadline, std::forward<F>(function), std::forward<Args>(args)...)
+            , _previous_start(epoch + phase - period)
             , _period(period)
             , _deadline(deadline)
-            {}
+            , _statistics(detail::default_bin_width(deadline, n_bins))
+        {
+            FIBER_ASSERT_O1_MSG(period != Duration(0u), "A periodic task needs a period larger than zero!");
+        }
 
-        RealTimeSchedule next_schedule(RealTimeSchedule schedule, ExecutionTime execution){
-            const duration measured_period = execution.start - _prev_execution;
-            const duration error = this->_period - measured_period;
-            this->_offset += error / 32;
-            RealTimeSchedule<Clock> new_schedule;
-            new_schedule.ready = execution.start + this->_period + this->_offset;
-            new_schedule.deadline = new_schedule.ready + this->_deadline + this->_offset;
-            return new_schedule
+        /**
+         * \brief creates a soft periodic task that is first released at `epoch`
+         * \param period the nominal time between two releases, larger than zero
+         * \param deadline the deadline relative to each release
+         */
+        template <class F, class... Args>
+        requires
+            std::invocable<F, Args...> &&
+            std::same_as<std::invoke_result_t<F, Args...>, Coroutine<fiber::Exit>>
+        constexpr SoftPeriodicTask(std::string_view task_name, TimePoint epoch, Duration period, Duration deadline, F&& function, Args&&... args)
+            : SoftPeriodicTask(task_name, epoch, period, deadline, Duration(0u), std::forward<F>(function), std::forward<Args>(args)...){}
+
+        Schedule next_schedule(Schedule schedule, ExecutionTime execution) override {
+            this->_statistics.record(schedule, execution);
+            const Duration measured_period = execution.start - this->_previous_start;
+            const Duration error = this->_period - measured_period;
+            this->_integrator += error;
+            this->_previous_start = execution.start;
+
+            schedule.ready = execution.start + this->_period + this->offset();
+            schedule.deadline = schedule.ready + this->_deadline;
+            return schedule;
         }
 
-    };
+        /// @brief returns the nominal time between two releases
+        constexpr Duration period() const {return this->_period;}
 
-} // namespace fiber
+        /// @brief returns the deadline relative to each release
+        constexpr Duration relative_deadline() const {return this->_deadline;}
+
+        /// @brief returns the current correction of the release time, usually the negative release latency
+        constexpr Duration offset() const {return fraction(this->_integrator);}
+
+        /// @brief returns the release jitter and response time statistics
+        constexpr CycleStatistics<n_bins>& statistics(){return this->_statistics;}
+        constexpr const CycleStatistics<n_bins>& statistics() const {return this->_statistics;}
 
+    private:
+        /// divides the overflow aware (signed) duration by `2^gain_shift`, rounding towards zero
+        static constexpr Duration fraction(Duration d){
+            using rep = Duration::rep;
+            const rep divisor(static_cast<DurationRepresentation>(1u << gain_shift));
+            if(d < Duration(0u)){
+                return Duration(-((-d.count()) / divisor));
+            }else{
+                return Duration(d.count() / divisor);
+            }
+        }
+    };
 
+} // namespace fiber
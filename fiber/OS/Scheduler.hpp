@@ -3,14 +3,18 @@
 // std
 #include <variant>
 #include <concepts>
+#include <limits>
 #include <ranges>
 #include <string_view>
 
 // fiber
 #include <fiber/Chrono/TimePoint.hpp>
-#include <fiber/Containers/ArrayList.hpp>
-#include <fiber/Containers/DualPriorityQueue.hpp>
+#include <fiber/Containers/IntrusiveList.hpp>
+#include <fiber/Containers/IntrusivePairingHeap.hpp>
+#include <fiber/Future/Continuation.hpp>
 #include <fiber/OS/Task.hpp>
+#include <fiber/OS/TimerService.hpp>
+#include <fiber/OStream/JsonWriter.hpp>
 #include <fiber/OStream/OStream.hpp>
 #include <fiber/OStream/ansi.hpp>
 #include <fiber/OStream/utf8_lines.hpp>
@@ -18,13 +22,6 @@
 namespace fiber
 {
     
-    /**
-     * @brief Default implementation for a function that should send the MCU to sleep until `time`, but does nothing.
-     */
-    void default_sleep_until([[maybe_unused]]TimePoint time){
-        return;
-    }
-
     /**
      * @brief The concept for a logging device that can be passed into the Scheduler
      */
@@ -178,55 +175,64 @@ namespace fiber
      * - running: a priority list, sorted by the earliest deadlines.
      * - awaiting: a list containing all tasks that are waiting on an awaitable or future.
      * 
-     * @tparam n_tasks The maximum number of thats that will be pre-allocated for this scheduler.
+     * Additionally it runs continuations (see `fiber::Future::then()`) without a task of their own. Completing their futures
+     * pushes them into a ready list, so continuations that still wait cost nothing per `spin()`.
+     * 
+     * The queues are intrusive: the links live in the tasks (`TaskBase::_heap_hook` and `TaskBase::_list_hook`),
+     * so moving a task between queues never copies or allocates and the scheduler itself has a constant size.
+     * The priority lists are pairing heaps: adding is O(1), taking the top and removing any task O(log n) amortised.
+     * 
+     * @tparam n_tasks The maximum number of tasks that may be added at the same time, only checked by assertions. No memory is reserved for them.
      * @tparam logger A logger that implements the functions defined by `fiber::CSchedulerLogger`
      */
-    template<size_t n_tasks, CSchedulerLogger logger = NullLogger>
+    template<size_t n_tasks = std::numeric_limits<size_t>::max(), CSchedulerLogger logger = NullLogger>
     class Scheduler {
     private:
-        using dual_priority_queue_type = DualPriorityQueue<TaskBase*, n_tasks, TaskBase::larger_ready_time_s, TaskBase::less_priority_s>;
-        using dual_array_list_type = DualArrayList<TaskBase*, n_tasks>;
-
-        using waiting_queue_ref = Stage1DualPriorityQueueRef<TaskBase*, n_tasks, TaskBase::larger_ready_time_s, TaskBase::less_priority_s>;
-        using running_queue_ref = Stage2DualPriorityQueueRef<TaskBase*, n_tasks, TaskBase::larger_ready_time_s, TaskBase::less_priority_s>;
-
-        using waiting_queue_const_ref = Stage1DualPriorityQueueConstRef<TaskBase*, n_tasks, TaskBase::larger_ready_time_s, TaskBase::less_priority_s>;
-        using running_queue_const_ref = Stage2DualPriorityQueueConstRef<TaskBase*, n_tasks, TaskBase::larger_ready_time_s, TaskBase::less_priority_s>;
+        using waiting_queue_type = IntrusivePairingHeap<TaskBase, &TaskBase::_heap_hook, TaskBase::larger_ready_time_s>;
+        using running_queue_type = IntrusivePairingHeap<TaskBase, &TaskBase::_heap_hook, TaskBase::less_priority_s>;
+        using awaiting_list_type = IntrusiveList<TaskBase, &TaskBase::_list_hook>;
         
         TimePoint (*_now)(); // function pointer to a function returning the current time
         void (*_sleep_until)(TimePoint); // function pointer to a function returning the current time
 
-        // TODO: dual priority queue with an unordered list to save more memory
-        //       [stage 2 priority queue][reserve][unordered list][reserve][stage 1 priority list]
-        //       consider if the complexity is worth it - probably not!
-        dual_priority_queue_type _priority_queue; // ready + deadline
-        ArrayList<TaskBase*, n_tasks> _await_bench;
+        waiting_queue_type _waiting_queue; // sorted by the earliest ready time
+        running_queue_type _running_queue; // sorted by the highest priority, then the earliest deadline
+        awaiting_list_type _awaiting_list;
+        ContinuationList _continuations; // ready continuations, intrusive, so continuations do not count towards `n_tasks`
+        size_t _n_continuations = 0; // continuations that are not done yet
+        TimerService* _timers = nullptr; // optional software timers, see `attach()`
         unsigned int _next_task_id = 0; // next id for the next added task
 
 
     private:
 
-        waiting_queue_ref waiting_queue(){return this->_priority_queue;}
-        running_queue_ref running_queue(){return this->_priority_queue;}
+        waiting_queue_type& waiting_queue(){return this->_waiting_queue;}
+        running_queue_type& running_queue(){return this->_running_queue;}
 
-        waiting_queue_const_ref waiting_queue() const {return this->_priority_queue;}
-        running_queue_const_ref running_queue() const {return this->_priority_queue;}
+        const waiting_queue_type& waiting_queue() const {return this->_waiting_queue;}
+        const running_queue_type& running_queue() const {return this->_running_queue;}
 
         /**
          * @brief Moves tasks that got ready from the waiting- and awaiting-queue into the running queue
          * 
-         * 1. Checks all tasks from the awaiting-queue that return `true` on `.await_ready()` and moves them into the running queue.
-         * 2. Moves the top of the waiting priority queue that got ready into the running queue.
+         * 1. Runs all continuations whose futures completed.
+         * 2. Checks all tasks from the awaiting-queue that return `true` on `.await_ready()` and moves them into the running queue.
+         * 3. Moves the top of the waiting priority queue that got ready into the running queue.
          */
         void promote(){
+            // run expired timers first, they may complete promises
+            if(this->_timers != nullptr) this->_timers->poll();
+
+            // run continuations, so that tasks awaiting their futures can be promoted right away
+            this->_n_continuations -= this->_continuations.poll();
+
             // promote await back into running queue
-            for(TaskBase* task : this->_await_bench){
-                if(!task->is_awaiting()){
+            this->_awaiting_list.erase_if(
+                [](const TaskBase* task){return !task->is_awaiting();},
+                [this](TaskBase* task){
                     logger::log_move(this->now(), task->name(), task->id(), "await", "run");
                     this->running_queue().push(task);
-                }
-            }
-            this->_await_bench.erase_if([](const TaskBase* task){return !task->is_awaiting();});
+                });
 
             // promote waiting queue into running queue
             while(!this->waiting_queue().empty()){
@@ -246,7 +252,15 @@ namespace fiber
          * \brief Sleep until the top of the waiting list
          */
         void sleep(){
-            this->_sleep_until(this->waiting_queue().top()->ready_time());
+            if(this->_timers != nullptr){
+                if(!this->waiting_queue().empty()){
+                    this->_timers->sleep_until(this->waiting_queue().top()->ready_time());
+                }else{
+                    this->_timers->sleep();
+                }
+            }else if(!this->waiting_queue().empty()){
+                this->_sleep_until(this->waiting_queue().top()->ready_time());
+            }
         }
 
         /**
@@ -257,29 +271,41 @@ namespace fiber
          * If the task sent a: 
          * - <b><code>NextCycle</code> signal</b>: the scheduler will call the tasks `.next_schedule()` method to calculate its next schedule and puts it back into the waiting priority list.
          * - <b><code>Await</code> signal</b>: the task will be put on the `await queue` until the awaitable signals `true` on `.await_ready()`.
-         * - <b><code>Implicit/ExplicitDelay</code> signal</b>: the scheduler will calculate the next schedule of the task using the given delay.
+         * - <b><code>Implicit/ExplicitDelay</code> signal</b>: the scheduler will calculate the next schedule of the task using the given delay and puts it back into the waiting priority list.
          * - <b><code>None</code></b>: (happens when the task ends) the task will be removed from the scheduler and not put back into any queue.
          * 
+         * Priority-based tasks that start immediatelly only ignore their ready time on the first run.
+         * After a `NextCycle` or a delay they wait in the waiting queue like every other task.
+         * 
          * @see fiber::CoSignal
          * @see fiber::AwaitableNode
          */
         void run_next(){
             TaskBase* task = this->running_queue().top_pop();
             task->_execution_start = this->now();
+            if(!task->_cycle_started){
+                task->_cycle_start = task->_execution_start;
+                task->_cycle_started = true;
+            }
             fiber::detail::frame_allocator = task->_frame_allocator;
             task->resume();
             logger::log_resume(task->_execution_start, this->now(), task->name(), task->id());
             // re-schedule
             
             const CoSignal signal = task->get_signal();
+            if(signal.type() == CoSignal::Type::NextCycle || signal.type() == CoSignal::Type::ImplicitDelay || signal.type() == CoSignal::Type::ExplicitDelay){
+                // only the first start ignores the ready time, delays and cycles of priority-based tasks have to wait
+                task->_immediatelly_ready = false;
+                task->_cycle_started = false;
+            }
             switch(signal.type()){
                 case CoSignal::Type::Await : {
                     // clear signal
-                    this->_await_bench.emplace_back(task);
+                    this->_awaiting_list.push_back(task);
                     logger::log_move(this->now(), task->name(), task->id(), "resume", "await");
                 }break;
                 case CoSignal::Type::NextCycle : {
-                    task->_schedule = task->next_schedule(task->_schedule, ExecutionTime{task->_execution_start, this->now()});
+                    task->_schedule = task->next_schedule(task->_schedule, ExecutionTime{task->_cycle_start, this->now()});
                     this->waiting_queue().push(task);
                     logger::log_move(this->now(), task->name(), task->id(), "resume", "wait");
                 }break;
@@ -293,6 +319,7 @@ namespace fiber
                 case CoSignal::Type::ExplicitDelay : {
                     task->_schedule.ready = this->now() + fiber::rounding_duration_cast<Duration>(signal.delay());
                     task->_schedule.deadline = task->_schedule.ready + fiber::rounding_duration_cast<Duration>(signal.deadline());
+                    this->waiting_queue().push(task);
                     logger::log_move(this->now(), task->name(), task->id(), "resume", "wait");
                 }break;
                 case CoSignal::Type::None : {
@@ -349,6 +376,62 @@ namespace fiber
             }
         }
 
+        /**
+         * @brief Removes a task from the scheduler without running it again
+         * 
+         * Unlinks the task from the waiting or running queue in O(log n) amortised or from the awaiting list in O(1).
+         * The task is not destroyed, it may be added again later.
+         * A task cannot remove itself while it runs, let it `co_return` instead.
+         * 
+         * @returns `true` if the task has been removed and `false` if it was not in any queue of this scheduler
+         */
+        bool remove(TaskBase* task){
+            if(this->waiting_queue().contains(task)){
+                this->waiting_queue().erase(task);
+            }else if(this->running_queue().contains(task)){
+                this->running_queue().erase(task);
+            }else if(this->_awaiting_list.contains(task)){
+                this->_awaiting_list.erase(task);
+            }else{
+                return false;
+            }
+            logger::log_delete(this->now(), task->name(), task->id());
+            return true;
+        }
+
+        /**
+         * @brief Adds a continuation to the scheduler
+         * 
+         * The continuation subscribes at its future and is run by the next `spin()` after the future has been completed.
+         * Continuations are kept in an intrusive list and do not take up any of the `n_tasks` slots.
+         * The continuation may not be moved or destroyed before it is done.
+         * 
+         * @see fiber::Future::then()
+         */
+        void add(ContinuationNode* continuation){
+            ++this->_n_continuations;
+            this->_continuations.add(continuation);
+        }
+
+        /**
+         * @brief Lets the scheduler poll the software timers of `timers` and sleep through it
+         *
+         * Expired timers are run at the start of every `spin()`. If no task is ready, the scheduler calls
+         * `TimerService::sleep_until()` instead of its own `sleep_until` function, so the hardware is programmed
+         * for the earlier of the next task and the next timer.
+         * Timers do not count towards `n_tasks` and do not keep `is_done()` from returning `true`.
+         *
+         * @param timers The timer service, has to outlive the scheduler or be detached with `detach_timers()`
+         */
+        void attach(TimerService& timers){
+            this->_timers = &timers;
+        }
+
+        /// @brief stops polling the attached timer service
+        void detach_timers(){
+            this->_timers = nullptr;
+        }
+
         /**
          * @brief Checks the state of Tasks and executes one if ready
          * 
@@ -367,10 +450,9 @@ namespace fiber
         /**
          * @brief returns the capacity of the scheduler
          * 
-         * The capacity represents the number of total tasks that can be added without reallocation.
-         * For static schedulers (like this one) `.capacity()` is equivalent to `.max_size()`.
-         * 
-         * To increase the capacity increase the template parameter `n_tasks`.
+         * The capacity is the number of tasks that may be added at the same time, the template parameter `n_tasks`.
+         * The queues are intrusive, so the capacity does not reserve any memory.
+         * `.capacity()` is equivalent to `.max_size()`.
          */ 
         constexpr size_t capacity() const {return n_tasks;}
 
@@ -402,7 +484,12 @@ namespace fiber
          * 
          * Tasks that are in the awaiting queue are waiting for a future or awaitable to become ready.
          */
-        constexpr size_t n_awaiting() const {return this->_await_bench.size();}
+        constexpr size_t n_awaiting() const {return this->_awaiting_list.size();}
+
+        /**
+         * @brief returns the number of continuations that still wait on their futures
+         */
+        constexpr size_t n_continuations() const {return this->_n_continuations;}
 
         /**
          * @brief returns the current number of tasks that this scheduler manages.
@@ -431,10 +518,10 @@ namespace fiber
         }
 
         /**
-         * @brief returns `true` if there are no tasks in any queue
+         * @brief returns `true` if there are no tasks in any queue and no waiting continuations
          */
         constexpr bool is_empty() const {
-            return this->_priority_queue.empty() && this->_await_bench.empty();
+            return this->waiting_queue().empty() && this->running_queue().empty() && this->_awaiting_list.empty() && this->_n_continuations == 0;
         }
 
         /**
@@ -443,10 +530,10 @@ namespace fiber
         constexpr bool is_full() const {return this->reserve() == 0;}
 
         /**
-         * @brief returns `true` if there are no tasks in the sheduler
+         * @brief returns `true` if there are no tasks and no waiting continuations in the sheduler
          */
         constexpr bool is_done() const {
-            return this->_priority_queue.empty() && this->_await_bench.empty();
+            return this->waiting_queue().empty() && this->running_queue().empty() && this->_awaiting_list.empty() && this->_n_continuations == 0;
         }
 
     private:
@@ -573,6 +660,33 @@ namespace fiber
             stream << single_horizontal << single_corner_botright;
             stream << fiber::newl;
         }
+
+        /// converts a time point to microseconds since the epoch for the JSON output
+        static auto to_json_us(TimePoint time){
+            return fiber::rounding_duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+        }
+
+        /**
+         * @brief writes a scheduler queue as a JSON array of task objects
+         * @param json An `fiber::JsonWriter` reference
+         * @param taskList A range that contains `TaskBase*` objects
+         */
+        template<std::ranges::range TaskList>
+        static void print_json_task_list(JsonWriter& json, const TaskList& taskList){
+            json.begin_array();
+            for(const TaskBase* task : taskList){
+                json.begin_object();
+                json.field("name", task->name());
+                json.field("id", task->id());
+                json.field("ready_us", to_json_us(task->ready_time()));
+                json.field("deadline_us", to_json_us(task->deadline()));
+                json.field("frame_size", task->max_frame_size());
+                json.field("alloc", task->allocated_frame_size());
+                json.field("max_alloc", task->max_allocated_frame_size());
+                json.end_object();
+            }
+            json.end_array();
+        }
     public:
 
         /**
@@ -608,11 +722,52 @@ namespace fiber
             stream << fiber::newl << "@" << now << " Waiting: " << fiber::newl;
             Scheduler::print_task_list(stream, this->waiting_queue(), 2);
             stream << fiber::newl << "@" << now << " Awaiting: " << fiber::newl;
-            Scheduler::print_task_list(stream, this->_await_bench, 2);
+            Scheduler::print_task_list(stream, this->_awaiting_list, 2);
             stream << fiber::newl;
         }
 
         void print(OStreamRef stream){if(stream.ptr) this->print(*stream.ptr);}
+
+        /**
+         * @brief writes the current state of the scheduler as one JSON object, for tools that parse the output
+         *
+         * Example output (without the line breaks):
+         * ```
+         * {"now_us":1000,"capacity":4,"n_running":0,"n_waiting":1,"n_awaiting":0,"n_continuations":0,
+         *  "running":[],
+         *  "waiting":[{"name":"Task 1","id":0,"ready_us":2000,"deadline_us":5000,"frame_size":256,"alloc":132,"max_alloc":132}],
+         *  "awaiting":[]}
+         * ```
+         * `"capacity"` is `null` for a scheduler without a limit on the number of tasks, the default `n_tasks`.
+         *
+         * @param json The writer that receives the object, it may be nested in other objects or arrays
+         */
+        void print_json(JsonWriter& json) const {
+            json.begin_object();
+            json.field("now_us", to_json_us(this->now()));
+            if constexpr (n_tasks == std::numeric_limits<size_t>::max()){
+                json.field("capacity", nullptr);
+            }else{
+                json.field("capacity", this->capacity());
+            }
+            json.field("n_running", this->n_running());
+            json.field("n_waiting", this->n_waiting());
+            json.field("n_awaiting", this->n_awaiting());
+            json.field("n_continuations", this->n_continuations());
+            json.key("running");
+            Scheduler::print_json_task_list(json, this->running_queue());
+            json.key("waiting");
+            Scheduler::print_json_task_list(json, this->waiting_queue());
+            json.key("awaiting");
+            Scheduler::print_json_task_list(json, this->_awaiting_list);
+            json.end_object();
+        }
+
+        /// @brief writes the current state of the scheduler as one JSON object, see `print_json(JsonWriter&)`
+        void print_json(OStream& stream) const {
+            JsonWriter json(stream);
+            this->print_json(json);
+        }
         
         /**
          * @brief prints the state of the scheduler. Lists all queues and their contained tasks.
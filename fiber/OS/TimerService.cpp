@@ -0,0 +1,136 @@
+#include <fiber/OS/TimerService.hpp>
+
+// std
+#include <utility>
+
+// fiber
+#include <fiber/Exceptions/Exceptions.hpp>
+
+namespace fiber
+{
+
+    // -----------------------------------------------------------------------------------------------
+    //                                          Timer
+    // -----------------------------------------------------------------------------------------------
+
+    Timer::~Timer(){
+        this->stop();
+    }
+
+    void Timer::stop(){
+        if(this->_service != nullptr) this->_service->stop(*this);
+    }
+
+    void PromiseTimer::complete(void* context){
+        PromiseTimer* timer = static_cast<PromiseTimer*>(context);
+        timer->_promise.try_set_value(timer->expiry());
+    }
+
+    Future<TimePoint> PromiseTimer::start_after(TimerService& service, Duration delay){
+        auto [future, promise] = make_future_promise<TimePoint>();
+        this->_promise = std::move(promise);
+        service.start_after(*this, delay);
+        return std::move(future);
+    }
+
+    // -----------------------------------------------------------------------------------------------
+    //                                          TimerService
+    // -----------------------------------------------------------------------------------------------
+
+    TimerService::~TimerService(){
+        while(this->_head != nullptr) this->stop(*this->_head);
+    }
+
+    void TimerService::insert(Timer& timer){
+        Timer** link = &this->_head;
+        while(*link != nullptr && !(timer._expiry < (*link)->_expiry)) link = &(*link)->_next;
+        timer._next = *link;
+        *link = &timer;
+        timer._service = this;
+    }
+
+    bool TimerService::remove(Timer& timer){
+        Timer** link = &this->_head;
+        while(*link != nullptr && *link != &timer) link = &(*link)->_next;
+        if(*link == nullptr) return false;
+        *link = timer._next;
+        timer._next = nullptr;
+        timer._service = nullptr;
+        return true;
+    }
+
+    void TimerService::start_at(Timer& timer, TimePoint expiry){
+        timer.stop();
+        timer._expiry = expiry;
+        timer._period = Duration(0u);
+        timer._overruns = 0;
+        this->insert(timer);
+    }
+
+    void TimerService::start_after(Timer& timer, Duration delay){
+        this->start_at(timer, this->now() + delay);
+    }
+
+    void TimerService::start_periodic(Timer& timer, TimePoint first, Duration period){
+        FIBER_ASSERT_O1_MSG(period != Duration(0u), "A periodic timer needs a period larger than zero! S: Use `start_at()` for one-shot timers.");
+        timer.stop();
+        timer._expiry = first;
+        timer._period = period;
+        timer._overruns = 0;
+        this->insert(timer);
+    }
+
+    void TimerService::start_periodic(Timer& timer, Duration period){
+        this->start_periodic(timer, this->now() + period, period);
+    }
+
+    void TimerService::stop(Timer& timer){
+        if(timer._service == this) this->remove(timer);
+    }
+
+    size_t TimerService::poll(){
+        size_t n = 0;
+        const TimePoint now = this->now();
+        while(this->_head != nullptr && this->_head->_expiry <= now){
+            Timer& timer = *this->_head;
+            this->_head = timer._next;
+            timer._next = nullptr;
+            timer._service = nullptr;
+
+            // restart before the callback, so that the callback may stop or restart the timer
+            if(timer.is_periodic()){
+                timer._expiry += timer._period;
+                while(timer._expiry <= now){
+                    timer._expiry += timer._period;
+                    ++timer._overruns;
+                }
+                this->insert(timer);
+            }
+
+            timer._callback(timer._context);
+            ++n;
+        }
+        return n;
+    }
+
+    size_t TimerService::size() const {
+        size_t n = 0;
+        for(const Timer* timer = this->_head; timer != nullptr; timer = timer->_next) ++n;
+        return n;
+    }
+
+    TimePoint TimerService::next_expiry() const {
+        FIBER_ASSERT_O1_MSG(this->_head != nullptr, "No timer is running!");
+        return this->_head->_expiry;
+    }
+
+    void TimerService::sleep_until(TimePoint wake_up){
+        if(this->_head != nullptr && this->_head->_expiry < wake_up) wake_up = this->_head->_expiry;
+        this->_sleep_until(wake_up);
+    }
+
+    void TimerService::sleep(){
+        if(this->_head != nullptr) this->_sleep_until(this->_head->_expiry);
+    }
+
+} // namespace fiber
@@ -0,0 +1,202 @@
+#pragma once
+
+// std
+#include <cstddef>
+
+// fiber
+#include <fiber/Chrono/Duration.hpp>
+#include <fiber/Chrono/TimePoint.hpp>
+#include <fiber/Future/Future.hpp>
+
+namespace fiber
+{
+
+    /**
+     * @brief Default implementation for a function that should send the MCU to sleep until `time`, but does nothing.
+     */
+    inline void default_sleep_until([[maybe_unused]]TimePoint time){
+        return;
+    }
+
+    class TimerService;
+
+    /**
+     * \brief A one-shot or periodic software timer that runs a short callback, managed by a `fiber::TimerService`
+     *
+     * Timers are nodes of an intrusive list, so they cost no storage in the service and no coroutine frame.
+     * The callback runs in the context that polls the service (usually the scheduler) and should return quickly.
+     * It may start or stop any timer, including its own.
+     *
+     * A timer may not be moved or copied while it is running, the destructor stops it.
+     *
+     * \see fiber::TimerService
+     */
+    class Timer{
+    private:
+        TimePoint _expiry;
+        Duration _period = Duration(0u); // zero for one-shot timers
+        void (*_callback)(void*);
+        void* _context;
+        size_t _overruns = 0;
+
+        // intrusive list of the service
+        Timer* _next = nullptr;
+        TimerService* _service = nullptr;
+
+        friend class TimerService;
+
+    public:
+
+        /**
+         * \param callback function that is called on expiry
+         * \param context pointer that is passed to the callback
+         */
+        explicit Timer(void (*callback)(void*), void* context = nullptr)
+            : _callback(callback)
+            , _context(context){}
+
+        /// @brief stops the timer
+        ~Timer();
+
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+        /// @brief stops the timer if it is running
+        void stop();
+
+        /// @brief returns `true` if the timer waits for its expiry
+        constexpr bool is_running() const {return this->_service != nullptr;}
+
+        /// @brief returns `true` if the timer restarts itself after each expiry
+        constexpr bool is_periodic() const {return this->_period != Duration(0u);}
+
+        /// @brief returns the time of the next (or last) expiry
+        constexpr TimePoint expiry() const {return this->_expiry;}
+
+        /// @brief returns the period of a periodic timer or zero
+        constexpr Duration period() const {return this->_period;}
+
+        /// @brief returns the number of periods that have been skipped because the service was polled too late
+        constexpr size_t overruns() const {return this->_overruns;}
+    };
+
+    /**
+     * \brief A timer that completes a `fiber::Promise` on expiry, so tasks and continuations can await it
+     *
+     * Example:
+     * ```C++
+     * fiber::PromiseTimer timeout;
+     * fiber::Future<fiber::TimePoint> expired = timeout.start_after(timers, 10ms);
+     * ```
+     */
+    class PromiseTimer : public Timer{
+    private:
+        Promise<TimePoint> _promise;
+
+        static void complete(void* context);
+
+    public:
+        PromiseTimer() : Timer(PromiseTimer::complete, this){}
+
+        /**
+         * \brief starts a one-shot timer that sets the expiry time to the returned future
+         *
+         * Restarting the timer breaks the promise of the previous future, and so does destroying the running timer.
+         */
+        Future<TimePoint> start_after(TimerService& service, Duration delay);
+    };
+
+    /**
+     * \brief Runs many one-shot and periodic software timers from a single sorted list, so only the earliest expiry programs the hardware timer
+     *
+     * Heartbeats, timeouts and other timed actions do not need a task and a coroutine frame each.
+     * Attach the service to the scheduler with `Scheduler::attach()`: the scheduler then polls the timers
+     * and lets the service sleep until the earlier of the next task and the next timer.
+     * The service gets the function that programs the hardware instead of the scheduler:
+     *
+     * ```C++
+     * fiber::TimerService timers(get_time, sleep_until);
+     * fiber::Scheduler<8> scheduler(get_time);
+     * scheduler.attach(timers);
+     *
+     * fiber::Timer heartbeat([](void*){toggle_led();});
+     * timers.start_periodic(heartbeat, 500ms);
+     * ```
+     *
+     * Starting a timer costs a walk over the earlier timers of the list, expiring the first timer is constant.
+     * Start, stop and poll timers from the core that runs the scheduler, not from interrupts.
+     */
+    class TimerService{
+    private:
+        TimePoint (*_now)();
+        void (*_sleep_until)(TimePoint);
+        Timer* _head = nullptr; // sorted by expiry, equal expiries in the order they were started
+
+    public:
+
+        /**
+         * \param now function that returns the current time
+         * \param sleep_until function that sends the MCU to sleep until the passed time, for example by programming a compare interrupt
+         */
+        TimerService(TimePoint (*now)(), void (*sleep_until)(TimePoint) = default_sleep_until)
+            : _now(now)
+            , _sleep_until(sleep_until){}
+
+        /// @brief stops all timers
+        ~TimerService();
+
+        TimerService(const TimerService&) = delete;
+        TimerService& operator=(const TimerService&) = delete;
+
+        /// @brief returns the current time
+        TimePoint now() const {return this->_now();}
+
+        /// @brief (re-)starts a one-shot timer that expires at `expiry`
+        void start_at(Timer& timer, TimePoint expiry);
+
+        /// @brief (re-)starts a one-shot timer that expires after `delay`
+        void start_after(Timer& timer, Duration delay);
+
+        /// @brief (re-)starts a timer that expires every `period`, starting at `first`
+        void start_periodic(Timer& timer, TimePoint first, Duration period);
+
+        /// @brief (re-)starts a timer that expires every `period`, starting one period from now
+        void start_periodic(Timer& timer, Duration period);
+
+        /// @brief stops the timer if it is running on this service
+        void stop(Timer& timer);
+
+        /**
+         * \brief runs the callbacks of all expired timers and restarts the periodic ones
+         *
+         * Periodic timers keep their phase: the next expiry is a multiple of the period after the first one.
+         * Periods that already passed are skipped and counted, see `Timer::overruns()`.
+         *
+         * \returns the number of callbacks that have been run
+         */
+        size_t poll();
+
+        /// @brief returns `true` if no timer is running
+        constexpr bool empty() const {return this->_head == nullptr;}
+
+        /// @brief returns the number of running timers
+        size_t size() const;
+
+        /// @brief returns the earliest expiry, the service may not be empty
+        TimePoint next_expiry() const;
+
+        /// @brief sleeps until the earlier of `wake_up` and the next expiry
+        void sleep_until(TimePoint wake_up);
+
+        /// @brief sleeps until the next expiry, does nothing if no timer is running
+        void sleep();
+
+    private:
+        /// inserts the timer behind all timers that expire earlier or at the same time
+        void insert(Timer& timer);
+
+        /// removes the timer from the list, returns `false` if it was not in the list
+        bool remove(Timer& timer);
+    };
+
+} // namespace fiber
@@ -66,8 +66,12 @@ namespace fiber
          * @brief Forwards the suspend call to the real awaitable
          */
         template<class ReturnType>
-        inline void await_suspend(std::coroutine_handle<fiber::CoroutinePromise<ReturnType>> handle) noexcept{
-            this->_awaitable.await_suspend(handle);
+        inline auto await_suspend(std::coroutine_handle<fiber::CoroutinePromise<ReturnType>> handle) noexcept{
+            if constexpr (requires {this->_awaitable.await_suspend(handle);} ){
+                return this->_awaitable.await_suspend(handle);
+            }else{
+                return void();
+            }
         }
     };
 
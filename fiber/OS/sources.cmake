@@ -2,12 +2,16 @@ target_sources(fiber
     PUBLIC
         ${CMAKE_CURRENT_LIST_DIR}/CoSignal.hpp
         ${CMAKE_CURRENT_LIST_DIR}/Coroutine.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/NextCycle.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/PeriodicTask.hpp
         ${CMAKE_CURRENT_LIST_DIR}/Task.hpp
         ${CMAKE_CURRENT_LIST_DIR}/Scheduler.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/TimerService.hpp
 
     PRIVATE
         ${CMAKE_CURRENT_LIST_DIR}/Coroutine.cpp
         ${CMAKE_CURRENT_LIST_DIR}/CoSignal.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/TimerService.cpp
         
 )
 
@@ -0,0 +1,157 @@
+#include "PeriodicTask_test.hpp"
+
+// std
+#include <array>
+
+// fiber
+#include <fiber/TestFramework/TestFramework.hpp>
+#include <fiber/Chrono/TimePoint.hpp>
+#include <fiber/OS/NextCycle.hpp>
+#include <fiber/OS/PeriodicTask.hpp>
+#include <fiber/OS/Scheduler.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        TimePoint g_mock_time(0);
+        TimePoint get_time(){return g_mock_time;}
+
+        /// records the start of the last 64 cycles and works for `work[cycle]` ticks
+        struct CycleLog{
+            std::array<TimePoint, 64> starts;
+            std::array<DurationRepresentation, 8> work{};
+            std::size_t n = 0;
+
+            static Coroutine<Exit> loop(CycleLog* self){
+                while(true){
+                    self->starts[self->n % self->starts.size()] = g_mock_time;
+                    if(self->n < self->work.size()) g_mock_time += Duration(self->work[self->n]);
+                    ++self->n;
+                    co_await NextCycle();
+                }
+            }
+        };
+
+        template<std::size_t n_tasks>
+        void run_until(Scheduler<n_tasks>& scheduler, TimePoint end, Duration step){
+            while(g_mock_time < end){
+                scheduler.spin();
+                g_mock_time += step;
+            }
+        }
+
+        TestResult PeriodicTask_test_hard_period(){
+            TEST_START;
+
+            g_mock_time = TimePoint(0);
+            CycleLog log;
+            log.work = {2, 2, 25, 2, 2, 2, 2, 2};
+
+            PeriodicTask<512> task("periodic", TimePoint(0), Duration(10u), Duration(4u), Duration(3u), CycleLog::loop, &log);
+            Scheduler<1> scheduler(get_time);
+            scheduler.add(&task);
+
+            run_until(scheduler, TimePoint(60), Duration(1u));
+
+            // the third cycle ends at 48: the release at 33 is skipped and 43 starts at the next poll
+            TEST_EQUAL(log.n, 5);
+            TEST_TRUE(log.starts[0] == TimePoint(3));
+            TEST_TRUE(log.starts[1] == TimePoint(13));
+            TEST_TRUE(log.starts[2] == TimePoint(23));
+            TEST_TRUE(log.starts[3] == TimePoint(49));
+            TEST_TRUE(log.starts[4] == TimePoint(53));
+
+            const auto& statistics = task.statistics();
+            TEST_EQUAL(statistics.cycles(), 5);
+            TEST_EQUAL(statistics.overruns(), 1);
+            TEST_EQUAL(statistics.deadline_misses(), 2);
+
+            // release jitter: 0, 0, 0, 6, 0
+            TEST_EQUAL(statistics.release_jitter().bin_width().count().value, 1);
+            TEST_EQUAL(statistics.release_jitter()[0], 4);
+            TEST_EQUAL(statistics.release_jitter()[6], 1);
+            TEST_TRUE(statistics.release_jitter().max() == Duration(6u));
+
+            // response times: 2, 2, 25, 8, 2 (the last bin collects everything from 7 on)
+            TEST_EQUAL(statistics.response_time()[2], 3);
+            TEST_EQUAL(statistics.response_time().overflows(), 2);
+            TEST_TRUE(statistics.response_time().max() == Duration(25u));
+
+            task.statistics().reset();
+            TEST_EQUAL(task.statistics().cycles(), 0);
+            TEST_EQUAL(task.statistics().release_jitter()[0], 0);
+
+            TEST_END;
+        }
+
+        TestResult PeriodicTask_test_phase(){
+            TEST_START;
+
+            g_mock_time = TimePoint(0);
+            CycleLog fast_log;
+            CycleLog slow_log;
+
+            const TimePoint epoch = get_time();
+            PeriodicTask<512> fast("fast", epoch, Duration(10u), Duration(5u), CycleLog::loop, &fast_log);
+            PeriodicTask<512> slow("slow", epoch, Duration(20u), Duration(5u), Duration(5u), CycleLog::loop, &slow_log);
+            Scheduler<2> scheduler(get_time);
+            scheduler.add(&fast);
+            scheduler.add(&slow);
+
+            run_until(scheduler, TimePoint(50), Duration(1u));
+
+            TEST_EQUAL(fast_log.n, 5);
+            TEST_EQUAL(slow_log.n, 3);
+            TEST_TRUE(fast_log.starts[1] == TimePoint(10));
+            TEST_TRUE(slow_log.starts[0] == TimePoint(5));
+            TEST_TRUE(slow_log.starts[1] == TimePoint(25));
+            TEST_TRUE(slow_log.starts[2] == TimePoint(45));
+
+            // no task ever had to wait for the other
+            TEST_TRUE(fast.statistics().release_jitter().max() == Duration(0u));
+            TEST_TRUE(slow.statistics().release_jitter().max() == Duration(0u));
+
+            TEST_END;
+        }
+
+        TestResult PeriodicTask_test_soft_period(){
+            TEST_START;
+
+            g_mock_time = TimePoint(0);
+            CycleLog log;
+
+            SoftPeriodicTask<512> task("soft", TimePoint(0), Duration(10u), Duration(10u), CycleLog::loop, &log);
+            Scheduler<1> scheduler(get_time);
+            scheduler.add(&task);
+
+            // the scheduler is only polled every 3 ticks: without compensation each period would last 12 ticks
+            run_until(scheduler, TimePoint(3000), Duration(3u));
+
+            TEST_GREATER(log.n, std::size_t(290));
+            TEST_TRUE(task.offset() <= Duration(0u));
+
+            // the average period settled at the nominal period
+            const std::size_t first = log.n - 64;
+            const Duration last_periods = log.starts[(log.n - 1) % log.starts.size()] - log.starts[first % log.starts.size()];
+            TEST_GREATER(last_periods.count().value, DurationRepresentation(10 * 63 - 3));
+            TEST_GREATER(DurationRepresentation(10 * 63 + 3), last_periods.count().value);
+
+            TEST_THROW(SoftPeriodicTask<512>("zero", TimePoint(0), Duration(0u), Duration(1u), CycleLog::loop, &log));
+
+            TEST_END;
+        }
+
+    } // private namespace
+
+    TestResult PeriodicTask_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | PeriodicTask_test_hard_period
+            | PeriodicTask_test_phase
+            | PeriodicTask_test_soft_period
+            ;
+    }
+
+} // namespace fiber
@@ -6,6 +6,7 @@
 #include <fiber/OS/Scheduler.hpp>
 #include <fiber/Memory/StaticLinearAllocator.hpp>
 #include <fiber/OS/Delay.hpp>
+#include <fiber/OStream/SpanOStream.hpp>
 
 namespace fiber
 {
@@ -320,6 +321,215 @@ namespace fiber
         TEST_END;
     }
 
+    TestResult print_json_lists_tasks(){
+        TEST_START;
+
+        g_mock_time = TimePoint(1ms);
+
+        class Task : public fiber::Task<256>{
+            public:
+            Task(std::string_view name, TimePoint ready, std::chrono::milliseconds deadline)
+                : fiber::Task<256>(name, ready, deadline, Task::main){}
+
+            static Coroutine<Exit> main(){
+                co_return Exit::Success;
+            }
+        };
+
+        Task task("Task \"1\"", TimePoint(2ms), 3ms);
+        Scheduler<2> scheduler(get_time);
+        scheduler.add(&task);
+
+        char buffer[512];
+        SpanOStream stream(buffer);
+        scheduler.print_json(stream);
+        TEST_FALSE(stream.truncated());
+
+        const std::string_view json = stream.view();
+        const std::string_view head = R"({"now_us":1000,"capacity":2,"n_running":0,"n_waiting":1,"n_awaiting":0,"n_continuations":0,)"
+                                      R"("running":[],"waiting":[{"name":"Task \"1\"","id":0,"ready_us":2000,"deadline_us":5000,"frame_size":)";
+        const std::string_view tail = R"(}],"awaiting":[]})";
+        TEST_TRUE(json.starts_with(head));
+        TEST_TRUE(json.ends_with(tail));
+
+        // an unbounded scheduler has no capacity
+        stream.clear();
+        Scheduler<> unbounded(get_time);
+        unbounded.print_json(stream);
+        TEST_TRUE(stream.view().starts_with(R"({"now_us":1000,"capacity":null,"n_running":0,)"));
+
+        // the scheduler can be nested into other objects
+        stream.clear();
+        JsonWriter writer(stream);
+        writer.begin_array();
+        scheduler.print_json(writer);
+        scheduler.print_json(writer);
+        writer.end_array();
+        TEST_TRUE(writer.is_complete());
+        TEST_EQUAL(stream.size(), 2 * json.size() + 3);
+
+        TEST_END;
+    }
+
+    TestResult intrusive_queues_run_by_deadline_and_remove(){
+        TEST_START;
+
+        g_mock_time = TimePoint(0);
+
+        struct Log{
+            int order[8];
+            int n = 0;
+        } log;
+
+        class Task : public fiber::Task<256>{
+            public:
+            Task(int index, Log* log, TimePoint deadline)
+                : fiber::Task<256>("task", TimePoint(0), deadline, Task::main, this, log)
+                , index(index){}
+
+            int index = 0;
+
+            static Coroutine<Exit> main(Task* self, Log* log){
+                log->order[log->n++] = self->index;
+                co_return Exit::Success;
+            }
+        };
+
+        // the queues live in the tasks: the capacity does not change the size of the scheduler
+        static_assert(sizeof(Scheduler<1>) == sizeof(Scheduler<1000>));
+
+        // distinct deadlines in a shuffled order
+        auto deadline = [](int i){return TimePoint(100 - ((i * 3) % 8));};
+        Task tasks[8] = {
+            Task(0, &log, deadline(0)), Task(1, &log, deadline(1)), Task(2, &log, deadline(2)), Task(3, &log, deadline(3)),
+            Task(4, &log, deadline(4)), Task(5, &log, deadline(5)), Task(6, &log, deadline(6)), Task(7, &log, deadline(7)),
+        };
+
+        Scheduler<> scheduler(get_time);
+        for(Task& task : tasks) scheduler.add(&task);
+        TEST_EQUAL(scheduler.n_running(), 8);
+
+        // remove two tasks before they run
+        TEST_TRUE(scheduler.remove(&tasks[3]));
+        TEST_TRUE(scheduler.remove(&tasks[6]));
+        TEST_FALSE(scheduler.remove(&tasks[6]));
+        TEST_EQUAL(scheduler.size(), 6);
+
+        while(!scheduler.is_done()) scheduler.spin();
+
+        // earliest deadline first
+        TEST_EQUAL(log.n, 6);
+        for(int i = 1; i < log.n; ++i){
+            TEST_TRUE(tasks[log.order[i-1]].deadline() < tasks[log.order[i]].deadline());
+        }
+        for(int i = 0; i < log.n; ++i){
+            TEST_NOT_EQUAL(log.order[i], 3);
+            TEST_NOT_EQUAL(log.order[i], 6);
+        }
+
+        TEST_END;
+    }
+
+    TestResult priority_task_started_immediatelly_waits_after_delay(){
+        TEST_START;
+
+        g_mock_time = TimePoint(0);
+
+        class Task : public fiber::Task<256>{
+            public:
+            int proof = 0;
+
+            Task(std::string_view name, uint16_t priority) 
+                : fiber::Task<256>(name, priority, Task::main, this){}
+
+            static Coroutine<Exit> main(Task* This){
+                This->proof = 1;
+                co_await Delay(2ms);
+                This->proof = 2;
+                co_await Delay(2ms);
+                This->proof = 3;
+                co_return Exit::Success;
+            }
+        };
+
+        Task task("Task", 1);
+        Scheduler<1> scheduler(get_time);
+        scheduler.add(&task);
+
+        // only the first start ignores the ready time
+        scheduler.spin();
+        TEST_EQUAL(task.proof, 1);
+        TEST_EQUAL(scheduler.n_waiting(), 1);
+        TEST_EQUAL(scheduler.n_running(), 0);
+
+        // the delay has to pass, also for a task that started immediatelly
+        scheduler.spin();
+        TEST_EQUAL(task.proof, 1);
+        g_mock_time = TimePoint(1ms);
+        scheduler.spin();
+        TEST_EQUAL(task.proof, 1);
+
+        g_mock_time = TimePoint(2ms);
+        scheduler.spin();
+        TEST_EQUAL(task.proof, 2);
+        scheduler.spin();
+        TEST_EQUAL(task.proof, 2);
+
+        g_mock_time = TimePoint(4ms);
+        scheduler.spin();
+        TEST_EQUAL(task.proof, 3);
+        TEST_TRUE(scheduler.is_done());
+        TEST_TRUE(task.is_done());
+
+        TEST_END;
+    }
+
+    TestResult explicit_delay_waits_for_ready_time(){
+        TEST_START;
+
+        g_mock_time = TimePoint(0);
+
+        class Task : public fiber::Task<256>{
+            public:
+            int proof = 0;
+
+            Task(std::string_view name, TimePoint ready, Duration deadline) 
+                : fiber::Task<256>(name, ready, deadline, Task::main, this){}
+
+            static Coroutine<Exit> main(Task* This){
+                This->proof = 1;
+                co_await Delay(2ms, 3ms);
+                This->proof = 2;
+                co_return Exit::Success;
+            }
+        };
+
+        Task task("Task", get_time(), fiber::rounding_duration_cast<fiber::Duration>(1ms));
+        Scheduler<1> scheduler(get_time);
+        scheduler.add(&task);
+
+        scheduler.spin();
+        TEST_EQUAL(task.proof, 1);
+
+        // the task is put back into the waiting queue with the explicit deadline
+        TEST_EQUAL(scheduler.n_waiting(), 1);
+        TEST_EQUAL(scheduler.size(), 1);
+        TEST_FALSE(scheduler.is_done());
+        TEST_EQUAL(task.deadline(), TimePoint(5ms));
+
+        g_mock_time = TimePoint(1ms);
+        scheduler.spin();
+        TEST_EQUAL(task.proof, 1);
+
+        g_mock_time = TimePoint(2ms);
+        scheduler.spin();
+        TEST_EQUAL(task.proof, 2);
+        TEST_TRUE(scheduler.is_done());
+        TEST_TRUE(task.is_done());
+
+        TEST_END;
+    }
+
     } // private namespace
 
     
@@ -332,6 +542,10 @@ namespace fiber
             | one_task_delayed_ready_finishes_instantly
             | one_task_immediatelly_ready_delays
             | two_tasks_first_has_lower_ready_second_has_lower_deadline
+            | print_json_lists_tasks
+            | intrusive_queues_run_by_deadline_and_remove
+            | priority_task_started_immediatelly_waits_after_delay
+            | explicit_delay_waits_for_ready_time
             ;
     }
 
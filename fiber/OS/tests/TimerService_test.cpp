@@ -0,0 +1,190 @@
+#include "TimerService_test.hpp"
+
+// fiber
+#include <fiber/TestFramework/TestFramework.hpp>
+#include <fiber/Chrono/TimePoint.hpp>
+#include <fiber/OS/Scheduler.hpp>
+#include <fiber/OS/Task.hpp>
+#include <fiber/OS/TimerService.hpp>
+#include <fiber/OS/TryAwait.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        TimePoint g_mock_time(0);
+        TimePoint get_time(){return g_mock_time;}
+
+        TimePoint g_sleep_time(0);
+        int g_n_sleeps = 0;
+        void sleep_until(TimePoint time){g_sleep_time = time; ++g_n_sleeps;}
+
+        void count(void* context){++*static_cast<int*>(context);}
+
+        TestResult TimerService_test_one_shot(){
+            TEST_START;
+
+            g_mock_time = TimePoint(0);
+            TimerService timers(get_time, sleep_until);
+
+            int a = 0;
+            int b = 0;
+            int c = 0;
+            Timer timer_a(count, &a);
+            Timer timer_b(count, &b);
+            Timer timer_c(count, &c);
+
+            timers.start_after(timer_b, Duration(20u));
+            timers.start_after(timer_a, Duration(10u));
+            timers.start_at(timer_c, TimePoint(20));
+            TEST_EQUAL(timers.size(), 3);
+            TEST_TRUE(timers.next_expiry() == TimePoint(10));
+            TEST_TRUE(timer_a.is_running());
+            TEST_FALSE(timer_a.is_periodic());
+
+            g_mock_time = TimePoint(9);
+            TEST_EQUAL(timers.poll(), 0);
+
+            g_mock_time = TimePoint(10);
+            TEST_EQUAL(timers.poll(), 1);
+            TEST_EQUAL(a, 1);
+            TEST_FALSE(timer_a.is_running());
+
+            // stopped timers do not expire
+            timer_c.stop();
+            TEST_FALSE(timer_c.is_running());
+            g_mock_time = TimePoint(30);
+            TEST_EQUAL(timers.poll(), 1);
+            TEST_EQUAL(b, 1);
+            TEST_EQUAL(c, 0);
+            TEST_TRUE(timers.empty());
+
+            // a running timer may be restarted, it is not added twice
+            timers.start_after(timer_a, Duration(5u));
+            timers.start_after(timer_a, Duration(8u));
+            TEST_EQUAL(timers.size(), 1);
+            TEST_TRUE(timers.next_expiry() == TimePoint(38));
+
+            {
+                Timer temporary(count, &c);
+                timers.start_after(temporary, Duration(1u));
+                TEST_EQUAL(timers.size(), 2);
+            }
+            TEST_EQUAL(timers.size(), 1);
+
+            TEST_END;
+        }
+
+        TestResult TimerService_test_periodic(){
+            TEST_START;
+
+            g_mock_time = TimePoint(0);
+            TimerService timers(get_time, sleep_until);
+
+            int ticks = 0;
+            Timer heartbeat(count, &ticks);
+            timers.start_periodic(heartbeat, Duration(10u));
+            TEST_TRUE(heartbeat.is_periodic());
+
+            g_mock_time = TimePoint(10);
+            TEST_EQUAL(timers.poll(), 1);
+            TEST_TRUE(heartbeat.expiry() == TimePoint(20));
+
+            // polled late: keeps the phase and counts the skipped periods
+            g_mock_time = TimePoint(47);
+            TEST_EQUAL(timers.poll(), 1);
+            TEST_EQUAL(ticks, 2);
+            TEST_TRUE(heartbeat.expiry() == TimePoint(50));
+            TEST_EQUAL(heartbeat.overruns(), 2);
+
+            // a callback may stop its own timer
+            struct StopSelf{
+                Timer timer{StopSelf::callback, this};
+                int n = 0;
+                static void callback(void* context){
+                    StopSelf* self = static_cast<StopSelf*>(context);
+                    ++self->n;
+                    self->timer.stop();
+                }
+            } stop_self;
+            timers.start_periodic(stop_self.timer, TimePoint(50), Duration(5u));
+
+            g_mock_time = TimePoint(60);
+            TEST_EQUAL(timers.poll(), 2);
+            TEST_EQUAL(stop_self.n, 1);
+            TEST_FALSE(stop_self.timer.is_running());
+            TEST_EQUAL(timers.size(), 1);
+
+            TEST_THROW(timers.start_periodic(heartbeat, Duration(0u)));
+
+            TEST_END;
+        }
+
+        TestResult TimerService_test_scheduler(){
+            TEST_START;
+
+            g_mock_time = TimePoint(0);
+            g_n_sleeps = 0;
+            TimerService timers(get_time, sleep_until);
+            Scheduler<2> scheduler(get_time);
+            scheduler.attach(timers);
+
+            int ticks = 0;
+            Timer heartbeat(count, &ticks);
+            timers.start_periodic(heartbeat, Duration(100u));
+
+            // a task that waits for a promise timer
+            struct TimeoutTask : public fiber::Task<512>{
+                PromiseTimer timeout;
+                TimerService* timers;
+                TimePoint expired;
+
+                TimeoutTask(TimerService* timers)
+                    : fiber::Task<512>("timeout", TimePoint(0), 1000ms, TimeoutTask::main, this)
+                    , timers(timers){}
+
+                static Coroutine<Exit> main(TimeoutTask* self){
+                    self->expired = co_await TryAwait(self->timeout.start_after(*self->timers, Duration(30u)));
+                    co_return Exit::Success;
+                }
+            } task(&timers);
+            scheduler.add(&task);
+
+            scheduler.spin();
+            TEST_EQUAL(scheduler.n_awaiting(), 1);
+            TEST_EQUAL(timers.size(), 2);
+
+            // nothing is ready: sleeps until the earliest timer
+            scheduler.spin();
+            TEST_EQUAL(g_n_sleeps, 1);
+            TEST_TRUE(g_sleep_time == TimePoint(30));
+
+            g_mock_time = TimePoint(30);
+            scheduler.spin();
+            TEST_TRUE(task.is_done());
+            TEST_TRUE(task.expired == TimePoint(30));
+            TEST_TRUE(scheduler.is_done());
+
+            scheduler.spin();
+            TEST_TRUE(g_sleep_time == TimePoint(100));
+
+            g_mock_time = TimePoint(100);
+            scheduler.spin();
+            TEST_EQUAL(ticks, 1);
+
+            TEST_END;
+        }
+
+    } // private namespace
+
+    TestResult TimerService_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | TimerService_test_one_shot
+            | TimerService_test_periodic
+            | TimerService_test_scheduler
+            ;
+    }
+
+} // namespace fiber
@@ -1,9 +1,13 @@
 target_sources(fiber
     PUBLIC
         ${CMAKE_CURRENT_LIST_DIR}/Coroutine_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/PeriodicTask_test.hpp
         ${CMAKE_CURRENT_LIST_DIR}/Scheduler_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/TimerService_test.hpp
         
     PRIVATE
         ${CMAKE_CURRENT_LIST_DIR}/Coroutine_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/PeriodicTask_test.cpp
         ${CMAKE_CURRENT_LIST_DIR}/Scheduler_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/TimerService_test.cpp
 )
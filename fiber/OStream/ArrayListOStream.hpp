@@ -0,0 +1,100 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <string_view>
+
+// fiber
+#include <fiber/Containers/ArrayList.hpp>
+#include <fiber/OStream/OStream.hpp>
+
+namespace fiber{
+
+    /**
+     * \brief Output stream that appends to a `fiber::ArrayList<char, N>`
+     *
+     * Strings and paddings are appended with block copies instead of one virtual `put(char)` per character.
+     * Characters that do not fit into the list are dropped and counted, see `truncated()`.
+     * The list stays usable while the stream writes to it, for example to send and clear it once it is full enough.
+     *
+     * Example:
+     * ```C++
+     * fiber::ArrayList<char, 64> packet;
+     * fiber::ArrayListOStream stream(packet);
+     * stream << "id: " << id;
+     * ```
+     */
+    template<size_t N>
+    class ArrayListOStream : public OStream{
+    private:
+        ArrayList<char, N>& _list;
+        size_t _dropped = 0;
+
+    public:
+
+        /// \param list the list that the stream appends to
+        constexpr ArrayListOStream(ArrayList<char, N>& list) : _list(list){}
+
+        ArrayListOStream(const ArrayListOStream&) = delete;
+        ArrayListOStream& operator=(const ArrayListOStream&) = delete;
+
+        /// @brief appends a character, drops it if the list is full
+        void put(char c) final {
+            if(!this->_list.full()){
+                this->_list.emplace_back(c);
+            }else{
+                ++this->_dropped;
+            }
+        }
+
+        /// @brief appends `count` many copies of a character with a block `fiber::memset`
+        void put(char c, int count) final {
+            if(count <= 0) return;
+            const size_t n = this->fitting(static_cast<size_t>(count));
+            detail::fill_chars(this->_list.append_default(n), c, n);
+        }
+
+        /// @brief appends a string with a block `fiber::memcpy`, drops the characters that do not fit
+        void write(const char* str, size_t len) final {
+            const size_t n = this->fitting(len);
+            detail::copy_chars(this->_list.append_default(n), str, n);
+        }
+
+        /// @brief appends a zero-terminated string
+        void write(const char* str) final {
+            this->write(str, std::string_view(str).size());
+        }
+
+        /// @brief does nothing, the characters are already in the list
+        void flush() final {}
+
+        /// @brief returns the list that the stream appends to
+        constexpr ArrayList<char, N>& list() {return this->_list;}
+
+        /// @brief returns the list that the stream appends to
+        constexpr const ArrayList<char, N>& list() const {return this->_list;}
+
+        /// @brief returns the content of the list
+        constexpr std::string_view view() const {return std::string_view(this->_list.data(), this->_list.size());}
+
+        /// @brief returns the number of characters that have been dropped because the list was full
+        constexpr size_t dropped() const {return this->_dropped;}
+
+        /// @brief returns `true` if characters have been dropped because the list was full
+        constexpr bool truncated() const {return this->_dropped != 0;}
+
+        /// @brief resets the number of dropped characters
+        constexpr void clear_dropped() {this->_dropped = 0;}
+
+    private:
+
+        /// returns how many of `len` characters fit into the list and counts the rest as dropped
+        constexpr size_t fitting(size_t len){
+            const size_t free = this->_list.reserve();
+            if(len <= free) return len;
+            this->_dropped += len - free;
+            return free;
+        }
+    };
+
+} // namespace fiber
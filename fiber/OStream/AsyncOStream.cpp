@@ -0,0 +1,25 @@
+#include <fiber/OStream/AsyncOStream.hpp>
+
+namespace fiber{
+
+    void AsyncOStreamExtern::poll(){
+        // a completed transmission releases its characters, the following drain starts the next one
+        while(this->drain() > 0){}
+    }
+
+    size_t AsyncOStreamExtern::sink(const char* data, size_t len){
+        if(this->_in_flight == 0){
+            this->_in_flight = len;
+            this->_transmission = this->transmit(data, len);
+        }
+
+        if(this->_transmission.is_waiting()) return 0;
+
+        // a broken promise sends nothing, the block is transmitted again
+        const size_t* sent = this->_transmission.get_if();
+        const size_t taken = (sent == nullptr) ? 0 : (*sent < this->_in_flight) ? *sent : this->_in_flight;
+        this->_in_flight = 0;
+        return taken;
+    }
+
+} // namespace fiber
@@ -0,0 +1,182 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <string_view>
+
+// fiber
+#include <fiber/Future/Future.hpp>
+#include <fiber/OStream/BufferedOStream.hpp>
+
+namespace fiber{
+
+    /**
+     * \brief Buffered output stream whose transmissions complete through a `fiber::Future`, so tasks can `co_await` free space
+     *
+     * The user provided `transmit()` starts sending a block, for example with a DMA or an interrupt driven UART,
+     * and returns immediately with a future. The promise is kept with the number of sent characters once the transmission completed.
+     * The characters stay in the ring buffer until then.
+     *
+     * Tasks use the awaitables to suspend instead of blocking the cooperative system while the buffer drains:
+     * ```C++
+     * co_await uart.write_async(long_text);      // resumes once the whole text is in the buffer
+     * co_await uart.wait_available(64);          // resumes once 64 characters fit
+     * uart << "row " << i << fiber::newl;        // does not block
+     * co_await uart.flush_async();               // resumes once everything has been transmitted
+     * ```
+     *
+     * The synchronous `OStream` interface (`operator<<`, `flush()`, `endl()`) keeps working, but blocks while the buffer is full.
+     * To print a long output like `Scheduler::print()` without blocking, format it into a `fiber::SpanOStream` first
+     * and pass it to `write_async()`.
+     *
+     * A broken promise counts as no characters sent, the next `poll()` transmits the block again.
+     * Derive from this class and implement:
+     * ```C++
+     * fiber::Future<size_t> transmit(const char* data, size_t len);
+     * ```
+     *
+     * Derived classes should call `flush()` in their destructor, since `transmit()` is no longer available in the destructor of this class.
+     */
+    class AsyncOStreamExtern : public BufferedOStreamExtern{
+    private:
+        Future<size_t> _transmission;
+        size_t _in_flight = 0; // the number of characters of the running transmission
+
+    public:
+
+        /// \brief Awaitable of `write_async()`, resumes once all characters are in the buffer
+        class WriteAwaitable{
+            AsyncOStreamExtern* _stream;
+            mutable const char* _str;
+            mutable size_t _len;
+
+        public:
+            constexpr WriteAwaitable(AsyncOStreamExtern& stream, const char* str, size_t len)
+                : _stream(&stream)
+                , _str(str)
+                , _len(len){}
+
+            /// @brief progresses the transmission and appends what fits, returns `true` once everything has been appended
+            bool await_ready() const noexcept {
+                this->_stream->poll();
+                const size_t n = this->_stream->try_write(this->_str, this->_len);
+                this->_str += n;
+                this->_len -= n;
+                return this->_len == 0;
+            }
+
+            constexpr void await_resume() const noexcept {}
+        };
+
+        /// \brief Awaitable of `wait_available()`, resumes once enough characters fit into the buffer
+        class SpaceAwaitable{
+            AsyncOStreamExtern* _stream;
+            size_t _count;
+
+        public:
+            constexpr SpaceAwaitable(AsyncOStreamExtern& stream, size_t count)
+                : _stream(&stream)
+                , _count(count){}
+
+            /// @brief progresses the transmission and returns `true` if `count` characters fit into the buffer
+            bool await_ready() const noexcept {
+                this->_stream->poll();
+                return this->_stream->available() >= this->_count;
+            }
+
+            constexpr void await_resume() const noexcept {}
+        };
+
+        /// \brief Awaitable of `flush_async()`, resumes once all characters have been transmitted
+        class FlushAwaitable{
+            AsyncOStreamExtern* _stream;
+
+        public:
+            constexpr FlushAwaitable(AsyncOStreamExtern& stream) : _stream(&stream){}
+
+            /// @brief progresses the transmission and returns `true` if the buffer is empty
+            bool await_ready() const noexcept {
+                this->_stream->poll();
+                return this->_stream->empty();
+            }
+
+            constexpr void await_resume() const noexcept {}
+        };
+
+        /**
+         * \param buffer pointer to the start of the ring buffer
+         * \param capacity the number of characters that fit into the buffer. Has to be greater than zero.
+         */
+        constexpr AsyncOStreamExtern(char* buffer, size_t capacity)
+            : BufferedOStreamExtern(buffer, capacity){}
+
+        /**
+         * @brief Progresses the transmission without blocking
+         *
+         * Releases the characters of a completed transmission and starts the next one.
+         * The awaitables call this method, call it from a task or the idle loop to keep the output flowing otherwise.
+         */
+        void poll();
+
+        /// @brief returns `true` while a transmission is running
+        constexpr bool is_transmitting() const {return this->_in_flight != 0;}
+
+        /// @brief `co_await` it to append a string, suspends the task while the buffer is full
+        [[nodiscard]] WriteAwaitable write_async(const char* str, size_t len){return WriteAwaitable(*this, str, len);}
+
+        /// @brief `co_await` it to append a string, suspends the task while the buffer is full
+        [[nodiscard]] WriteAwaitable write_async(std::string_view str){return WriteAwaitable(*this, str.data(), str.size());}
+
+        /// @brief `co_await` it to suspend the task until `count` many characters fit into the buffer
+        [[nodiscard]] SpaceAwaitable wait_available(size_t count){
+            FIBER_ASSERT_O1_MSG(count <= this->capacity(), "Waits for more space than the buffer has! S: Use a larger buffer or `write_async()`.");
+            return SpaceAwaitable(*this, count);
+        }
+
+        /// @brief `co_await` it to suspend the task until all buffered characters have been transmitted
+        [[nodiscard]] FlushAwaitable flush_async(){return FlushAwaitable(*this);}
+
+    protected:
+
+        /**
+         * \brief Overload this method to start the transmission of a block of characters
+         * \details Has to be overloaded by the user! Must not block. The characters stay valid until the promise has been kept.
+         * \param data pointer to the first character of the block
+         * \param len the number of characters in the block
+         * \returns a future that receives the number of sent characters, starting from `data`
+         */
+        virtual Future<size_t> transmit(const char* data, size_t len) = 0;
+
+    private:
+
+        /// starts a transmission if there is none and returns the number of characters of a completed one
+        size_t sink(const char* data, size_t len) final;
+    };
+
+    /**
+     * \brief A `AsyncOStreamExtern` that owns a ring buffer for `N` characters
+     *
+     * Example:
+     * ```C++
+     * class Uart : public fiber::AsyncOStream<256>{
+     * public:
+     *     ~Uart(){this->flush();}
+     * protected:
+     *     fiber::Future<size_t> transmit(const char* data, size_t len) final {
+     *         auto [future, promise] = fiber::make_future_promise<size_t>();
+     *         uart_dma_start(data, len, std::move(promise)); // the DMA interrupt keeps the promise
+     *         return std::move(future);
+     *     }
+     * };
+     * ```
+     */
+    template<size_t N>
+    class AsyncOStream : public AsyncOStreamExtern{
+        static_assert(N > 0, "The buffer needs at least one character");
+        char _buffer[N];
+
+    public:
+        AsyncOStream() : AsyncOStreamExtern(_buffer, N){}
+    };
+
+} // namespace fiber
@@ -0,0 +1,7 @@
+#include <fiber/OStream/BinaryLog.hpp>
+
+namespace fiber{
+
+    OStreamRef blog;
+
+} // namespace fiber
@@ -0,0 +1,253 @@
+#pragma once
+
+// std
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+// fiber
+#include <fiber/OStream/OStream.hpp>
+#include <fiber/OStream/format.hpp>
+
+namespace fiber{
+
+    /**
+     * \brief Default stream for binary log records, see `fiber::binlog()`
+     */
+    extern OStreamRef blog;
+
+    namespace detail{
+
+        /// the largest record, the size is stored in the first byte
+        inline constexpr size_t binlog_max_record = 256;
+
+        /// magic byte that starts every dictionary entry in the `fiber_log` section
+        inline constexpr char binlog_entry_magic = static_cast<char>(0xA5);
+
+        /// returns the type code of an argument, the codes match the Python `struct` module
+        template<class T>
+        consteval char binlog_type_code(){
+            if constexpr (std::is_same_v<T, bool>){
+                return '?';
+            }else if constexpr (std::is_same_v<T, char>){
+                return 'c';
+            }else if constexpr (std::is_integral_v<T>){
+                constexpr bool is_signed = std::is_signed_v<T>;
+                if constexpr (sizeof(T) == 1) return is_signed ? 'b' : 'B';
+                else if constexpr (sizeof(T) == 2) return is_signed ? 'h' : 'H';
+                else if constexpr (sizeof(T) == 4) return is_signed ? 'i' : 'I';
+                else{
+                    static_assert(sizeof(T) == 8, "integers with more than 64 bit are not supported");
+                    return is_signed ? 'q' : 'Q';
+                }
+            }else if constexpr (std::is_same_v<T, float>){
+                return 'f';
+            }else if constexpr (std::is_floating_point_v<T>){
+                return 'd';
+            }else if constexpr (std::is_convertible_v<const T&, std::string_view>){
+                return 's';
+            }else{
+                static_assert(std::is_same_v<T, bool>, "binlog supports bool, char, integers, floating point numbers and strings");
+                return 0;
+            }
+        }
+
+        /// returns the argument converted to the type that is stored for its type code
+        template<class T>
+        constexpr auto binlog_stored_value(const T& value){
+            if constexpr (std::is_floating_point_v<T> && !std::is_same_v<T, float>){
+                return static_cast<double>(value);
+            }else if constexpr (std::is_same_v<T, bool>){
+                return static_cast<uint8_t>(value);
+            }else{
+                return value;
+            }
+        }
+
+        /// the 32-bit FNV-1a hash of a format string followed by the type codes
+        template<size_t N, size_t M>
+        consteval uint32_t binlog_id(const char (&format)[N], const std::array<char, M>& codes){
+            uint32_t hash = 2166136261u;
+            auto add = [&hash](char c){
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 16777619u;
+            };
+            for(size_t i = 0; i < N; ++i) add(format[i]);
+            for(char c : codes) add(c);
+            return hash;
+        }
+
+        /// the number of 4-byte words that a dictionary entry may use, limited by the 30 operands of an `asm` statement
+        inline constexpr size_t binlog_max_entry_words = 29;
+
+        /**
+         * One entry of the dictionary that the host uses to decode records.
+         *
+         * Layout: magic `0xA5`, id (4 bytes, little endian), number of arguments, type codes, format string, terminating zero.
+         * Equal format strings with equal argument types share one id.
+         *
+         * `emit()` places the entry into the `fiber_log` section with an `asm` statement.
+         * GCC ignores `[[gnu::section]]` on variables of templates. The section is not allocated,
+         * so the entries stay in the ELF file and never use FLASH memory.
+         * Entries are padded with zeros to whole words and repeat for every inlined call site.
+         */
+        template<FormatString Fmt, char... Codes>
+        struct BinlogEntry{
+            static constexpr std::array<char, sizeof...(Codes)> codes{Codes...};
+            static constexpr uint32_t id = binlog_id(Fmt._str, codes);
+            static constexpr size_t size = 6 + sizeof...(Codes) + sizeof(Fmt._str);
+            static constexpr size_t n_words = (size + 3) / 4;
+            static_assert(n_words <= binlog_max_entry_words, "the format string is too long for `fiber::binlog()`");
+
+            static constexpr std::array<char, size> make_bytes(){
+                std::array<char, size> bytes{};
+                size_t i = 0;
+                bytes[i++] = binlog_entry_magic;
+                for(int shift = 0; shift < 32; shift += 8) bytes[i++] = static_cast<char>((id >> shift) & 0xFF);
+                bytes[i++] = static_cast<char>(sizeof...(Codes));
+                for(char c : codes) bytes[i++] = c;
+                for(char c : Fmt._str) bytes[i++] = c;
+                return bytes;
+            }
+
+            static constexpr std::array<char, size> bytes = make_bytes();
+
+            /// the bytes packed into words, so that the assembler stores them in order
+            static constexpr std::array<uint32_t, binlog_max_entry_words> make_words(){
+                std::array<uint32_t, binlog_max_entry_words> words{};
+                for(size_t i = 0; i < size; ++i){
+                    const size_t byte = (std::endian::native == std::endian::little) ? i % 4 : 3 - i % 4;
+                    words[i / 4] |= static_cast<uint32_t>(static_cast<uint8_t>(bytes[i])) << (8 * byte);
+                }
+                return words;
+            }
+
+            static constexpr std::array<uint32_t, binlog_max_entry_words> words = make_words();
+
+            /// places the entry into the `fiber_log` section, emits no instructions
+            static inline void emit(){
+                if constexpr (n_words <= 12){
+                    asm volatile(
+                        ".pushsection fiber_log,\"\",%%progbits\n"
+                        ".long %c0, %c1, %c2, %c3, %c4, %c5, %c6, %c7, %c8, %c9, %c10, %c11\n"
+                        ".popsection"
+                        :
+                        : "n"(words[0]), "n"(words[1]), "n"(words[2]), "n"(words[3]), "n"(words[4]), "n"(words[5]),
+                        "n"(words[6]), "n"(words[7]), "n"(words[8]), "n"(words[9]), "n"(words[10]), "n"(words[11]));
+                }else{
+                    asm volatile(
+                        ".pushsection fiber_log,\"\",%%progbits\n"
+                        ".long %c0, %c1, %c2, %c3, %c4, %c5, %c6, %c7, %c8, %c9, %c10, %c11, %c12, %c13, %c14, %c15, %c16, %c17, %c18, %c19, %c20, %c21, %c22, %c23, %c24, %c25, %c26, %c27, %c28\n"
+                        ".popsection"
+                        :
+                        : "n"(words[0]), "n"(words[1]), "n"(words[2]), "n"(words[3]), "n"(words[4]), "n"(words[5]),
+                        "n"(words[6]), "n"(words[7]), "n"(words[8]), "n"(words[9]), "n"(words[10]), "n"(words[11]),
+                        "n"(words[12]), "n"(words[13]), "n"(words[14]), "n"(words[15]), "n"(words[16]), "n"(words[17]),
+                        "n"(words[18]), "n"(words[19]), "n"(words[20]), "n"(words[21]), "n"(words[22]), "n"(words[23]),
+                        "n"(words[24]), "n"(words[25]), "n"(words[26]), "n"(words[27]), "n"(words[28]));
+                }
+            }
+        };
+
+        /// appends the bytes of a value in little endian order
+        template<class T>
+        inline char* binlog_store(char* itr, const T& value){
+            auto bytes = std::bit_cast<std::array<char, sizeof(T)>>(value);
+            if constexpr (std::endian::native == std::endian::big){
+                for(size_t i = 0; i < sizeof(T); ++i) *itr++ = bytes[sizeof(T) - 1 - i];
+            }else{
+                for(size_t i = 0; i < sizeof(T); ++i) *itr++ = bytes[i];
+            }
+            return itr;
+        }
+
+        /// appends an argument to a record, strings are stored as length byte and characters and may use up to `string_budget` characters
+        template<class T>
+        inline char* binlog_append(char* itr, size_t& string_budget, const T& value){
+            if constexpr (binlog_type_code<T>() == 's'){
+                const std::string_view str(value);
+                const size_t len = (str.size() < string_budget) ? str.size() : string_budget;
+                string_budget -= len;
+                *itr++ = static_cast<char>(len);
+                for(size_t i = 0; i < len; ++i) *itr++ = str[i];
+                return itr;
+            }else{
+                return binlog_store(itr, binlog_stored_value(value));
+            }
+        }
+
+        /// the number of bytes of an argument, only the length byte for strings
+        template<class T>
+        consteval size_t binlog_fixed_size(){
+            if constexpr (binlog_type_code<T>() == 's'){
+                return 1;
+            }else{
+                return sizeof(decltype(binlog_stored_value(std::declval<T>())));
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * \brief Writes a binary log record that a host decodes into text later
+     *
+     * Formatting text costs cycles and FLASH memory on the target. This only writes a record
+     * with the id of the format string and the raw bytes of the arguments:
+     *
+     * | bytes    | content                                                                  |
+     * |----------|--------------------------------------------------------------------------|
+     * | 1        | number of the following bytes                                            |
+     * | 4        | id of the format string and argument types (FNV-1a hash, little endian)  |
+     * | ...      | the arguments in little endian, strings as length byte and characters    |
+     *
+     * The record is passed to the stream with a single `write()`.
+     * With a `fiber::BufferedOStream` a log line costs about as much as copying its arguments.
+     *
+     * The format strings are not part of the record. Each call site places a dictionary entry into the `fiber_log` section
+     * of the ELF file instead. The section is not allocated, so it needs no FLASH memory and no changes to the linker script.
+     * The host extracts the dictionary with `fiber/OStream/binlog_decode.py` and renders the text.
+     *
+     * Supported arguments are bool, char, integers, floating point numbers and strings.
+     * The format string uses the syntax of `fiber::format()` and may have up to about 100 characters.
+     * Strings are cut to fit into a record of 256 bytes.
+     *
+     * Example:
+     * ```C++
+     * fiber::binlog<"motor {} at {:.1f} rpm">(uart, motor_id, speed);
+     * ```
+     */
+    template<FormatString Fmt, class... Args>
+    void binlog(OStream& stream, const Args&... args){
+        static_assert(detail::ParsedFormat<Fmt>{}.n_args == sizeof...(Args), "the number of arguments does not match the format string");
+        using Entry = detail::BinlogEntry<Fmt, detail::binlog_type_code<Args>()...>;
+        Entry::emit();
+
+        constexpr size_t fixed_size = 5 + (detail::binlog_fixed_size<Args>() + ... + 0);
+        static_assert(fixed_size <= detail::binlog_max_record, "the arguments do not fit into a single record");
+        constexpr bool has_strings = ((detail::binlog_type_code<Args>() == 's') || ... || false);
+        constexpr size_t capacity = has_strings ? detail::binlog_max_record : fixed_size;
+
+        char record[capacity];
+        [[maybe_unused]] size_t string_budget = capacity - fixed_size;
+        char* itr = detail::binlog_store(record + 1, Entry::id);
+        ((itr = detail::binlog_append(itr, string_budget, args)), ...);
+
+        const size_t size = static_cast<size_t>(itr - record);
+        record[0] = static_cast<char>(size - 1);
+        stream.write(record, size);
+    }
+
+    /**
+     * \brief Writes a binary log record to the default stream `fiber::blog`
+     */
+    template<FormatString Fmt, class... Args>
+        requires (!(std::is_base_of_v<OStream, Args> || ...))
+    void binlog(const Args&... args){
+        FIBER_ASSERT_O1_MSG(blog.is_open(), "No binary log stream! S: Assign an output stream to `fiber::blog`.");
+        binlog<Fmt>(*blog.ptr, args...);
+    }
+
+} // namespace fiber
@@ -0,0 +1,143 @@
+#include <fiber/OStream/BufferedOStream.hpp>
+
+// fiber
+#include <fiber/Memory/memory.hpp>
+
+namespace fiber{
+
+    size_t BufferedOStreamExtern::contiguous_free() const {
+        // a full buffer has `_tail == _first` and nothing is free
+        return (this->_tail < this->_first || this->_size == this->_capacity) ? this->_first - this->_tail : this->_capacity - this->_tail;
+    }
+
+    void BufferedOStreamExtern::commit(size_t n){
+        this->_size += n;
+        this->_tail += n;
+        if(this->_tail == this->_capacity) this->_tail = 0;
+    }
+
+    void BufferedOStreamExtern::sink_all(const char* data, size_t len){
+        while(len > 0){
+            const size_t taken = this->sink(data, len);
+            data += taken;
+            len -= taken;
+        }
+    }
+
+    size_t BufferedOStreamExtern::drain(){
+        if(this->_size == 0) return 0;
+
+        // the oldest characters up to the end of the buffer, the wrapped part follows in the next call
+        const size_t len = (this->_size < this->_capacity - this->_first) ? this->_size : this->_capacity - this->_first;
+        const size_t taken = this->sink(this->_buffer + this->_first, len);
+        this->_size -= taken;
+        this->_first += taken;
+        if(this->_size == 0){
+            // restart at the beginning to keep appends contiguous
+            this->_first = 0;
+            this->_tail = 0;
+        }else if(this->_first == this->_capacity){
+            this->_first = 0;
+        }
+        return taken;
+    }
+
+    void BufferedOStreamExtern::flush(){
+        while(this->_size > 0) this->drain();
+    }
+
+    void BufferedOStreamExtern::put(char c){
+        while(this->_size == this->_capacity) this->drain();
+        this->_buffer[this->_tail] = c;
+        this->commit(1);
+    }
+
+    void BufferedOStreamExtern::put(char c, int count){
+        if(count <= 0) return;
+        const size_t n = static_cast<size_t>(count);
+
+        // most paddings are short and fit without wrapping
+        if(n <= detail::short_copy_length && n <= this->contiguous_free()){
+            detail::fill_chars(this->_buffer + this->_tail, c, n);
+            this->commit(n);
+        }else{
+            this->append_fill(c, n);
+        }
+    }
+
+    void BufferedOStreamExtern::append_fill(char c, size_t count){
+        while(count > 0){
+            const size_t free = this->contiguous_free();
+            if(free == 0){
+                this->drain();
+                continue;
+            }
+            const size_t n = (count < free) ? count : free;
+            fiber::memset(this->_buffer + this->_tail, c, n);
+            this->commit(n);
+            count -= n;
+        }
+    }
+
+    void BufferedOStreamExtern::write(const char* str, size_t len){
+        // most strings are short and fit without wrapping
+        if(len <= detail::short_copy_length && len <= this->contiguous_free()){
+            detail::copy_chars(this->_buffer + this->_tail, str, len);
+            this->commit(len);
+        }else{
+            this->append_copy(str, len);
+        }
+    }
+
+    void BufferedOStreamExtern::append_copy(const char* str, size_t len){
+        // bypass the buffer if the string would not fit anyways
+        if(len >= this->_capacity){
+            this->flush();
+            this->sink_all(str, len);
+            return;
+        }
+
+        while(len > 0){
+            const size_t free = this->contiguous_free();
+            if(free == 0){
+                this->drain();
+                continue;
+            }
+            const size_t n = (len < free) ? len : free;
+            fiber::memcpy(this->_buffer + this->_tail, str, n);
+            this->commit(n);
+            str += n;
+            len -= n;
+        }
+    }
+
+    size_t BufferedOStreamExtern::try_write(const char* str, size_t len){
+        const size_t n = (len < this->available()) ? len : this->available();
+
+        // at most two copies if the free space wraps around
+        size_t left = n;
+        while(left > 0){
+            const size_t free = this->contiguous_free();
+            const size_t m = (left < free) ? left : free;
+            fiber::memcpy(this->_buffer + this->_tail, str, m);
+            this->commit(m);
+            str += m;
+            left -= m;
+        }
+        return n;
+    }
+
+    void BufferedOStreamExtern::write(const char* str){
+        // copy while searching the end, most strings fit without wrapping
+        size_t len = detail::copy_until_terminator(this->_buffer + this->_tail, str, this->contiguous_free());
+        if(str[len] == '\0'){
+            this->commit(len);
+            return;
+        }
+
+        // the copied characters are not committed, append the whole string instead
+        while(str[len] != '\0') ++len;
+        this->append_copy(str, len);
+    }
+
+} // namespace fiber
@@ -0,0 +1,144 @@
+#pragma once
+
+// std
+#include <cstddef>
+
+// fiber
+#include <fiber/OStream/OStream.hpp>
+
+namespace fiber{
+
+    /**
+     * \brief Output stream that collects characters in a ring buffer and hands them to a sink in blocks.
+     *
+     * The default `OStream::write()` and `OStream::put(char, int)` call the virtual `put(char)` once per character.
+     * This stream appends to a buffer with `fiber::memcpy` and `fiber::memset` instead, and only calls the
+     * user provided `sink()` once per drained block. Padded and formatted numbers therefore cost a buffer append.
+     *
+     * The buffer is owned by the user, see `BufferedOStream<N>` for a stream that owns its buffer.
+     * Derive from this class and implement:
+     * ```C++
+     * size_t sink(const char* data, size_t len);
+     * ```
+     *
+     * The sink may take fewer bytes than offered, for example when a UART transmit FIFO is full.
+     * The rest stays in the ring buffer and is offered again by the next `drain()` or `flush()`.
+     *
+     * Derived classes should call `flush()` in their destructor, since the sink is no longer available in the destructor of this class.
+     * The stream is not guarded against concurrent use from interrupts or other cores.
+     */
+    class BufferedOStreamExtern : public OStream{
+    private:
+        char* const _buffer;
+        size_t const _capacity;
+        size_t _first = 0;  // index of the oldest character
+        size_t _tail = 0;   // index of the first free character
+        size_t _size = 0;
+
+    public:
+
+        /**
+         * \param buffer pointer to the start of the ring buffer
+         * \param capacity the number of characters that fit into the buffer. Has to be greater than zero.
+         */
+        constexpr BufferedOStreamExtern(char* buffer, size_t capacity)
+            : _buffer(buffer)
+            , _capacity(capacity){}
+
+        BufferedOStreamExtern(const BufferedOStreamExtern&) = delete;
+        BufferedOStreamExtern& operator=(const BufferedOStreamExtern&) = delete;
+
+        /// @brief appends a character to the buffer, drains it first if it is full
+        void put(char c) final;
+
+        /// @brief appends `count` many copies of a character with a block `fiber::memset`
+        void put(char c, int count) final;
+
+        /// @brief appends a string with a block `fiber::memcpy`. Strings larger than the buffer are passed to the sink directly.
+        void write(const char* str, size_t len) final;
+
+        /// @brief appends a zero-terminated string
+        void write(const char* str) final;
+
+        /// @brief hands all buffered characters to the sink, blocks until it has taken all of them
+        void flush() override;
+
+        /**
+         * @brief Appends as many characters of a string as fit into the buffer without draining it
+         * @returns the number of appended characters
+         */
+        size_t try_write(const char* str, size_t len);
+
+        /**
+         * @brief Calls the sink once with the oldest contiguous block of buffered characters
+         * @returns the number of characters that the sink has taken
+         */
+        size_t drain();
+
+        /// @brief returns the number of buffered characters
+        constexpr size_t size() const {return this->_size;}
+
+        /// @brief returns the number of characters that fit into the buffer
+        constexpr size_t capacity() const {return this->_capacity;}
+
+        /// @brief returns the number of characters that can be appended without draining
+        constexpr size_t available() const {return this->_capacity - this->_size;}
+
+        /// @brief returns `true` if no characters are buffered
+        constexpr bool empty() const {return this->_size == 0;}
+
+    protected:
+
+        /**
+         * \brief Overload this method to write a block of characters to the device
+         * \details Has to be overloaded by the user!
+         * \param data pointer to the first character of the block
+         * \param len the number of characters in the block
+         * \returns the number of characters that have been taken, starting from `data`
+         */
+        virtual size_t sink(const char* data, size_t len) = 0;
+
+    private:
+
+        /// returns the number of free characters that follow the tail without wrapping
+        size_t contiguous_free() const;
+
+        /// adds `n` characters that have been written at the tail
+        void commit(size_t n);
+
+        /// appends `count` many characters, drains the buffer when it runs full
+        void append_fill(char c, size_t count);
+
+        /// appends a string, drains the buffer when it runs full
+        void append_copy(const char* str, size_t len);
+
+        /// passes `len` characters to the sink until it has taken all of them
+        void sink_all(const char* data, size_t len);
+    };
+
+    /**
+     * \brief A `BufferedOStreamExtern` that owns a ring buffer for `N` characters
+     *
+     * Example:
+     * ```C++
+     * class Uart : public fiber::BufferedOStream<128>{
+     * public:
+     *     ~Uart(){this->flush();}
+     * protected:
+     *     size_t sink(const char* data, size_t len) final {
+     *         uart_transmit_blocking(data, len);
+     *         return len;
+     *     }
+     * };
+     * ```
+     */
+    template<size_t N>
+    class BufferedOStream : public BufferedOStreamExtern{
+        static_assert(N > 0, "The buffer needs at least one character");
+        char _buffer[N];
+
+    public:
+        BufferedOStream() : BufferedOStreamExtern(_buffer, N){}
+    };
+
+} // namespace fiber
@@ -0,0 +1,181 @@
+#include <fiber/OStream/JsonWriter.hpp>
+
+// fiber
+#include <fiber/math/math.hpp>
+
+namespace fiber{
+
+    namespace{
+        /// plain decimals like JavaScript numbers, the exponent form only for magnitudes below 1e-6 or from 1e21 on
+        template<class Float>
+        FormatFloat<Float> json_number(Float value){
+            const Float magnitude = (value < 0) ? -value : value;
+            if(magnitude == 0 || (magnitude >= Float(1e-6) && magnitude < Float(1e21))){
+                return FormatFloat(value).full().shortest();
+            }
+            return FormatFloat(value).sci().shortest();
+        }
+    }
+
+    void JsonWriter::begin_value(){
+        if(this->_depth == 0){
+            return;
+        }
+        const uint32_t bit = uint32_t(1) << (this->_depth - 1);
+        if(this->_is_array & bit){
+            if(this->_has_items & bit) this->_stream->put(',');
+            this->_has_items |= bit;
+        }else{
+            FIBER_ASSERT_O1_MSG(this->_has_key, "A value inside of a JSON object needs a key! S: Call `key()` or use `field()`.");
+            this->_has_key = false;
+        }
+    }
+
+    void JsonWriter::begin_level(char bracket, bool is_array){
+        FIBER_ASSERT_O1_MSG(this->_depth < max_depth, "JSON nested too deep! S: Nest at most `JsonWriter::max_depth` objects and arrays.");
+        this->begin_value();
+        this->_stream->put(bracket);
+        const uint32_t bit = uint32_t(1) << this->_depth;
+        if(is_array){
+            this->_is_array |= bit;
+        }else{
+            this->_is_array &= ~bit;
+        }
+        this->_has_items &= ~bit;
+        ++this->_depth;
+    }
+
+    void JsonWriter::end_level(char bracket, bool is_array){
+        FIBER_ASSERT_O1_MSG(this->_depth > 0, "No JSON object or array to close!");
+        const uint32_t bit = uint32_t(1) << (this->_depth - 1);
+        FIBER_ASSERT_O1_MSG(((this->_is_array & bit) != 0) == is_array, "Closes a JSON object with `]` or an array with `}`!");
+        FIBER_ASSERT_O1_MSG(!this->_has_key, "A JSON key is missing its value!");
+        this->_stream->put(bracket);
+        --this->_depth;
+    }
+
+    JsonWriter& JsonWriter::begin_object(){
+        this->begin_level('{', false);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::end_object(){
+        this->end_level('}', false);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::begin_array(){
+        this->begin_level('[', true);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::end_array(){
+        this->end_level(']', true);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::key(std::string_view name){
+        FIBER_ASSERT_O1_MSG(this->_depth > 0, "JSON keys are only allowed inside of objects!");
+        const uint32_t bit = uint32_t(1) << (this->_depth - 1);
+        FIBER_ASSERT_O1_MSG((this->_is_array & bit) == 0, "JSON keys are only allowed inside of objects!");
+        FIBER_ASSERT_O1_MSG(!this->_has_key, "The previous JSON key is missing its value!");
+        if(this->_has_items & bit) this->_stream->put(',');
+        this->_has_items |= bit;
+        this->write_string(name);
+        this->_stream->put(':');
+        this->_has_key = true;
+        return *this;
+    }
+
+    void JsonWriter::write_string(std::string_view str){
+        static constexpr char hex_digits[] = "0123456789abcdef";
+
+        OStream& stream = *this->_stream;
+        stream.put('"');
+
+        // write runs of characters that need no escape as one block
+        const char* run = str.data();
+        const char* const end = str.data() + str.size();
+        for(const char* itr = run; itr != end; ++itr){
+            const unsigned char c = static_cast<unsigned char>(*itr);
+            if(c >= 0x20 && c != '"' && c != '\\') continue;
+
+            stream.write(run, static_cast<size_t>(itr - run));
+            run = itr + 1;
+
+            char escape[6] = {'\\', 0, 0, 0, 0, 0};
+            size_t escape_length = 2;
+            switch(c){
+                break; case '"':  escape[1] = '"';
+                break; case '\\': escape[1] = '\\';
+                break; case '\n': escape[1] = 'n';
+                break; case '\r': escape[1] = 'r';
+                break; case '\t': escape[1] = 't';
+                break; case '\b': escape[1] = 'b';
+                break; case '\f': escape[1] = 'f';
+                break; default:
+                    escape[1] = 'u';
+                    escape[2] = '0';
+                    escape[3] = '0';
+                    escape[4] = hex_digits[c >> 4];
+                    escape[5] = hex_digits[c & 0xF];
+                    escape_length = 6;
+            }
+            stream.write(escape, escape_length);
+        }
+        stream.write(run, static_cast<size_t>(end - run));
+
+        stream.put('"');
+    }
+
+    JsonWriter& JsonWriter::value(std::string_view str){
+        this->begin_value();
+        this->write_string(str);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(bool b){
+        this->begin_value();
+        if(b){
+            this->_stream->write("true", 4);
+        }else{
+            this->_stream->write("false", 5);
+        }
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(std::nullptr_t){
+        this->begin_value();
+        this->_stream->write("null", 4);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(float f){
+        return this->value(json_number(f));
+    }
+
+    JsonWriter& JsonWriter::value(double d){
+        return this->value(json_number(d));
+    }
+
+    JsonWriter& JsonWriter::value(const FormatFloat<float>& f){
+        if(fiber::is_nan(f._value) || fiber::is_inf(f._value)) return this->value(nullptr);
+        this->begin_value();
+        *this->_stream << f;
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(const FormatFloat<double>& d){
+        if(fiber::is_nan(d._value) || fiber::is_inf(d._value)) return this->value(nullptr);
+        this->begin_value();
+        *this->_stream << d;
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::raw(std::string_view json){
+        this->begin_value();
+        this->_stream->write(json.data(), json.size());
+        return *this;
+    }
+
+} // namespace fiber
@@ -0,0 +1,144 @@
+#pragma once
+
+// std
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// fiber
+#include <fiber/OStream/OStream.hpp>
+
+namespace fiber{
+
+    /**
+     * \brief Writes JSON to an `OStream` while it is being produced, without allocating memory
+     *
+     * Objects and arrays may be nested up to `JsonWriter::max_depth` levels. The nesting is tracked in two bit masks,
+     * commas and quotes are placed automatically and strings are escaped.
+     * Numbers are written with `FormatInt` and `FormatFloat`, `nan` and `inf` become `null`.
+     *
+     * Example:
+     * ```C++
+     * fiber::JsonWriter json(uart);
+     * json.begin_object();
+     * json.field("name", "motor").field("rpm", 1200).field("temp", 41.5f);
+     * json.key("errors").begin_array().value(3).value(7).end_array();
+     * json.end_object();
+     * // Outputs: {"name":"motor","rpm":1200,"temp":41.5,"errors":[3,7]}
+     * ```
+     *
+     * Wrong nesting, a value without a key inside an object or a key outside of an object throw an `AssertionFailureO1`.
+     *
+     * \note With `FIBER_FMT_MINIMAL` the compile definitions of the number formatting apply.
+     *       Keep the default comma `.` and disable thousands separators to produce valid JSON.
+     */
+    class JsonWriter{
+    public:
+        /// the maximal number of nested objects and arrays
+        static constexpr int max_depth = 32;
+
+    private:
+        OStream* _stream;
+        uint32_t _is_array = 0;  // bit `i`: level `i + 1` is an array
+        uint32_t _has_items = 0; // bit `i`: level `i + 1` already has an element, the next one needs a comma
+        int _depth = 0;
+        bool _has_key = false;   // a key has been written and waits for its value
+
+    public:
+
+        /// \param stream the stream that receives the JSON text
+        explicit JsonWriter(OStream& stream) : _stream(&stream){}
+
+        /// @brief returns the stream that receives the JSON text
+        OStream& stream() const {return *this->_stream;}
+
+        /// @brief returns the number of open objects and arrays
+        constexpr int depth() const {return this->_depth;}
+
+        /// @brief returns `true` if all objects and arrays have been closed
+        constexpr bool is_complete() const {return this->_depth == 0 && !this->_has_key;}
+
+        /// @brief opens an object `{`
+        JsonWriter& begin_object();
+
+        /// @brief closes the innermost object `}`
+        JsonWriter& end_object();
+
+        /// @brief opens an array `[`
+        JsonWriter& begin_array();
+
+        /// @brief closes the innermost array `]`
+        JsonWriter& end_array();
+
+        /// @brief writes the key of the next value of an object
+        JsonWriter& key(std::string_view name);
+
+        /// @brief writes an escaped string
+        JsonWriter& value(std::string_view str);
+
+        /// @brief writes an escaped zero-terminated string
+        JsonWriter& value(const char* str){return this->value(std::string_view(str));}
+
+        /// @brief writes `true` or `false`
+        JsonWriter& value(bool b);
+
+        /// @brief writes `null`
+        JsonWriter& value(std::nullptr_t);
+
+        /// @brief writes an integer
+        template<std::integral Int>
+        JsonWriter& value(Int i){
+            return this->value(FormatInt<Int>(i));
+        }
+
+        /// @brief writes an integer with custom formatting. Padding is allowed but thousands separators are not valid JSON.
+        template<std::integral Int>
+        JsonWriter& value(const FormatInt<Int>& i){
+            this->begin_value();
+            *this->_stream << i;
+            return *this;
+        }
+
+        /**
+         * @brief writes the shortest digits that read back as the same value, `nan` and `inf` are written as `null`
+         * @details Plain decimals like `41.5`, the exponent form like `1e-7` only for magnitudes below `1e-6` or from `1e21` on
+         */
+        JsonWriter& value(float f);
+
+        /**
+         * @brief writes the shortest digits that read back as the same value, `nan` and `inf` are written as `null`
+         * @details Plain decimals like `41.5`, the exponent form like `1e-7` only for magnitudes below `1e-6` or from `1e21` on
+         */
+        JsonWriter& value(double d);
+
+        /// @brief writes a float with custom formatting, for example fewer decimals. `nan` and `inf` are written as `null`
+        JsonWriter& value(const FormatFloat<float>& f);
+
+        /// @brief writes a double with custom formatting, for example fewer decimals. `nan` and `inf` are written as `null`
+        JsonWriter& value(const FormatFloat<double>& d);
+
+        /// @brief writes text that already is valid JSON, for example a pre-formatted object
+        JsonWriter& raw(std::string_view json);
+
+        /// @brief writes a key and its value
+        template<class T>
+        JsonWriter& field(std::string_view name, const T& v){
+            return this->key(name).value(v);
+        }
+
+    private:
+        /// writes the comma and checks that a value is allowed here
+        void begin_value();
+
+        /// opens an object or array
+        void begin_level(char bracket, bool is_array);
+
+        /// closes an object or array
+        void end_level(char bracket, bool is_array);
+
+        /// writes the string with quotes and escapes
+        void write_string(std::string_view str);
+    };
+
+} // namespace fiber
@@ -0,0 +1,333 @@
+#include <fiber/OStream/LogBuffer.hpp>
+
+// fiber
+#include <fiber/Memory/memory.hpp>
+#include <fiber/OS/Delay.hpp>
+
+namespace fiber{
+
+    // -----------------------------------------------------------------------------------------------
+    //                                          LogBufferExtern
+    // -----------------------------------------------------------------------------------------------
+
+    LogBufferExtern::LogBufferExtern(char* buffer, size_t capacity)
+        : _buffer(buffer)
+        , _capacity(capacity)
+    {
+        FIBER_ASSERT_O1_MSG(std::has_single_bit(capacity), "The capacity of a log buffer has to be a power of two! S: Use a capacity like 64, 128 or 256.");
+    }
+
+    LogBufferExtern::LogBufferExtern(char* buffer, size_t capacity, LogAggregator& aggregator)
+        : LogBufferExtern(buffer, capacity)
+    {
+        aggregator.attach(*this);
+    }
+
+    LogBufferExtern::~LogBufferExtern(){
+        this->close();
+    }
+
+    void LogBufferExtern::close(){
+        this->commit();
+        LogAggregator* aggregator = this->aggregator();
+        if(aggregator == nullptr) return;
+
+        #ifdef FIBER_MULTI_CORE
+            this->_closing.store(true, std::memory_order_release);
+            while(this->aggregator() != nullptr){
+                // an idle aggregator might run on this core and never get to the buffer
+                if(aggregator->try_lock()){
+                    aggregator->detach_closing();
+                    aggregator->unlock();
+                }
+            }
+        #else
+            aggregator->detach(*this);
+        #endif
+    }
+
+    LogAggregator* LogBufferExtern::aggregator() const {
+        #ifdef FIBER_MULTI_CORE
+            return this->_aggregator.load(std::memory_order_acquire);
+        #else
+            return this->_aggregator;
+        #endif
+    }
+
+    #ifdef FIBER_MULTI_CORE
+        size_t LogBufferExtern::load_head() const {return this->_head.load(std::memory_order_acquire);}
+        size_t LogBufferExtern::load_tail() const {return this->_tail.load(std::memory_order_acquire);}
+        void LogBufferExtern::store_head(size_t head){this->_head.store(head, std::memory_order_release);}
+        void LogBufferExtern::store_tail(size_t tail){this->_tail.store(tail, std::memory_order_release);}
+    #else
+        size_t LogBufferExtern::load_head() const {return this->_head;}
+        size_t LogBufferExtern::load_tail() const {return this->_tail;}
+        void LogBufferExtern::store_head(size_t head){this->_head = head;}
+        void LogBufferExtern::store_tail(size_t tail){this->_tail = tail;}
+    #endif
+
+    bool LogBufferExtern::empty() const {
+        return this->load_head() == this->load_tail();
+    }
+
+    size_t LogBufferExtern::free_space() const {
+        const size_t used = this->load_head() - this->load_tail();
+        const size_t line = this->_line_open ? header_size + this->_line_length : 0;
+        return this->_capacity - used - line;
+    }
+
+    bool LogBufferExtern::open_line(){
+        if(this->_line_open) return true;
+        if(this->_line_dropped) return false;
+
+        // the header and at least the line end have to fit
+        if(this->free_space() < header_size + 1){
+            this->_line_dropped = true;
+            ++this->_dropped_lines;
+            return false;
+        }
+
+        LogAggregator* aggregator = this->aggregator();
+        this->_line_time = (aggregator != nullptr) ? aggregator->now() : TimePoint();
+        this->_line_length = 0;
+        this->_line_open = true;
+        return true;
+    }
+
+    void LogBufferExtern::commit(){
+        if(this->_line_open){
+            const size_t head = this->load_head();
+            const RecordHeader header{this->_line_time, static_cast<uint16_t>(this->_line_length)};
+            this->copy_in(head, &header, header_size);
+            this->store_head(head + header_size + this->_line_length);
+            this->_line_open = false;
+        }
+        this->_line_dropped = false;
+    }
+
+    void LogBufferExtern::copy_in(size_t position, const void* source, size_t count){
+        const size_t index = position & (this->_capacity - 1);
+        const size_t first = (count < this->_capacity - index) ? count : this->_capacity - index;
+        fiber::memcpy(this->_buffer + index, source, first);
+        if(count > first) fiber::memcpy(this->_buffer, static_cast<const char*>(source) + first, count - first);
+    }
+
+    void LogBufferExtern::copy_out(size_t position, void* dest, size_t count) const {
+        const size_t index = position & (this->_capacity - 1);
+        const size_t first = (count < this->_capacity - index) ? count : this->_capacity - index;
+        fiber::memcpy(dest, this->_buffer + index, first);
+        if(count > first) fiber::memcpy(static_cast<char*>(dest) + first, this->_buffer, count - first);
+    }
+
+    void LogBufferExtern::put(char c){
+        this->write(&c, 1);
+    }
+
+    void LogBufferExtern::put(char c, int count){
+        if(count <= 0 || !this->open_line()) return;
+
+        // keep one character for the line end
+        const size_t space = this->free_space() - 1;
+        const size_t line_space = max_line_length - 1 - this->_line_length;
+        size_t n = static_cast<size_t>(count);
+        if(n > space) n = space;
+        if(n > line_space) n = line_space;
+
+        const size_t position = this->load_head() + header_size + this->_line_length;
+        const size_t index = position & (this->_capacity - 1);
+        const size_t first = (n < this->_capacity - index) ? n : this->_capacity - index;
+        fiber::memset(this->_buffer + index, c, first);
+        if(n > first) fiber::memset(this->_buffer, c, n - first);
+
+        this->_line_length += n;
+        this->_dropped += static_cast<size_t>(count) - n;
+    }
+
+    void LogBufferExtern::write(const char* str, size_t len){
+        if(len == 0 || !this->open_line()) return;
+
+        // keep one character for the line end
+        const size_t space = this->free_space() - 1;
+        const size_t line_space = max_line_length - 1 - this->_line_length;
+        size_t n = len;
+        if(n > space) n = space;
+        if(n > line_space) n = line_space;
+
+        this->copy_in(this->load_head() + header_size + this->_line_length, str, n);
+        this->_line_length += n;
+        this->_dropped += len - n;
+    }
+
+    void LogBufferExtern::write(const char* str){
+        this->write(str, string_length(str));
+    }
+
+    void LogBufferExtern::newl(){
+        if(this->open_line()){
+            // the line end may use the kept character
+            this->copy_in(this->load_head() + header_size + this->_line_length, "\n", 1);
+            this->_line_length += 1;
+        }
+        this->commit();
+    }
+
+    void LogBufferExtern::flush(){
+        this->commit();
+    }
+
+    LogBufferExtern::RecordHeader LogBufferExtern::front() const {
+        RecordHeader header;
+        this->copy_out(this->load_tail(), &header, header_size);
+        return header;
+    }
+
+    void LogBufferExtern::write_front(OStream& sink){
+        const size_t tail = this->load_tail();
+        const RecordHeader header = this->front();
+
+        // the text may wrap around the end of the buffer
+        const size_t index = (tail + header_size) & (this->_capacity - 1);
+        const size_t first = (header.length < this->_capacity - index) ? header.length : this->_capacity - index;
+        sink.write(this->_buffer + index, first);
+        if(header.length > first) sink.write(this->_buffer, header.length - first);
+
+        this->store_tail(tail + header_size + header.length);
+    }
+
+    // -----------------------------------------------------------------------------------------------
+    //                                          LogAggregator
+    // -----------------------------------------------------------------------------------------------
+
+    LogAggregator::LogAggregator(OStream& sink, TimePoint (*now)())
+        : _sink(&sink)
+        , _now(now){}
+
+    LogAggregator::~LogAggregator(){
+        for(LogBufferExtern* buffer = this->first(); buffer != nullptr; buffer = buffer->_next){
+            buffer->_aggregator = nullptr;
+        }
+    }
+
+    #ifdef FIBER_MULTI_CORE
+        bool LogAggregator::try_lock(){return !this->_busy.exchange(true, std::memory_order_acquire);}
+        void LogAggregator::unlock(){this->_busy.store(false, std::memory_order_release);}
+        LogBufferExtern* LogAggregator::first() const {return this->_buffers.load(std::memory_order_acquire);}
+    #else
+        bool LogAggregator::try_lock(){return true;}
+        void LogAggregator::unlock(){}
+        LogBufferExtern* LogAggregator::first() const {return this->_buffers;}
+    #endif
+
+    void LogAggregator::attach(LogBufferExtern& buffer){
+        FIBER_ASSERT_O1_MSG(buffer.aggregator() == nullptr, "The log buffer is already attached to an aggregator! S: Detach it first.");
+        buffer._aggregator = this;
+        #ifdef FIBER_MULTI_CORE
+            buffer._closing.store(false, std::memory_order_relaxed);
+            LogBufferExtern* head = this->_buffers.load(std::memory_order_relaxed);
+            do{
+                buffer._next = head;
+            }while(!this->_buffers.compare_exchange_weak(head, &buffer, std::memory_order_release, std::memory_order_relaxed));
+        #else
+            buffer._next = this->_buffers;
+            this->_buffers = &buffer;
+        #endif
+    }
+
+    void LogAggregator::detach(LogBufferExtern& buffer){
+        FIBER_ASSERT_O1_MSG(buffer.aggregator() == this, "The log buffer is not attached to this aggregator!");
+        #ifdef FIBER_MULTI_CORE
+            buffer.close();
+        #else
+            // keep the order with the lines of the other buffers
+            while(!buffer.empty()) this->write_oldest();
+            this->unlink(buffer);
+            buffer._aggregator = nullptr;
+        #endif
+    }
+
+    size_t LogAggregator::detach_closing(){
+        size_t n = 0;
+        #ifdef FIBER_MULTI_CORE
+            LogBufferExtern* buffer = this->first();
+            while(buffer != nullptr){
+                LogBufferExtern* next = buffer->_next;
+                if(buffer->_closing.load(std::memory_order_acquire)){
+                    // keep the order with the lines of the other buffers
+                    while(!buffer->empty()){
+                        this->write_oldest();
+                        ++n;
+                    }
+                    this->unlink(*buffer);
+                    buffer->_aggregator.store(nullptr, std::memory_order_release); // the buffer may be destroyed from now on
+                }
+                buffer = next;
+            }
+        #endif
+        return n;
+    }
+
+    void LogAggregator::unlink(LogBufferExtern& buffer){
+        #ifdef FIBER_MULTI_CORE
+            // the head may be changed by buffers that are attached at the same time
+            LogBufferExtern* expected = &buffer;
+            if(!this->_buffers.compare_exchange_strong(expected, buffer._next, std::memory_order_acq_rel, std::memory_order_acquire)){
+                LogBufferExtern* previous = expected;
+                while(previous->_next != &buffer) previous = previous->_next;
+                previous->_next = buffer._next;
+            }
+        #else
+            LogBufferExtern** link = &this->_buffers;
+            while(*link != &buffer) link = &(*link)->_next;
+            *link = buffer._next;
+        #endif
+        buffer._next = nullptr;
+    }
+
+    bool LogAggregator::write_oldest(){
+        LogBufferExtern* oldest = nullptr;
+        TimePoint oldest_time;
+        for(LogBufferExtern* buffer = this->first(); buffer != nullptr; buffer = buffer->_next){
+            if(buffer->empty()) continue;
+            const TimePoint time = buffer->front().time;
+            if(oldest == nullptr || time < oldest_time){
+                oldest = buffer;
+                oldest_time = time;
+            }
+        }
+        if(oldest == nullptr) return false;
+        oldest->write_front(*this->_sink);
+        return true;
+    }
+
+    bool LogAggregator::write_next(){
+        if(!this->try_lock()) return false;
+        const bool written = this->write_oldest();
+        this->unlock();
+        return written;
+    }
+
+    size_t LogAggregator::write_all(){
+        if(!this->try_lock()) return 0;
+        size_t n = 0;
+        while(this->write_oldest()) ++n;
+        n += this->detach_closing();
+        if(n > 0) this->_sink->flush();
+        this->unlock();
+        return n;
+    }
+
+    size_t LogAggregator::size() const {
+        size_t n = 0;
+        for(const LogBufferExtern* buffer = this->first(); buffer != nullptr; buffer = buffer->_next) ++n;
+        return n;
+    }
+
+    Coroutine<Exit> log_task(LogAggregator* aggregator, Duration period){
+        while(true){
+            aggregator->write_all();
+            co_await Delay(period);
+        }
+        co_return Exit::Success;
+    }
+
+} // namespace fiber
@@ -0,0 +1,282 @@
+#pragma once
+
+// std
+#ifdef FIBER_MULTI_CORE
+    #include <atomic>
+#endif
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// fiber
+#include <fiber/Chrono/Duration.hpp>
+#include <fiber/Chrono/TimePoint.hpp>
+#include <fiber/OS/Coroutine.hpp>
+#include <fiber/OS/Exit.hpp>
+#include <fiber/OStream/OStream.hpp>
+
+namespace fiber{
+
+    class LogAggregator;
+
+    /**
+     * \brief Output stream of a single task that collects whole lines in a ring buffer, a `LogAggregator` writes them to the real sink later
+     *
+     * Writing costs a copy into the ring buffer, the sink is not called by the task.
+     * Each line is stamped with the time of its first character and is only handed to the aggregator once it is complete
+     * (on `newl()`, `endl()` or `flush()`), so lines of different tasks never interleave.
+     *
+     * The buffer is a lock-free single producer, single consumer queue: the task writes, the aggregator reads.
+     * With `FIBER_MULTI_CORE` the logger task may run on another core.
+     * If the buffer is full, the text that does not fit is dropped (one character is kept for the line end) and counted,
+     * a line whose record does not fit at all is dropped completely, see `dropped()` and `dropped_lines()`.
+     *
+     * Keep the buffer in the coroutine frame of the task (allocated from its frame allocator) or as a member of a task class:
+     * ```C++
+     * static fiber::Coroutine<fiber::Exit> sensor_main(fiber::LogAggregator* logs){
+     *     fiber::LogBuffer<128> log(*logs);
+     *     while(true){
+     *         log << "temp: " << read_temperature() << fiber::newl;
+     *         co_await fiber::Delay(100ms);
+     *     }
+     * }
+     * ```
+     *
+     * \see fiber::LogAggregator
+     */
+    class LogBufferExtern : public OStream{
+    private:
+        /// the header of every line in the ring buffer, followed by `length` characters
+        struct RecordHeader{
+            TimePoint time;
+            uint16_t length;
+        };
+
+        static constexpr size_t header_size = sizeof(RecordHeader);
+        static constexpr size_t max_line_length = UINT16_MAX;
+
+        char* _buffer;
+        size_t _capacity;
+
+        // counters that only grow, the position in the buffer is `counter & (capacity - 1)`
+        #ifdef FIBER_MULTI_CORE
+            std::atomic<size_t> _head = 0; // end of the complete lines, written by the task
+            std::atomic<size_t> _tail = 0; // start of the oldest line, written by the aggregator
+        #else
+            size_t _head = 0;
+            size_t _tail = 0;
+        #endif
+
+        // the line that is being written, only used by the task
+        TimePoint _line_time;
+        size_t _line_length = 0;
+        bool _line_open = false;
+        bool _line_dropped = false;
+
+        size_t _dropped = 0;
+        size_t _dropped_lines = 0;
+
+        // intrusive list of the aggregator
+        #ifdef FIBER_MULTI_CORE
+            std::atomic<LogAggregator*> _aggregator = nullptr; // cleared by the aggregator once it detached the buffer
+            std::atomic<bool> _closing = false; // set by the task, the aggregator drains and detaches the buffer
+        #else
+            LogAggregator* _aggregator = nullptr;
+        #endif
+        LogBufferExtern* _next = nullptr;
+
+        friend class LogAggregator;
+
+    public:
+
+        /**
+         * \param buffer pointer to the start of the ring buffer
+         * \param capacity the number of bytes of the buffer, has to be a power of two
+         */
+        LogBufferExtern(char* buffer, size_t capacity);
+
+        /**
+         * \param buffer pointer to the start of the ring buffer
+         * \param capacity the number of bytes of the buffer, has to be a power of two
+         * \param aggregator the aggregator that writes the lines to the sink, see `LogAggregator::attach()`
+         */
+        LogBufferExtern(char* buffer, size_t capacity, LogAggregator& aggregator);
+
+        /// @brief calls `close()`
+        ~LogBufferExtern();
+
+        LogBufferExtern(const LogBufferExtern&) = delete;
+        LogBufferExtern& operator=(const LogBufferExtern&) = delete;
+
+        /// @brief appends a character to the current line
+        void put(char c) final;
+
+        /// @brief appends `count` many copies of a character to the current line
+        void put(char c, int count) final;
+
+        /// @brief appends a string to the current line
+        void write(const char* str, size_t len) final;
+
+        /// @brief appends a zero-terminated string to the current line
+        void write(const char* str) final;
+
+        /// @brief appends a new line character and hands the line to the aggregator
+        void newl() final;
+
+        /// @brief hands the current text to the aggregator, even if the line is not complete yet
+        void flush() final;
+
+        /**
+         * @brief completes the current line and detaches from the aggregator, which writes the remaining lines first
+         *
+         * With `FIBER_MULTI_CORE` this only marks the buffer as closing and waits until the aggregator drained and detached it
+         * on its own core. If the aggregator is idle in the mean time (for example because the logger task runs on the same core),
+         * the closing task drains the buffer itself, so that it cannot wait forever.
+         * Without `FIBER_MULTI_CORE` the aggregator and the task share the core and the task writes the remaining lines to the sink.
+         */
+        void close();
+
+        /// @brief returns the number of bytes of the ring buffer, including the headers of the lines
+        constexpr size_t capacity() const {return this->_capacity;}
+
+        /// @brief returns `true` if there are no complete lines waiting for the aggregator
+        bool empty() const;
+
+        /// @brief returns the number of characters that have been dropped because the buffer was full
+        constexpr size_t dropped() const {return this->_dropped;}
+
+        /// @brief returns the number of lines that have been dropped completely because the buffer was full
+        constexpr size_t dropped_lines() const {return this->_dropped_lines;}
+
+        /// @brief returns the aggregator that the buffer is attached to or `nullptr`
+        LogAggregator* aggregator() const;
+
+    private:
+        size_t load_head() const;
+        size_t load_tail() const;
+        void store_head(size_t head);
+        void store_tail(size_t tail);
+
+        /// returns the number of bytes that are neither used by complete lines nor by the current line
+        size_t free_space() const;
+
+        /// starts a line if there is none, returns `false` if the current line is dropped
+        bool open_line();
+
+        /// publishes the current line
+        void commit();
+
+        void copy_in(size_t position, const void* source, size_t count);
+        void copy_out(size_t position, void* dest, size_t count) const;
+
+        // used by the aggregator
+        RecordHeader front() const;
+        void write_front(OStream& sink);
+    };
+
+    /**
+     * \brief A `LogBufferExtern` that owns a ring buffer of `N` bytes
+     * \tparam N the number of bytes including a header of 8 (16 with `FIBER_CLOCK_UINT64`) bytes per line, has to be a power of two
+     */
+    template<size_t N>
+    class LogBuffer : public LogBufferExtern{
+        static_assert(std::has_single_bit(N), "The capacity of a log buffer has to be a power of two");
+        char _storage[N];
+
+    public:
+        LogBuffer() : LogBufferExtern(_storage, N){}
+        explicit LogBuffer(LogAggregator& aggregator) : LogBufferExtern(_storage, N, aggregator){}
+        ~LogBuffer(){this->close();}
+    };
+
+    /**
+     * \brief Merges the lines of all attached `LogBuffer`s in the order of their time stamps and writes them to one sink
+     *
+     * Run it as a task with a low priority through `fiber::log_task()`, so that the sink is only used in idle time:
+     * ```C++
+     * fiber::LogAggregator logs(uart, get_time);
+     * fiber::Task<256> logger("logger", 0, fiber::log_task, &logs, fiber::Duration(10ms));
+     * scheduler.add(&logger);
+     * ```
+     *
+     * Lines are merged by the time stamps of the lines that are complete when the aggregator looks at the buffers.
+     * With `FIBER_MULTI_CORE` buffers may be attached and closed from any core: attaching is lock-free and closing buffers
+     * are drained and detached by the aggregator, see `LogBufferExtern::close()`. Only one core writes to the sink at a time.
+     */
+    class LogAggregator{
+    private:
+        OStream* _sink;
+        TimePoint (*_now)();
+        #ifdef FIBER_MULTI_CORE
+            std::atomic<LogBufferExtern*> _buffers = nullptr; // pushed by any core, unlinked while holding `_busy`
+            std::atomic<bool> _busy = false; // held while writing to the sink or changing the links of the buffers
+        #else
+            LogBufferExtern* _buffers = nullptr;
+        #endif
+
+        friend class LogBufferExtern;
+
+    public:
+
+        /**
+         * \param sink the stream that receives the merged lines
+         * \param now function that returns the current time, used to stamp the lines
+         */
+        LogAggregator(OStream& sink, TimePoint (*now)());
+
+        /// @brief detaches all buffers, without writing their remaining lines
+        ~LogAggregator();
+
+        LogAggregator(const LogAggregator&) = delete;
+        LogAggregator& operator=(const LogAggregator&) = delete;
+
+        /// @brief returns the current time
+        TimePoint now() const {return this->_now();}
+
+        /// @brief returns the stream that receives the merged lines
+        OStream& sink() const {return *this->_sink;}
+
+        /// @brief adds a buffer, it may not be attached to another aggregator
+        void attach(LogBufferExtern& buffer);
+
+        /// @brief writes the remaining lines of the buffer in order with the other buffers and removes it, same as `buffer.close()`
+        void detach(LogBufferExtern& buffer);
+
+        /**
+         * @brief writes the oldest line of all buffers to the sink. Returns `false` if there was none.
+         * @details With `FIBER_MULTI_CORE` it also returns `false` if another core is writing at the same time.
+         */
+        bool write_next();
+
+        /**
+         * @brief writes lines until all buffers are empty, detaches closing buffers and flushes the sink. Returns the number of written lines.
+         * @details With `FIBER_MULTI_CORE` it returns `0` if another core is writing at the same time.
+         */
+        size_t write_all();
+
+        /// @brief returns the number of attached buffers
+        size_t size() const;
+
+    private:
+        bool try_lock();
+        void unlock();
+        LogBufferExtern* first() const;
+
+        /// writes the oldest line, requires the lock
+        bool write_oldest();
+
+        /// drains and unlinks all closing buffers, requires the lock. Returns the number of written lines.
+        size_t detach_closing();
+
+        /// removes a buffer from the list, requires the lock
+        void unlink(LogBufferExtern& buffer);
+    };
+
+    /**
+     * \brief Main function of a logger task that writes all lines of `aggregator` every `period`
+     *
+     * \see fiber::LogAggregator
+     */
+    Coroutine<Exit> log_task(LogAggregator* aggregator, Duration period);
+
+} // namespace fiber
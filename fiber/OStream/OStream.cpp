@@ -1,9 +1,14 @@
 #include <fiber/OStream/OStream.hpp>
 
+#include <algorithm>
+#include <bit>
 #include <limits>
 #include <ratio>
 #include <chrono>
 
+// fiber
+#include <fiber/Memory/memory.hpp>
+
 namespace fiber{
 
 // switch between compiletime and runtime member access
@@ -21,6 +26,32 @@ namespace fiber{
     OStreamRef cerr;
     OStreamRef clog;
 
+    // -----------------------------------------------------------------------------------------------
+    //                                       Block Copies
+    // -----------------------------------------------------------------------------------------------
+
+    void detail::copy_chars(char* dest, const char* src, size_t len){
+        if(len <= short_copy_length){
+            for(size_t i = 0; i < len; ++i) dest[i] = src[i];
+        }else{
+            fiber::memcpy(dest, src, len);
+        }
+    }
+
+    void detail::fill_chars(char* dest, char c, size_t len){
+        if(len <= short_copy_length){
+            for(size_t i = 0; i < len; ++i) dest[i] = c;
+        }else{
+            fiber::memset(dest, c, len);
+        }
+    }
+
+    size_t detail::copy_until_terminator(char* dest, const char* str, size_t capacity){
+        size_t len = 0;
+        for(; len < capacity && str[len] != '\0'; ++len) dest[len] = str[len];
+        return len;
+    }
+
     // -----------------------------------------------------------------------------------------------
     //                                           OStream
     // -----------------------------------------------------------------------------------------------
@@ -30,7 +61,7 @@ namespace fiber{
     }
 
     void OStream::write(const char* str, size_t len){
-        for(size_t i = 0; i < len; ++i) this->put(*str);
+        for(size_t i = 0; i < len; ++i) this->put(str[i]);
     }
 
     void OStream::write(const char* str){
@@ -50,25 +81,10 @@ namespace fiber{
 //                                       String Formating
 // -----------------------------------------------------------------------------------------------
 
+    template void print_str<OStream>(OStream& stream, const FormatStr& fstr);
+
     OStream& operator<<(OStream& stream, const FormatStr& fstr){
-        const int padding = fstr._mwidth - fstr._len;
-        int left_padding = 0;
-        int right_padding = 0;
-        switch(fstr._alignment){
-            break; case AlignmentLRC::Left: 
-                right_padding = padding;
-            break; case AlignmentLRC::Right: 
-                left_padding = padding;
-            break; case AlignmentLRC::Center: 
-                right_padding = padding/2; 
-                left_padding = padding - right_padding;
-            break; default: 
-                left_padding = 0;
-                right_padding = 0;
-        }
-        stream.put(fstr._fill, left_padding);
-        stream.write(fstr._str, fstr._len);
-        stream.put(fstr._fill, right_padding);
+        print_str(stream, fstr);
         return stream;
     }
 
@@ -77,243 +93,346 @@ namespace fiber{
     // -----------------------------------------------------------------------------------------------
 
     OStream& operator<<(OStream& stream, const FormatBool& value){
-        if(FIBER_FMT_MEMBER(FormatBool, value, _to_text)){
-            if(value._value){
-                return stream << FormatStr::like("true", 4, value);
-            }else{
-                return stream << FormatStr::like("false", 5, value);
-            }
-        }else{
-            if(value._value){
-                return stream << FormatStr::like("1", 1, value);
-            }else{
-                return stream << FormatStr::like("0", 1, value);
-            }
-        }
+        print_bool(stream, value);
+        return stream;
     }
 
     // -----------------------------------------------------------------------------------------------
     //                                       Integer Formating
     // -----------------------------------------------------------------------------------------------
 
-    void print_num_stringified(OStream& stream, std::string_view sign_str, std::string_view num_str, const FormatIntParams& params){
-        print_num_stringified(stream, sign_str, num_str, "", params);
-
-        //const int padding_count = params._mwidth - static_cast<int>(sign_str.size()) - static_cast<int>(num_str.size());
-        //const int left_padding_count = padding_count / 2;
-        //const int right_padding_count = padding_count - left_padding_count;
-        //const FormatStr padding = FormatStr("").fill(params._fill).mwidth(padding_count);
-        //const FormatStr left_padding = FormatStr("").fill(params._fill).mwidth(left_padding_count);
-        //const FormatStr right_padding = FormatStr("").fill(params._fill).mwidth(right_padding_count);
-        //
-        //switch(params._alignment){
-        //    case AlignmentLRC::Left : {
-        //        // padding after sign
-        //        stream << sign_str << num_str << padding;
-        //    }break;
-        //    case AlignmentLRC::Center : {
-        //        if(params._pad_sign){
-        //            // padding between sign and number and after number
-        //            stream << sign_str << left_padding << num_str << right_padding;
-        //        }else{
-        //            // padding before sign and after number
-        //            stream << left_padding << sign_str << num_str << right_padding;
-        //        }
-        //    }break;
-        //    default: //fallthrough
-        //    case AlignmentLRC::Right : {
-        //        if(params._pad_sign){
-        //            // padding between sign and number
-        //            stream << sign_str << padding << num_str;
-        //        }else{
-        //            // padding before sign
-        //            stream << padding << sign_str << num_str;
-        //        }
-        //    }break;
-        //}
-    }
+    template void print_num_stringified<OStream>(OStream& stream, std::string_view sign_str, std::string_view num_str, const FormatIntParams& params);
+    template void print_num_stringified<OStream>(OStream& stream, std::string_view sign_str, std::string_view num_str, std::string_view suffix, const FormatIntSuffixParams& params);
 
-    void print_num_stringified(OStream& stream, std::string_view sign_str, std::string_view num_str, std::string_view suffix, const FormatIntSuffixParams& params){
-        const int padding = params._mwidth - static_cast<int>(sign_str.size()) - static_cast<int>(num_str.size()) - static_cast<int>(suffix.size());
-        
+    // -----------------------------------------------------------------------------------------------
+    //                                       Float Formating
+    // -----------------------------------------------------------------------------------------------
+
+    namespace{
+
+        using detail::DecimalDigits;
+        using detail::display_exponent;
+        using detail::float_digits_buffer_size;
+
+        /// removes zeros at the end of the digits, leaves at least one digit
+        void strip_trailing_zeros(DecimalDigits& d){
+            while(d.length > 1 && d.digits[d.length - 1] == '0'){
+                --d.length;
+                ++d.exponent;
+            }
+        }
+
+        /// sets the digits to zero
+        void set_zero(DecimalDigits& d){
+            d.digits[0] = '0';
+            d.length = 1;
+            d.exponent = 0;
+        }
+
+        /// returns `round(num / den)` rounded half up
+        uint64_t divide_round(uint64_t num, uint64_t den){
+            const uint64_t q = num / den;
+            const uint64_t r = num - q * den;
+            return q + (r >= den - r);
+        }
 
-        int padding_before_sign = 0;
-        int padding_between_sign_number = 0;
-        int padding_between_number_suffix = 0;
-        int padding_after_suffix = 0; 
+        /// a positive float as `mantissa * 2^exponent2` with an odd mantissa
+        struct BinaryFloat{
+            uint64_t mantissa;
+            int exponent2;
 
-        switch(params._alignment){
-            case AlignmentLRC::Left : {
-                if(params._pad_suffix){
-                    // padding between number and suffix
-                    padding_between_number_suffix = padding;
+            /// estimates the decimal exponent of the first digit, may be one too small
+            int estimate_lead() const {
+                // 2^k <= value < 2^(k+1)
+                const int k = this->exponent2 + static_cast<int>(std::bit_width(this->mantissa)) - 1;
+                return (k * 78913) >> 18;
+            }
+        };
+
+        template<class Float>
+        BinaryFloat decompose(Float value){
+            constexpr int precision = std::numeric_limits<Float>::digits;
+            constexpr int bias = std::numeric_limits<Float>::max_exponent - 1 + (precision - 1);
+            using Bits = std::conditional_t<(sizeof(Float) == 4), uint32_t, uint64_t>;
+
+            const uint64_t bits = std::bit_cast<Bits>(value);
+            const int biased_exponent = static_cast<int>(bits >> (precision - 1));
+            uint64_t mantissa = bits & ((uint64_t(1) << (precision - 1)) - 1);
+            int exponent2 = 1 - bias;
+            if(biased_exponent != 0){
+                mantissa |= uint64_t(1) << (precision - 1);
+                exponent2 = biased_exponent - bias;
+            }
+            const int zeros = std::countr_zero(mantissa);
+            return BinaryFloat{mantissa >> zeros, exponent2 + zeros};
+        }
+
+        /**
+         * Exact fixed point fast path: rounds `value * 10^(decimals - display exponent)` to an integer with 64-bit arithmetic.
+         * Returns `false` if the scaled value does not fit into 64 bit.
+         */
+        template<class Float>
+        bool fixed_digits(Float value, FloatRepresentation representation, int decimals, DecimalDigits& d, char* buffer, size_t buffer_size){
+            const BinaryFloat binary = decompose(value);
+            const uint64_t mantissa = binary.mantissa;
+            const int exponent2 = binary.exponent2;
+            int display = display_exponent(representation, binary.estimate_lead());
+
+            for(int attempt = 0; attempt < 2; ++attempt){
+                const int scale10 = decimals - display;
+                if(scale10 > 19 || scale10 < -19) return false;
+
+                // value * 10^scale10 = num / den
+                uint64_t num = mantissa;
+                uint64_t den = 1;
+                if(scale10 >= 0){
+                    // conservative overflow check without a division
+                    const uint64_t p = detail::powers_of_10[scale10];
+                    if(std::bit_width(num) + std::bit_width(p) > 64) return false;
+                    num *= p;
                 }else{
-                    // padding after suffix
-                    padding_after_suffix = padding;
-                }
-            }break;
-            case AlignmentLRC::Center : {
-                const int left_padding = padding / 2;
-                const int right_padding = padding - left_padding;
-
-                if(!params._pad_sign && !params._pad_suffix){
-                    // padding before sign and after suffix
-                    padding_before_sign = left_padding;
-                    padding_after_suffix = right_padding;
-                }else if(params._pad_sign && !params._pad_suffix){
-                    // padding between sign and number and after suffix
-                    padding_between_sign_number = left_padding;
-                    padding_after_suffix = right_padding;
-                }else if(!params._pad_sign && params._pad_suffix){
-                    // padding before sign and between number and suffix
-                    padding_before_sign = left_padding;
-                    padding_between_number_suffix = right_padding;
-                }else /* (params._pad_sign && params._pad_suffix) */ {
-                    // padding between sign and number and between number and suffix
-                    padding_between_sign_number = left_padding;
-                    padding_between_number_suffix = right_padding;
+                    den = detail::powers_of_10[-scale10];
                 }
-            }break;
-            case AlignmentLRC::Right : {
-                if(params._pad_sign){
-                    // padding between sign and number
-                    padding_between_sign_number = padding;
+                if(exponent2 >= 0){
+                    if(exponent2 >= 64 || num > (std::numeric_limits<uint64_t>::max() >> exponent2)) return false;
+                    num <<= exponent2;
                 }else{
-                    // padding before sign
-                    padding_before_sign = padding;
+                    if(-exponent2 >= 64 || den > (std::numeric_limits<uint64_t>::max() >> -exponent2)) return false;
+                    den <<= -exponent2;
                 }
-            }break;
-        }
 
-        stream.put(params._fill, padding_before_sign);
-        stream.write(sign_str.data(), sign_str.size());
-        stream.put(params._fill, padding_between_sign_number);
-        stream.write(num_str.data(), num_str.size());
-        stream.put(params._fill, padding_between_number_suffix);
-        stream.write(suffix.data(), suffix.size());
-        stream.put(params._fill, padding_after_suffix);
-    }
+                // powers of two reduce to a shift
+                const uint64_t fixpoint = ((den & (den - 1)) == 0)
+                    ? (num >> std::countr_zero(den)) + ((den > 1) && ((num >> (std::countr_zero(den) - 1)) & 1))
+                    : divide_round(num, den);
 
-    // -----------------------------------------------------------------------------------------------
-    //                                       Float Formating
-    // -----------------------------------------------------------------------------------------------
+                if(fixpoint == 0){
+                    set_zero(d);
+                    return true;
+                }
+
+                const std::string_view str = uint_to_string(buffer, buffer + buffer_size, fixpoint);
+                d.digits = const_cast<char*>(str.data());
+                d.length = static_cast<int>(str.size());
+                d.exponent = -scale10;
+                strip_trailing_zeros(d);
 
-    char* str_add_float(char* first, char* last, const FormatFloat& value){
-        char* itr = first;
-
-        // get unsigned float and print sign
-        float unsigned_float = value._value;
-        
-        // get exponent and mantissa in base 10: m * 10 ^ e
-        int exponent10;
-        float mantissa10 = frexp10(unsigned_float, &exponent10);
-
-        // scale the base 10 exponent and mantisse relative to the representation
-        // TODO: Full representation might have issues for very large or very small numbers.
-        switch(FIBER_FMT_MEMBER(FormatFloat, value, _representation)){
-            case FloatRepresentation::Engineering : {
-                const int em = exponent10 % 3;
-                mantissa10 *= fiber::pow(10, em);
-                exponent10 -= em;
-            }break;
-            case FloatRepresentation::Full : {
-                mantissa10 *= fiber::pow(10, exponent10);
-                exponent10 = 0;
-            }break;
-            default: break;
+                // the guess of the first digit or the rounding may have moved the display exponent
+                const int new_display = display_exponent(representation, d.lead());
+                if(new_display == display) return true;
+                display = new_display;
+            }
+            return false;
         }
 
-        // round to the number of decimals
-        const unsigned long long pow_10_p_decimals = fiber::pow(10, FIBER_FMT_MEMBER(FormatFloat, value, _decimals));
-        const unsigned long long fixpoint = static_cast<unsigned long long>(mantissa10 * pow_10_p_decimals + 0.5f);
+        /// rounds the digits half up so that `last_exponent` is the decimal exponent of the last digit
+        void round_digits(DecimalDigits& d, int last_exponent){
+            const int keep = d.lead() - last_exponent + 1;
+            if(keep >= d.length) return;
+            if(keep < 0){
+                set_zero(d);
+                return;
+            }
 
-        const unsigned long long digits = fixpoint / pow_10_p_decimals;
-        const unsigned long long fractions = fixpoint - digits * pow_10_p_decimals;
+            const bool round_up = d.digits[keep] >= '5';
+            d.exponent += d.length - keep;
+            d.length = keep;
+            if(!round_up){
+                if(keep == 0) set_zero(d);
+                return;
+            }
 
-        // convert digits to text
-        char buffer[32];
-        const std::string_view digit_str = uint_to_string(&buffer[0], &buffer[32], digits, value._use_thousands, value._thousands_char);
-        for(char c : digit_str){
-            *itr++ = c;
+            // increment with carry, all nines turn into a single one
+            int i = keep - 1;
+            for(; i >= 0 && d.digits[i] == '9'; --i) d.digits[i] = '0';
+            if(i >= 0){
+                ++d.digits[i];
+            }else{
+                d.exponent += d.length;
+                d.digits[0] = '1';
+                d.length = 1;
+            }
         }
 
-        // convert fractions to text
-        {    
-            if(fractions != 0 || FIBER_FMT_MEMBER(FormatFloat, value, _force_comma) || FIBER_FMT_MEMBER(FormatFloat, value, _force_decimals)){
-                *itr++ = FIBER_FMT_MEMBER(FormatFloat, value, _comma);
-                unsigned long long temp_fractions = fractions;
-                for(size_t i = 0; (i < FIBER_FMT_MEMBER(FormatFloat, value, _decimals)) && ((temp_fractions > 0) || FIBER_FMT_MEMBER(FormatFloat, value, _force_decimals)); ++i){
-                    if((i != 0) && FIBER_FMT_MEMBER(FormatFloat, value, _use_thousands) && (i % 3 == 0)){
-                        *itr++ = FIBER_FMT_MEMBER(FormatFloat, value, _thousands_char);
-                    } 
-                    temp_fractions *= 10;
-                    const unsigned long long digit = temp_fractions / pow_10_p_decimals;
-                    *itr++ = '0' + static_cast<char>(digit);
-                    temp_fractions = temp_fractions - digit * pow_10_p_decimals;
-                }
-            }
+        /**
+         * Small fallback for values that do not fit the fixed point fast path: rounds the shortest digits that read back as `value`.
+         * Digits past them are printed as zeros and the last printed digit may differ from the exact value next to a tie.
+         */
+        template<class Float>
+        void rounded_digits(Float value, FloatRepresentation representation, int decimals, DecimalDigits& d, char* buffer){
+            d.digits = buffer;
+            d.length = shortest_digits(value, buffer, &d.exponent);
+            strip_trailing_zeros(d);
+            round_digits(d, display_exponent(representation, d.lead()) - decimals);
+            strip_trailing_zeros(d);
         }
 
-        // convert exponent to string
-        if((exponent10 != 0) || FIBER_FMT_MEMBER(FormatFloat, value, _force_exponent)){
-            *itr++ = 'e';
-            if(exponent10 >= 0){
-                if(value._force_exponent_sign){
-                    *itr++ = '+';
-                }
-                std::string_view exp_str = uint_to_string(itr, last, static_cast<unsigned int>(exponent10));
-                for(char c : exp_str){
-                    *itr++ = c;
+#ifdef FIBER_FMT_EXACT_DIGITS
+
+        /// unsigned integer with a fixed capacity of base 10^9 limbs, the least significant limb first
+        template<size_t capacity>
+        class DecimalBigInt{
+            static constexpr uint32_t _base = 1'000'000'000;
+            uint32_t _limbs[capacity];
+            size_t _size = 0;
+
+            void push(uint64_t limb){
+                FIBER_ASSERT_CRITICAL_MSG(this->_size < capacity, "DecimalBigInt: capacity exceeded");
+                this->_limbs[this->_size++] = static_cast<uint32_t>(limb);
+            }
+
+            /// `factor` and `divisor` have to fit into 32 bits, so that the intermediate results fit into 64 bit
+            void multiply(uint32_t factor){
+                uint64_t carry = 0;
+                for(size_t i = 0; i < this->_size; ++i){
+                    const uint64_t product = uint64_t(this->_limbs[i]) * factor + carry;
+                    this->_limbs[i] = static_cast<uint32_t>(product % _base);
+                    carry = product / _base;
                 }
-            }else{
-                *itr++ = '-';
-                std::string_view exp_str = uint_to_string(itr, last, static_cast<unsigned int>(-exponent10));
-                for(char c : exp_str){
-                    *itr++ = c;
+                for(; carry != 0; carry /= _base) this->push(carry % _base);
+            }
+
+            void divide(uint32_t divisor){
+                uint64_t remainder = 0;
+                for(size_t i = this->_size; i-- > 0;){
+                    const uint64_t current = remainder * _base + this->_limbs[i];
+                    this->_limbs[i] = static_cast<uint32_t>(current / divisor);
+                    remainder = current % divisor;
                 }
+                while(this->_size > 0 && this->_limbs[this->_size - 1] == 0) --this->_size;
             }
-        }
 
-        return itr;
-    }
+        public:
+            explicit DecimalBigInt(uint64_t value){
+                for(; value != 0; value /= _base) this->push(value % _base);
+            }
 
+            bool is_zero() const {return this->_size == 0;}
 
-    OStream& operator<<(OStream& stream, FormatFloat value){     
-        
-        if(fiber::is_nan(value._value)){
-            return stream << FormatStr::like("nan", 3, value);
-        }else{
-            char buffer[64];
-            char* beginItr = buffer;
-            char* endItr = buffer + sizeof(buffer);
-            char * itr = buffer;
-
-
-            const bool sign = value._value < 0;
-            value._value = sign ? -value._value : value._value;
-            const char sign_char = sign ? '-' : '+';
-            const bool show_sign = sign || FIBER_FMT_MEMBER(FormatFloat, value, _force_sign);
-
-            if(show_sign){
-                if(FIBER_FMT_MEMBER(FormatFloat, value, _pad_sign)){
-                    // add sign first to the stream and then align the number string
-                    stream << sign_char;
-                    value._mwidth -= 1;
+            /// multiplies with `2^n` for positive `n` and divides by `2^-n` rounding down otherwise
+            void scale2(int n){
+                if(n > 0){
+                    for(; n > 0; n -= 31) this->multiply(uint32_t(1) << std::min(n, 31));
                 }else{
-                    // add sign to the number and then align the number string in the stream
-                    *itr++ = sign_char;
+                    for(; n < 0 && !this->is_zero(); n += 31) this->divide(uint32_t(1) << std::min(-n, 31));
                 }
             }
 
-            if (fiber::is_inf(value._value)){
-                *itr++ = 'i';
-                *itr++ = 'n';
-                *itr++ = 'f';
-            }else{
-                itr = str_add_float(itr, endItr, value);
+            /// multiplies with `5^n` for positive `n` and divides by `5^-n` rounding down otherwise
+            void scale5(int n){
+                constexpr uint32_t powers_of_5[] = {1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625, 1220703125};
+                if(n > 0){
+                    for(; n > 0; n -= 13) this->multiply(powers_of_5[std::min(n, 13)]);
+                }else{
+                    for(; n < 0 && !this->is_zero(); n += 13) this->divide(powers_of_5[std::min(-n, 13)]);
+                }
+            }
+
+            void increment(){
+                for(size_t i = 0; i < this->_size; ++i){
+                    if(++this->_limbs[i] < _base) return;
+                    this->_limbs[i] = 0;
+                }
+                this->push(1);
+            }
+
+            /// writes the decimal digits to the end of the buffer and returns them, has to be non zero
+            std::string_view to_string(char* buffer_first, char* buffer_last) const {
+                char* first = buffer_last;
+                for(size_t i = 0; i + 1 < this->_size; ++i){
+                    uint32_t limb = this->_limbs[i];
+                    for(int n = 0; n < 9; ++n, limb /= 10) *--first = static_cast<char>('0' + limb % 10);
+                }
+                const std::string_view top = uint_to_string(buffer_first, first, this->_limbs[this->_size - 1]);
+                return std::string_view(top.data(), static_cast<size_t>(buffer_last - top.data()));
+            }
+        };
+
+        /**
+         * Exact fallback for values that do not fit the fixed point fast path: rounds `value * 10^(decimals - display exponent)`
+         * half up to an integer with big integer arithmetic. `buffer_size` has to be at least `float_digits_buffer_size<Float>`.
+         */
+        template<class Float>
+        void exact_digits(Float value, FloatRepresentation representation, int decimals, DecimalDigits& d, char* buffer, size_t buffer_size){
+            // 2 * mantissa * 5^(-min exponent) is the largest intermediate value
+            constexpr int min_exponent2 = std::numeric_limits<Float>::min_exponent - std::numeric_limits<Float>::digits;
+            constexpr size_t capacity = static_cast<size_t>((std::numeric_limits<Float>::digits + 1 - min_exponent2 * 7 / 3) * 3 / 10 / 9 + 2);
+
+            const BinaryFloat binary = decompose(value);
+            int display = display_exponent(representation, binary.estimate_lead());
+
+            // the estimated first digit may be one off and rounding may add a digit, both can move the display exponent once
+            for(int attempt = 0; attempt < 3; ++attempt){
+                // digits below 10^exponent2 are all zero for negative exponent2
+                const int scale10 = std::min(decimals - display, std::max(-binary.exponent2, 0));
+
+                // 2 * value * 10^scale10 rounded down, then halved with rounding up
+                DecimalBigInt<capacity> fixpoint(binary.mantissa);
+                const int n2 = 1 + binary.exponent2 + scale10;
+                if(n2 > 0) fixpoint.scale2(n2);
+                if(scale10 > 0) fixpoint.scale5(scale10);
+                if(n2 < 0) fixpoint.scale2(n2);
+                if(scale10 < 0) fixpoint.scale5(scale10);
+                fixpoint.increment();
+                fixpoint.scale2(-1);
+
+                if(fixpoint.is_zero()){
+                    set_zero(d);
+                    return;
+                }
+
+                const std::string_view str = fixpoint.to_string(buffer, buffer + buffer_size);
+                d.digits = const_cast<char*>(str.data());
+                d.length = static_cast<int>(str.size());
+                d.exponent = -scale10;
+                strip_trailing_zeros(d);
+
+                const int new_display = display_exponent(representation, d.lead());
+                if(new_display == display) return;
+                display = new_display;
+            }
+        }
+
+#endif
+
+        template<class Float>
+        void float_digits(Float value, FloatRepresentation representation, int decimals, bool shortest, DecimalDigits& d){
+            char* const buffer = d.digits;
+            if(value == 0){
+                set_zero(d);
+            }else if(shortest){
+                d.length = shortest_digits(value, buffer, &d.exponent);
+                strip_trailing_zeros(d);
+            }else if(!fixed_digits(value, representation, decimals, d, buffer, float_digits_buffer_size<Float>)){
+                #ifdef FIBER_FMT_EXACT_DIGITS
+                    exact_digits(value, representation, decimals, d, buffer, float_digits_buffer_size<Float>);
+                #else
+                    rounded_digits(value, representation, decimals, d, buffer);
+                #endif
             }
-            return stream << FormatStr::like(beginItr, itr, value);
         }
+
+    } // namespace
+
+    void detail::float_digits(float value, FloatRepresentation representation, int decimals, bool shortest, DecimalDigits& d){
+        fiber::float_digits(value, representation, decimals, shortest, d);
+    }
+
+    void detail::float_digits(double value, FloatRepresentation representation, int decimals, bool shortest, DecimalDigits& d){
+        fiber::float_digits(value, representation, decimals, shortest, d);
+    }
+
+    template void print_float<OStream, float>(OStream& stream, FormatFloat<float> value);
+    template void print_float<OStream, double>(OStream& stream, FormatFloat<double> value);
+
+    OStream& operator<<(OStream& stream, const FormatFloat<float>& value){
+        print_float(stream, value);
+        return stream;
+    }
+
+    OStream& operator<<(OStream& stream, const FormatFloat<double>& value){
+        print_float(stream, value);
+        return stream;
     }
 
 
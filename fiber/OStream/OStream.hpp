@@ -6,6 +6,8 @@
 #include <cmath>
 #include <chrono>
 #include <string_view>
+#include <bit>
+#include <limits>
 
 //fiber
 #include <fiber/Core/concepts.hpp>
@@ -29,6 +31,16 @@ namespace fiber{
             #define FIBER_FMT_DECIMALS 5
         #elif defined(FIBER_FMT_FLOAT_DECIMALS_6)
             #define FIBER_FMT_DECIMALS 6
+        #elif defined(FIBER_FMT_FLOAT_DECIMALS)
+            #define FIBER_FMT_DECIMALS FIBER_FMT_FLOAT_DECIMALS
+        #else
+            #define FIBER_FMT_DECIMALS 3
+        #endif
+
+        #ifdef FIBER_FMT_FLOAT_SHORTEST
+            #define FIBER_FMT_FLOAT_SHORTEST_VALUE true
+        #else
+            #define FIBER_FMT_FLOAT_SHORTEST_VALUE false
         #endif
 
         #if defined(FIBER_FMT_FLOAT_REP_SCI)
@@ -436,6 +448,34 @@ namespace fiber{
      */
     OStream& operator<<(OStream& stream, const FormatStr& fstr);
 
+    /**
+     * \brief Writes a `FormatStr` and its padding to the stream
+     * \details Templated on the stream type, so that `StaticOStream` can call the methods of its sink directly.
+     */
+    template<class Stream>
+    void print_str(Stream& stream, const FormatStr& fstr){
+        const int padding = fstr._mwidth - static_cast<int>(fstr._len);
+        int left_padding = 0;
+        int right_padding = 0;
+        switch(fstr._alignment){
+            break; case AlignmentLRC::Left: 
+                right_padding = padding;
+            break; case AlignmentLRC::Right: 
+                left_padding = padding;
+            break; case AlignmentLRC::Center: 
+                right_padding = padding/2; 
+                left_padding = padding - right_padding;
+            break; default: 
+                left_padding = 0;
+                right_padding = 0;
+        }
+        stream.put(fstr._fill, left_padding);
+        stream.write(fstr._str, fstr._len);
+        stream.put(fstr._fill, right_padding);
+    }
+
+    extern template void print_str<OStream>(OStream& stream, const FormatStr& fstr);
+
     struct FormatBoolParam : public FormatStrParams{
         #ifndef FIBER_FMT_MINIMAL
             bool _to_text = true;
@@ -528,6 +568,27 @@ namespace fiber{
      */
     OStream& operator<<(OStream& stream, const FormatBool& value);
 
+    /**
+     * \brief Writes a `FormatBool` to the stream
+     * \details Templated on the stream type, like `print_str()`
+     */
+    template<class Stream>
+    void print_bool(Stream& stream, const FormatBool& value){
+        if(value._to_text){
+            if(value._value){
+                print_str(stream, FormatStr::like("true", 4, value));
+            }else{
+                print_str(stream, FormatStr::like("false", 5, value));
+            }
+        }else{
+            if(value._value){
+                print_str(stream, FormatStr::like("1", 1, value));
+            }else{
+                print_str(stream, FormatStr::like("0", 1, value));
+            }
+        }
+    }
+
     /**
      * \brief Default bool formating, uses the settings of the stream
      */
@@ -650,35 +711,147 @@ namespace fiber{
         constexpr FormatInt& center(){this->_alignment = AlignmentLRC::Center; return *this;}
     };
 
-    template<std::unsigned_integral UInt>
-    std::string_view uint_to_string(char* buffer_first, char* buffer_last, UInt value, bool use_thousands_char = false, char thousands_char = ','){
-        if constexpr (!std::same_as<UInt, typename fiber::make_fast<UInt>::type>){
-            return uint_to_string(buffer_first, buffer_last, static_cast<typename fiber::make_fast<UInt>::type>(value), use_thousands_char, thousands_char);
-        }else{
-            char * itr = buffer_last;
+    namespace detail{
+        /// the two digit strings "00" to "99" back to back
+        inline constexpr char digit_pairs[] =
+            "0001020304050607080910111213141516171819"
+            "2021222324252627282930313233343536373839"
+            "4041424344454647484950515253545556575859"
+            "6061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
+        inline constexpr uint64_t powers_of_10[20] = {
+            1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+            10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+            1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+        };
+
+        /// writes the two digits of `pair` (0 to 99) to `dest[0]` and `dest[1]`
+        inline void copy_digit_pair(char* dest, unsigned int pair){
+            dest[0] = digit_pairs[2 * pair];
+            dest[1] = digit_pairs[2 * pair + 1];
+        }
+
+        /// copies and fills up to this length are done in place instead of calling `fiber::memcpy` or `fiber::memset`
+        inline constexpr size_t short_copy_length = 16;
+
+        /// copies `len` characters from `src` to `dest`, see `short_copy_length`
+        void copy_chars(char* dest, const char* src, size_t len);
+
+        /// writes `len` copies of `c` to `dest`, see `short_copy_length`
+        void fill_chars(char* dest, char c, size_t len);
+
+        /**
+         * \brief Copies the zero-terminated `str` to `dest` while searching its end
+         * 
+         * Stops at the terminator or after `capacity` characters, whichever comes first.
+         * The terminator is not copied.
+         * 
+         * \returns the number of copied characters, `str` has been copied completely if `str[returned] == '\0'`
+         */
+        size_t copy_until_terminator(char* dest, const char* str, size_t capacity);
+
+        /// `uint_to_string()` on a fast integer type, without the buffer check
+        template<std::unsigned_integral UInt>
+        std::string_view fast_uint_to_string(char* buffer_last, UInt value, bool use_thousands_char, char thousands_char){
+            char* itr = buffer_last;
+
+            if(use_thousands_char){
+                // one division per group of three digits
+                while(value >= 1000){
+                    const unsigned int group = static_cast<unsigned int>(value % 1000);
+                    value /= 1000;
+                    itr -= 2;
+                    detail::copy_digit_pair(itr, group % 100);
+                    *--itr = static_cast<char>('0' + group / 100);
+                    *--itr = thousands_char;
+                }
+            }else{
+                if constexpr (sizeof(UInt) > sizeof(uint32_t)){
+                    while(value > UINT32_MAX){
+                        uint32_t chunk = static_cast<uint32_t>(value % 100000000);
+                        value /= 100000000;
+                        for(int i = 0; i < 4; ++i){
+                            itr -= 2;
+                            detail::copy_digit_pair(itr, chunk % 100);
+                            chunk /= 100;
+                        }
+                    }
+                }
 
-            if(value == 0){
-                *--itr = '0';
-                return std::string_view(itr, buffer_last);
+                // one division per two digits
+                using Word = std::conditional_t<(sizeof(UInt) > sizeof(uint32_t)), uint32_t, UInt>;
+                Word word = static_cast<Word>(value);
+                while(word >= 100){
+                    itr -= 2;
+                    detail::copy_digit_pair(itr, static_cast<unsigned int>(word % 100));
+                    word /= 100;
+                }
+                value = word;
             }
-    
-            // convert to string
-            for(size_t i = 0; value != 0 && itr != buffer_first; ++i){
-                const auto mod = value % 10;
-                value = value / 10;
-                if((use_thousands_char!='\0') && (i != 0) && (i % 3 == 0)) {*--itr = thousands_char;};
-                *--itr = '0' + static_cast<char>(mod);
+
+            // the leading one to three digits
+            const unsigned int leading = static_cast<unsigned int>(value);
+            if(leading >= 100){
+                itr -= 2;
+                detail::copy_digit_pair(itr, leading % 100);
+                *--itr = static_cast<char>('0' + leading / 100);
+            }else if(leading >= 10){
+                itr -= 2;
+                detail::copy_digit_pair(itr, leading);
+            }else{
+                *--itr = static_cast<char>('0' + leading);
             }
-    
+
             return std::string_view(itr, buffer_last);
         }
+    } // namespace detail
+
+    /**
+     * \brief Returns the number of decimal digits of `value` without a division loop
+     * 
+     * Estimates log10 from the bit width (1233/4096 ≈ log10(2)) and corrects the estimate with one table lookup.
+     * Zero has one digit.
+     */
+    template<std::unsigned_integral UInt>
+    constexpr int count_digits(UInt value){
+        const UInt non_zero = static_cast<UInt>(value | 1u);
+        const int estimate = (static_cast<int>(std::bit_width(non_zero)) * 1233) >> 12;
+        return estimate + 1 - (static_cast<uint64_t>(non_zero) < detail::powers_of_10[estimate]);
     }
 
-    void print_num_stringified(OStream& stream, std::string_view sign_str, std::string_view num_str, const FormatIntParams& params);
+    /// the number of characters that `uint_to_string()` needs for any value of `UInt` including thousands separators
+    template<std::unsigned_integral UInt>
+    inline constexpr int uint_string_buffer_size = count_digits(std::numeric_limits<UInt>::max()) + (count_digits(std::numeric_limits<UInt>::max()) - 1) / 3;
 
-    template<std::integral Int>
+    /**
+     * \brief Converts `value` to decimal text that ends at `buffer_last`
+     * 
+     * Converts two digits per division with the `detail::digit_pairs` table, or three per division if thousands separators are used.
+     * 64-bit values are split into 8 digit chunks first, so that the inner loop runs on 32-bit words.
+     * The buffer has to hold all digits and separators of `value`, `uint_string_buffer_size<UInt>` characters are enough for any value.
+     * 
+     * \returns a view of the written text
+     */
+    template<std::unsigned_integral UInt>
+    std::string_view uint_to_string(char* buffer_first, char* buffer_last, UInt value, bool use_thousands_char = false, char thousands_char = ','){
+        using FastUInt = typename fiber::make_fast<UInt>::type;
+        const int n_digits = count_digits(static_cast<FastUInt>(value));
+        const int n_separators = use_thousands_char ? (n_digits - 1) / 3 : 0;
+        FIBER_ASSERT_O1_MSG(buffer_last - buffer_first >= n_digits + n_separators, "Buffer too small for the number. S: Provide `fiber::uint_string_buffer_size<UInt>` characters.");
+        return detail::fast_uint_to_string(buffer_last, static_cast<FastUInt>(value), use_thousands_char, thousands_char);
+    }
+
+    /**
+     * \brief Writes the sign and the digits of a number with the padding of `params`
+     * \details Templated on the stream type, like `print_str()`
+     */
+    template<class Stream>
+    void print_num_stringified(Stream& stream, std::string_view sign_str, std::string_view num_str, const FormatIntParams& params);
+
+    template<class Stream, std::integral Int>
         requires (std::same_as<Int, typename fiber::make_fast<Int>::type>)
-    void print_fast_int(OStream& stream, const Int& value, const FormatIntParams& params){
+    void print_fast_int(Stream& stream, const Int& value, const FormatIntParams& params){
         using namespace std::string_view_literals;
         using UInt = typename std::make_unsigned<Int>::type;
         
@@ -688,7 +861,7 @@ namespace fiber{
 
         if constexpr (std::is_signed_v<Int>){
             if(value < 0){
-                unsigned_value = static_cast<UInt>(-value);
+                unsigned_value = UInt(0) - unsigned_value; // also correct for the most negative value
                 sign_str = "-"sv;
                 
             }else if(params._force_sign){
@@ -700,14 +873,14 @@ namespace fiber{
             }
         }
 
-        char buffer[32];
-        const std::string_view num_str = uint_to_string(&buffer[0], &buffer[32], unsigned_value, params._use_thousands, params._thousands_char);
+        char buffer[uint_string_buffer_size<UInt>];
+        const std::string_view num_str = uint_to_string(&buffer[0], &buffer[uint_string_buffer_size<UInt>], unsigned_value, params._use_thousands, params._thousands_char);
 
         print_num_stringified(stream, sign_str, num_str, params);
     }
 
-    template<std::integral Int>
-    inline void print(OStream& stream, const Int& value, const FormatIntParams& params){
+    template<class Stream, std::integral Int>
+    inline void print(Stream& stream, const Int& value, const FormatIntParams& params){
         using FInt = typename fiber::make_fast<Int>::type;
         const FInt fast_value(value);
         print_fast_int(stream, fast_value, params);
@@ -829,11 +1002,82 @@ namespace fiber{
         constexpr FormatIntSuffix& center(){this->_alignment = AlignmentLRC::Center; return *this;}
     };
 
-    void print_num_stringified(OStream& stream, std::string_view sign_str, std::string_view num_str, std::string_view suffix, const FormatIntSuffixParams& params);
+    /**
+     * \brief Writes the sign, the digits and the suffix of a number with the padding of `params`
+     * \details Templated on the stream type, like `print_str()`
+     */
+    template<class Stream>
+    void print_num_stringified(Stream& stream, std::string_view sign_str, std::string_view num_str, std::string_view suffix, const FormatIntSuffixParams& params){
+        const int padding = params._mwidth - static_cast<int>(sign_str.size()) - static_cast<int>(num_str.size()) - static_cast<int>(suffix.size());
+
+        int padding_before_sign = 0;
+        int padding_between_sign_number = 0;
+        int padding_between_number_suffix = 0;
+        int padding_after_suffix = 0; 
+
+        switch(params._alignment){
+            case AlignmentLRC::Left : {
+                if(params._pad_suffix){
+                    // padding between number and suffix
+                    padding_between_number_suffix = padding;
+                }else{
+                    // padding after suffix
+                    padding_after_suffix = padding;
+                }
+            }break;
+            case AlignmentLRC::Center : {
+                const int left_padding = padding / 2;
+                const int right_padding = padding - left_padding;
+
+                if(!params._pad_sign && !params._pad_suffix){
+                    // padding before sign and after suffix
+                    padding_before_sign = left_padding;
+                    padding_after_suffix = right_padding;
+                }else if(params._pad_sign && !params._pad_suffix){
+                    // padding between sign and number and after suffix
+                    padding_between_sign_number = left_padding;
+                    padding_after_suffix = right_padding;
+                }else if(!params._pad_sign && params._pad_suffix){
+                    // padding before sign and between number and suffix
+                    padding_before_sign = left_padding;
+                    padding_between_number_suffix = right_padding;
+                }else /* (params._pad_sign && params._pad_suffix) */ {
+                    // padding between sign and number and between number and suffix
+                    padding_between_sign_number = left_padding;
+                    padding_between_number_suffix = right_padding;
+                }
+            }break;
+            case AlignmentLRC::Right : {
+                if(params._pad_sign){
+                    // padding between sign and number
+                    padding_between_sign_number = padding;
+                }else{
+                    // padding before sign
+                    padding_before_sign = padding;
+                }
+            }break;
+        }
+
+        stream.put(params._fill, padding_before_sign);
+        stream.write(sign_str.data(), sign_str.size());
+        stream.put(params._fill, padding_between_sign_number);
+        stream.write(num_str.data(), num_str.size());
+        stream.put(params._fill, padding_between_number_suffix);
+        stream.write(suffix.data(), suffix.size());
+        stream.put(params._fill, padding_after_suffix);
+    }
 
-    template<std::integral Int>
+    template<class Stream>
+    void print_num_stringified(Stream& stream, std::string_view sign_str, std::string_view num_str, const FormatIntParams& params){
+        print_num_stringified(stream, sign_str, num_str, "", FormatIntSuffixParams(params));
+    }
+
+    extern template void print_num_stringified<OStream>(OStream& stream, std::string_view sign_str, std::string_view num_str, std::string_view suffix, const FormatIntSuffixParams& params);
+    extern template void print_num_stringified<OStream>(OStream& stream, std::string_view sign_str, std::string_view num_str, const FormatIntParams& params);
+
+    template<class Stream, std::integral Int>
         requires(std::same_as<Int, typename fiber::make_fast<Int>::type>)
-    void print_fast_int(OStream& stream, const Int& value, std::string_view suffix, const FormatIntSuffixParams& params){
+    void print_fast_int(Stream& stream, const Int& value, std::string_view suffix, const FormatIntSuffixParams& params){
         using namespace std::string_view_literals;
         using UInt = typename std::make_unsigned<Int>::type;
 
@@ -847,18 +1091,18 @@ namespace fiber{
                 sign_str = "+"sv;
             }
         }else{
-            unsigned_value = static_cast<std::make_unsigned<Int>::type>(-value);
+            unsigned_value = UInt(0) - static_cast<UInt>(value); // also correct for the most negative value
             sign_str = "-"sv;
         }
 
-        char buffer[32];
-        const std::string_view num_str = uint_to_string(&buffer[0], &buffer[32], unsigned_value, params._use_thousands, params._thousands_char);
+        char buffer[uint_string_buffer_size<UInt>];
+        const std::string_view num_str = uint_to_string(&buffer[0], &buffer[uint_string_buffer_size<UInt>], unsigned_value, params._use_thousands, params._thousands_char);
 
         print_num_stringified(stream, sign_str, num_str, suffix, params);
     }
 
-    template<std::integral Int>
-    inline void print(OStream& stream, const Int& value, std::string_view suffix, const FormatIntSuffixParams& params){
+    template<class Stream, std::integral Int>
+    inline void print(Stream& stream, const Int& value, std::string_view suffix, const FormatIntSuffixParams& params){
         using FastInt = fiber::make_fast<Int>::type;
         const FastInt fast_value(value);
         print_fast_int(stream, fast_value, suffix, params);
@@ -892,6 +1136,7 @@ namespace fiber{
             bool _force_decimals = false;
             bool _force_exponent = false;
             bool _force_exponent_sign = false;
+            bool _shortest = false;
         #else
             static constexpr FloatRepresentation _representation = FIBER_FMT_FLOAT_REP;
             static constexpr char _comma = FIBER_FMT_COMMA_CHAR;
@@ -900,6 +1145,7 @@ namespace fiber{
             static constexpr bool _force_decimals = FIBER_FMT_FORCE_DECIMALS_VALUE;
             static constexpr bool _force_exponent = FIBER_FMT_FORCE_EXPONENT_VALUE;
             static constexpr bool _force_exponent_sign = FIBER_FMT_FORCE_EXPONENT_SIGN_VALUE;
+            static constexpr bool _shortest = FIBER_FMT_FLOAT_SHORTEST_VALUE;
         #endif
 
         constexpr FormatFloatParams()=default;
@@ -920,39 +1166,51 @@ namespace fiber{
     };
 
     /**
-     * \brief Formats an floating point for further printing use
+     * \brief Formats a `float` or a `double` for further printing use
+     *
+     * By default the value is rounded to `decimals()` digits after the comma.
+     * Use `shortest()` to print the shortest digits that read back as exactly the same value instead.
+     *
+     * Example:
+     * ```C++
+     * stream << FormatFloat(0.1);                  // Outputs 100e-3
+     * stream << FormatFloat(0.1).full();           // Outputs 0.1
+     * stream << FormatFloat(1.0 / 3).shortest();   // Outputs 333.3333333333333e-3
+     * ```
      */
+    template<class Float = float>
+        requires (std::is_same_v<Float, float> || std::is_same_v<Float, double>)
     struct FormatFloat : FormatFloatParams{
-        using value_type = float;
+        using value_type = Float;
         value_type _value = 0;
 
         constexpr FormatFloat() = default;
         constexpr FormatFloat(const FormatFloat&) = default;
         constexpr FormatFloat& operator=(const FormatFloat&) = default;
 
-        template <typename Float, typename std::enable_if<std::is_floating_point<Float>::value, int>::type = 0>
-        explicit constexpr FormatFloat(Float value) : _value(static_cast<float>(value)){}
+        template <typename Float1, typename std::enable_if<std::is_floating_point<Float1>::value, int>::type = 0>
+        explicit constexpr FormatFloat(Float1 value) : _value(static_cast<value_type>(value)){}
 
     private:
         // private constructors
-        template <typename Float, typename std::enable_if<std::is_floating_point<Float>::value, int>::type = 0>
-        constexpr FormatFloat(Float value, const FormatFloatParams& params) : FormatFloatParams(params), _value(static_cast<float>(value)){}
+        template <typename Float1, typename std::enable_if<std::is_floating_point<Float1>::value, int>::type = 0>
+        constexpr FormatFloat(Float1 value, const FormatFloatParams& params) : FormatFloatParams(params), _value(static_cast<value_type>(value)){}
 
-        template <typename Float, typename std::enable_if<std::is_floating_point<Float>::value, int>::type = 0>
-        constexpr FormatFloat(Float value, const FormatIntParams& params) : FormatFloatParams(params), _value(static_cast<float>(value)){}
+        template <typename Float1, typename std::enable_if<std::is_floating_point<Float1>::value, int>::type = 0>
+        constexpr FormatFloat(Float1 value, const FormatIntParams& params) : FormatFloatParams(params), _value(static_cast<value_type>(value)){}
 
-        template <typename Float, typename std::enable_if<std::is_floating_point<Float>::value, int>::type = 0>
-        constexpr FormatFloat(Float value, const FormatStrParams& params) : FormatFloatParams(params), _value(static_cast<float>(value)){}
+        template <typename Float1, typename std::enable_if<std::is_floating_point<Float1>::value, int>::type = 0>
+        constexpr FormatFloat(Float1 value, const FormatStrParams& params) : FormatFloatParams(params), _value(static_cast<value_type>(value)){}
     public:
 
-        template <typename Float, typename std::enable_if<std::is_floating_point<Float>::value, int>::type = 0>
-        constexpr static FormatFloat like(Float value, const FormatFloatParams& params){return FormatFloat(value, params);}
+        template <typename Float1, typename std::enable_if<std::is_floating_point<Float1>::value, int>::type = 0>
+        constexpr static FormatFloat like(Float1 value, const FormatFloatParams& params){return FormatFloat(value, params);}
 
-        template <typename Float, typename std::enable_if<std::is_floating_point<Float>::value, int>::type = 0>
-        constexpr static FormatFloat like(Float value, const FormatIntParams& params){return FormatFloat(value, params);}
+        template <typename Float1, typename std::enable_if<std::is_floating_point<Float1>::value, int>::type = 0>
+        constexpr static FormatFloat like(Float1 value, const FormatIntParams& params){return FormatFloat(value, params);}
 
-        template <typename Float, typename std::enable_if<std::is_floating_point<Float>::value, int>::type = 0>
-        constexpr static FormatFloat like(Float value, const FormatStrParams& params){return FormatFloat(value, params);}
+        template <typename Float1, typename std::enable_if<std::is_floating_point<Float1>::value, int>::type = 0>
+        constexpr static FormatFloat like(Float1 value, const FormatStrParams& params){return FormatFloat(value, params);}
 
         /**
          * \brief enables thousand characters
@@ -1038,7 +1296,7 @@ namespace fiber{
             return *this;
         }
 
-        /// @brief sets the precision, aka. the number of total digits that will be printed before and after the comma
+        /// @brief sets the precision, aka. the number of digits that will be printed after the comma. Values are rounded half up.
         constexpr FormatFloat& decimals([[maybe_unused]]int d){
             #ifndef FIBER_FMT_MINIMAL
                 this->_decimals = d; 
@@ -1077,8 +1335,19 @@ namespace fiber{
             #endif
             return *this;
         }
+
+        /// @brief print the shortest digits that read back as exactly the same value instead of rounding to `decimals()`
+        constexpr FormatFloat& shortest([[maybe_unused]]bool b=true){
+            #ifndef FIBER_FMT_MINIMAL
+                this->_shortest = b; 
+            #endif
+            return *this;
+        }
     };
 
+    template <typename Float, typename std::enable_if<std::is_floating_point<Float>::value, int>::type = 0>
+    FormatFloat(Float) -> FormatFloat<std::conditional_t<std::is_same_v<Float, float>, float, double>>;
+
     struct str_add_float_params{
         FloatRepresentation representation = FloatRepresentation::Scientific;
         #ifndef FIBER_FMT_MINIMAL
@@ -1104,7 +1373,191 @@ namespace fiber{
         #endif
     };
 
-    OStream& operator<<(OStream& stream, FormatFloat value);
+    namespace detail{
+
+        /// decimal digits of a positive number: `digits * 10^exponent`
+        struct DecimalDigits{
+            char* digits;
+            int length;
+            int exponent;
+
+            /// the decimal exponent of the first digit
+            constexpr int lead() const {return this->exponent + this->length - 1;}
+        };
+
+        #ifdef FIBER_FMT_EXACT_DIGITS
+            /// the number of characters that `float_digits()` needs: all exact digits of the smallest subnormal numbers, 112 for float and 767 for double, plus one block of 9
+            template<class Float>
+            inline constexpr size_t float_digits_buffer_size = (sizeof(Float) == 4) ? 120 : 776;
+        #else
+            /// the number of characters that `float_digits()` needs: the 20 digits of a 64-bit integer with some margin, the remaining digits are printed as zeros
+            template<class Float>
+            inline constexpr size_t float_digits_buffer_size = 24;
+        #endif
+
+        /// returns the exponent that will be printed for a number whose first digit has the decimal exponent `lead`
+        constexpr int display_exponent(FloatRepresentation representation, int lead){
+            switch(representation){
+                case FloatRepresentation::Scientific : return lead;
+                case FloatRepresentation::Engineering : return (lead >= 0) ? (lead / 3) * 3 : -((2 - lead) / 3) * 3;
+                default : return 0;
+            }
+        }
+
+        /**
+         * \brief Computes the decimal digits of a positive and finite `value` for printing
+         * 
+         * `d.digits` has to point to `float_digits_buffer_size<Float>` characters.
+         * The digits are rounded half up to `decimals` after the display exponent of `representation`, or are the
+         * shortest digits that read back as `value` if `shortest` is set. Trailing zeros are removed.
+         * Rounding is exact if the scaled value fits into 64 bit. Otherwise the shortest digits are rounded,
+         * or the exact digits if `FIBER_FMT_EXACT_DIGITS` is defined.
+         */
+        void float_digits(float value, FloatRepresentation representation, int decimals, bool shortest, DecimalDigits& d);
+
+        /// \copydoc float_digits(float, FloatRepresentation, int, bool, DecimalDigits&)
+        void float_digits(double value, FloatRepresentation representation, int decimals, bool shortest, DecimalDigits& d);
+
+        /// collects characters and writes them to the stream in blocks
+        template<class Stream>
+        class BlockWriter{
+            Stream& _stream;
+            char _buffer[32];
+            int _size = 0;
+
+        public:
+            explicit BlockWriter(Stream& stream) : _stream(stream){}
+            ~BlockWriter(){this->flush();}
+
+            void put(char c){
+                if(this->_size == sizeof(this->_buffer)) this->flush();
+                this->_buffer[this->_size++] = c;
+            }
+
+            void flush(){
+                this->_stream.write(this->_buffer, static_cast<size_t>(this->_size));
+                this->_size = 0;
+            }
+        };
+
+    } // namespace detail
+
+    /**
+     * \brief Writes a formated float
+     * \details Templated on the stream type, like `print_str()`
+     */
+    template<class Stream, class Float>
+    void print_float(Stream& stream, FormatFloat<Float> value){
+        if(fiber::is_nan(value._value)){
+            print_str(stream, FormatStr::like("nan", 3, value));
+            return;
+        }
+
+        const bool sign = value._value < 0;
+        const Float unsigned_value = sign ? -value._value : value._value;
+        const char sign_char = sign ? '-' : '+';
+        bool show_sign = sign || value._force_sign;
+
+        if(show_sign && value._pad_sign){
+            // add sign first to the stream and then align the number string
+            stream.put(sign_char);
+            value._mwidth -= 1;
+            show_sign = false;
+        }
+
+        if(fiber::is_inf(unsigned_value)){
+            const char* const str = sign ? "-inf" : "+inf";
+            print_str(stream, show_sign ? FormatStr::like(str, 4, value) : FormatStr::like(str + 1, 3, value));
+            return;
+        }
+
+        // get the decimal digits
+        const FloatRepresentation representation = value._representation;
+        const int decimals = static_cast<int>(value._decimals);
+
+        char buffer[detail::float_digits_buffer_size<Float>];
+        detail::DecimalDigits d{buffer, 0, 0};
+        detail::float_digits(unsigned_value, representation, decimals, value._shortest, d);
+
+        // layout: integral digits at the decimal exponents [display, lead], fraction digits at [display - n_fraction, display)
+        const bool zero = d.length == 1 && d.digits[0] == '0';
+        const int lead = zero ? 0 : d.lead();
+        const int display = zero ? 0 : detail::display_exponent(representation, lead);
+        const int n_integral = (lead >= display) ? lead - display + 1 : 1;
+        int n_fraction = (d.exponent < display) ? display - d.exponent : 0;
+        if(value._force_decimals && n_fraction < decimals) n_fraction = decimals;
+        const bool show_comma = n_fraction > 0 || value._force_comma || value._force_decimals;
+        const bool show_exponent = display != 0 || value._force_exponent;
+        const bool use_thousands = value._use_thousands;
+
+        char exponent_buffer[uint_string_buffer_size<unsigned int>];
+        std::string_view exponent_str;
+        if(show_exponent){
+            exponent_str = uint_to_string(&exponent_buffer[0], &exponent_buffer[uint_string_buffer_size<unsigned int>], static_cast<unsigned int>(display < 0 ? -display : display));
+        }
+        const bool show_exponent_sign = display < 0 || value._force_exponent_sign;
+
+        const int length = show_sign
+            + n_integral + (use_thousands ? (n_integral - 1) / 3 : 0)
+            + show_comma
+            + n_fraction + ((use_thousands && n_fraction > 0) ? (n_fraction - 1) / 3 : 0)
+            + (show_exponent ? 1 + show_exponent_sign + static_cast<int>(exponent_str.size()) : 0);
+
+        // padding as in FormatStr
+        const int padding = value._mwidth - length;
+        int left_padding = 0;
+        int right_padding = 0;
+        switch(value._alignment){
+            break; case AlignmentLRC::Left:
+                right_padding = padding;
+            break; case AlignmentLRC::Right:
+                left_padding = padding;
+            break; case AlignmentLRC::Center:
+                right_padding = padding/2;
+                left_padding = padding - right_padding;
+            break; default:
+                left_padding = 0;
+                right_padding = 0;
+        }
+        stream.put(value._fill, left_padding);
+        {
+            detail::BlockWriter<Stream> writer(stream);
+            auto digit_at = [&d](int exponent10){
+                const int i = d.lead() - exponent10;
+                return (i >= 0 && i < d.length) ? d.digits[i] : '0';
+            };
+
+            if(show_sign) writer.put(sign_char);
+
+            if(lead >= display){
+                for(int e = lead; e >= display; --e){
+                    if(use_thousands && e != lead && (e - display + 1) % 3 == 0) writer.put(value._thousands_char);
+                    writer.put(digit_at(e));
+                }
+            }else{
+                writer.put('0');
+            }
+
+            if(show_comma) writer.put(value._comma);
+            for(int i = 1; i <= n_fraction; ++i){
+                if(use_thousands && i != 1 && (i - 1) % 3 == 0) writer.put(value._thousands_char);
+                writer.put(digit_at(display - i));
+            }
+
+            if(show_exponent){
+                writer.put('e');
+                if(show_exponent_sign) writer.put(display < 0 ? '-' : '+');
+                for(char c : exponent_str) writer.put(c);
+            }
+        }
+        stream.put(value._fill, right_padding);
+    }
+
+    extern template void print_float<OStream, float>(OStream& stream, FormatFloat<float> value);
+    extern template void print_float<OStream, double>(OStream& stream, FormatFloat<double> value);
+
+    OStream& operator<<(OStream& stream, const FormatFloat<float>& value);
+    OStream& operator<<(OStream& stream, const FormatFloat<double>& value);
 
     template <typename Float, typename std::enable_if<std::is_floating_point<Float>::value, int>::type = 0>
     inline OStream& operator<<(OStream& stream, Float value){
@@ -1219,8 +1672,12 @@ namespace fiber{
 
     };
 
-    template<std::unsigned_integral UInt>
-    OStream& operator<<(OStream& stream, FormatHex<UInt> hex){
+    /**
+     * \brief Writes a `FormatHex` to the stream
+     * \details Templated on the stream type, like `print_str()`
+     */
+    template<class Stream, std::unsigned_integral UInt>
+    void print_hex(Stream& stream, FormatHex<UInt> hex){
         char buffer[sizeof(hex)*2];
         char* itr = &buffer[0];
 
@@ -1232,7 +1689,8 @@ namespace fiber{
         // print at least 1 zero
         if(hex._value == 0 && !hex.force_digits){
             *itr++ = '0';
-            return stream << FormatStr::like(buffer, itr, hex);
+            print_str(stream, FormatStr::like(buffer, itr, hex));
+            return;
         }
 
         int i = 0;
@@ -1258,7 +1716,13 @@ namespace fiber{
         }
 
         // output the formated string
-        return stream << FormatStr::like(buffer, itr, hex);
+        print_str(stream, FormatStr::like(buffer, itr, hex));
+    }
+
+    template<std::unsigned_integral UInt>
+    OStream& operator<<(OStream& stream, FormatHex<UInt> hex){
+        print_hex(stream, hex);
+        return stream;
     }
 
     // -----------------------------------------------------------------------------------------------
@@ -0,0 +1,44 @@
+#include <fiber/OStream/SpanOStream.hpp>
+
+namespace fiber{
+
+    void SpanOStream::put(char c){
+        if(this->_size < this->_capacity){
+            this->_buffer[this->_size++] = c;
+        }else{
+            ++this->_dropped;
+        }
+    }
+
+    void SpanOStream::put(char c, int count){
+        if(count <= 0) return;
+        size_t n = static_cast<size_t>(count);
+        if(n > this->available()){
+            this->_dropped += n - this->available();
+            n = this->available();
+        }
+
+        detail::fill_chars(this->_buffer + this->_size, c, n);
+        this->_size += n;
+    }
+
+    void SpanOStream::write(const char* str, size_t len){
+        if(len > this->available()){
+            this->_dropped += len - this->available();
+            len = this->available();
+        }
+
+        detail::copy_chars(this->_buffer + this->_size, str, len);
+        this->_size += len;
+    }
+
+    void SpanOStream::write(const char* str){
+        // copy while searching the end
+        size_t len = detail::copy_until_terminator(this->_buffer + this->_size, str, this->available());
+        this->_size += len;
+
+        // count the rest of the string
+        for(; str[len] != '\0'; ++len) ++this->_dropped;
+    }
+
+} // namespace fiber
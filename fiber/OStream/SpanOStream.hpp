@@ -0,0 +1,98 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+// fiber
+#include <fiber/OStream/OStream.hpp>
+
+namespace fiber{
+
+    /**
+     * \brief Output stream that formats directly into a fixed block of memory
+     *
+     * Use it to format a packet straight into a transmit or DMA buffer without an intermediate copy.
+     * Strings and paddings are appended with block copies instead of one virtual `put(char)` per character.
+     * Characters that do not fit are dropped and counted, see `truncated()`.
+     *
+     * The stream does not terminate the text with a zero and `flush()` does nothing.
+     *
+     * Example:
+     * ```C++
+     * fiber::SpanOStream stream(tx_buffer);
+     * stream << "temp: " << temperature << fiber::newl;
+     * uart_start_dma(stream.data(), stream.size());
+     * ```
+     */
+    class SpanOStream : public OStream{
+    private:
+        char* const _buffer;
+        size_t const _capacity;
+        size_t _size = 0;
+        size_t _dropped = 0;
+
+    public:
+
+        /// \param buffer the memory that the stream writes to
+        constexpr SpanOStream(std::span<char> buffer)
+            : _buffer(buffer.data())
+            , _capacity(buffer.size()){}
+
+        /// \param buffer pointer to the memory that the stream writes to
+        /// \param capacity the number of characters that fit into the buffer
+        constexpr SpanOStream(char* buffer, size_t capacity)
+            : _buffer(buffer)
+            , _capacity(capacity){}
+
+        SpanOStream(const SpanOStream&) = delete;
+        SpanOStream& operator=(const SpanOStream&) = delete;
+
+        /// @brief appends a character, drops it if the buffer is full
+        void put(char c) final;
+
+        /// @brief appends `count` many copies of a character with a block `fiber::memset`
+        void put(char c, int count) final;
+
+        /// @brief appends a string with a block `fiber::memcpy`, drops the characters that do not fit
+        void write(const char* str, size_t len) final;
+
+        /// @brief appends a zero-terminated string
+        void write(const char* str) final;
+
+        /// @brief does nothing, the characters are already in the buffer
+        void flush() final {}
+
+        /// @brief starts over at the beginning of the buffer and resets the number of dropped characters
+        constexpr void clear(){
+            this->_size = 0;
+            this->_dropped = 0;
+        }
+
+        /// @brief returns a pointer to the first written character
+        constexpr const char* data() const {return this->_buffer;}
+
+        /// @brief returns the number of written characters
+        constexpr size_t size() const {return this->_size;}
+
+        /// @brief returns the number of characters that fit into the buffer
+        constexpr size_t capacity() const {return this->_capacity;}
+
+        /// @brief returns the number of characters that can still be written
+        constexpr size_t available() const {return this->_capacity - this->_size;}
+
+        /// @brief returns the number of characters that have been dropped because the buffer was full
+        constexpr size_t dropped() const {return this->_dropped;}
+
+        /// @brief returns `true` if characters have been dropped because the buffer was full
+        constexpr bool truncated() const {return this->_dropped != 0;}
+
+        /// @brief returns the written characters
+        constexpr std::string_view view() const {return std::string_view(this->_buffer, this->_size);}
+
+        /// @brief returns the written part of the buffer
+        constexpr std::span<const char> span() const {return std::span<const char>(this->_buffer, this->_size);}
+    };
+
+} // namespace fiber
@@ -0,0 +1,233 @@
+#pragma once
+
+// std
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// fiber
+#include <fiber/OStream/OStream.hpp>
+#include <fiber/OStream/format.hpp>
+
+namespace fiber{
+
+    /**
+     * \brief A sink of a `StaticOStream`, has to offer `write(const char* str, size_t len)`
+     *
+     * Optional methods that are used if present:
+     * - `put(char c)`: writes a single character, otherwise `write(&c, 1)` is used
+     * - `flush()`: sends buffered characters, otherwise flushing does nothing
+     */
+    template<class Sink>
+    concept OStreamSink = requires(Sink& sink, const char* str, size_t len){
+        sink.write(str, len);
+    };
+
+    /**
+     * \brief Output stream that calls the methods of a sink type directly instead of through virtual methods
+     *
+     * Every `operator<<` of `OStream` calls the virtual `put()` and `write()` methods, so the compiler cannot inline
+     * the sink into the formatting code, even if the firmware only has a single stream type.
+     * `StaticOStream` is `final` and has its own `operator<<` overloads for all `Format*` types that keep the static type of the stream.
+     * The paddings and digits are passed to `Sink::write()` with direct calls that the compiler can inline.
+     *
+     * The stream is still an `OStream`, so it can be assigned to `fiber::cout` or passed to functions that take an `OStream&`.
+     * These take the virtual path. Types that only have an `operator<<` for `OStream&` work as well, but return an `OStream&`,
+     * so the following operators of the same expression take the virtual path too.
+     * Floating point numbers are formatted into a small buffer first, since their printer is not part of the header.
+     *
+     * Example:
+     * ```C++
+     * struct UartSink{
+     *     void write(const char* str, size_t len){for(size_t i = 0; i < len; ++i) uart_send(str[i]);}
+     * };
+     *
+     * fiber::StaticOStream<UartSink> uart;
+     * uart << "temp: " << fiber::FormatInt(temperature).mwidth(4) << fiber::newl;  // direct calls of UartSink::write()
+     * fiber::format<"{:>6} rpm\n">(uart, speed);                                   // also direct calls
+     * fiber::cout = uart;                                                          // virtual calls, like any other OStream
+     * ```
+     */
+    template<OStreamSink Sink>
+    class StaticOStream final : public OStream{
+    private:
+        Sink _sink;
+
+    public:
+        constexpr StaticOStream() = default;
+
+        /// \param sink the sink that receives the characters
+        explicit constexpr StaticOStream(const Sink& sink) : _sink(sink){}
+
+        /// \param sink the sink that receives the characters
+        explicit constexpr StaticOStream(Sink&& sink) : _sink(std::move(sink)){}
+
+        StaticOStream(const StaticOStream&) = delete;
+        StaticOStream& operator=(const StaticOStream&) = delete;
+
+        /// @brief returns the sink that receives the characters
+        constexpr Sink& sink(){return this->_sink;}
+
+        /// @brief returns the sink that receives the characters
+        constexpr const Sink& sink() const {return this->_sink;}
+
+        /// @brief writes a character with `Sink::put()` if the sink has it, otherwise with `Sink::write()`
+        void put(char c) final {
+            if constexpr (requires{this->_sink.put(c);}){
+                this->_sink.put(c);
+            }else{
+                this->_sink.write(&c, 1);
+            }
+        }
+
+        /// @brief writes `count` many copies of a character in blocks of 16 characters
+        void put(char c, int count) final {
+            if(count <= 0) return;
+            char block[16];
+            const int block_size = (count < 16) ? count : 16;
+            for(int i = 0; i < block_size; ++i) block[i] = c;
+            for(; count > block_size; count -= block_size) this->_sink.write(block, block_size);
+            this->_sink.write(block, static_cast<size_t>(count));
+        }
+
+        /// @brief passes the string to `Sink::write()`
+        void write(const char* str, size_t len) final {
+            this->_sink.write(str, len);
+        }
+
+        /// @brief passes the zero-terminated string to `Sink::write()`
+        void write(const char* str) final {
+            this->_sink.write(str, string_length(str));
+        }
+
+        /// @brief calls `Sink::flush()` if the sink has it
+        void flush() final {
+            if constexpr (requires{this->_sink.flush();}){
+                this->_sink.flush();
+            }
+        }
+
+        void newl() final {
+            this->put('\n');
+        }
+
+        void endl() final {
+            this->newl();
+            this->flush();
+        }
+    };
+
+    // -----------------------------------------------------------------------------------------------
+    //                         operator<< overloads that keep the static type
+    // -----------------------------------------------------------------------------------------------
+
+    template<class Sink>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, void(*function)(OStream&)){
+        function(stream);
+        return stream;
+    }
+
+    template<class Sink>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, char c){
+        stream.put(c);
+        return stream;
+    }
+
+    template<class Sink>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, const char* str){
+        stream.write(str);
+        return stream;
+    }
+
+    template<class Sink, CStringView StringView>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, const StringView& str){
+        stream.write(str.data(), str.size());
+        return stream;
+    }
+
+    template<class Sink>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, const FormatStr& fstr){
+        print_str(stream, fstr);
+        return stream;
+    }
+
+    template<class Sink>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, const FormatBool& value){
+        print_bool(stream, value);
+        return stream;
+    }
+
+    template<class Sink>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, bool value){
+        return stream << FormatBool(value);
+    }
+
+    template<class Sink, std::integral Int>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, const FormatInt<Int>& fvalue){
+        print(stream, fvalue._value, static_cast<const FormatIntParams&>(fvalue));
+        return stream;
+    }
+
+    template<class Sink, std::integral Int>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, const Int& value){
+        return stream << FormatInt<Int>(value);
+    }
+
+    template<class Sink, std::integral Int>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, const FormatIntSuffix<Int>& value){
+        print(stream, value._value, value._suffix, static_cast<const FormatIntSuffixParams&>(value));
+        return stream;
+    }
+
+    template<class Sink>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, const FormatFloat<float>& value){
+        print_float(stream, value);
+        return stream;
+    }
+
+    template<class Sink>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, const FormatFloat<double>& value){
+        print_float(stream, value);
+        return stream;
+    }
+
+    template<class Sink, std::floating_point Float>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, Float value){
+        return stream << FormatFloat(value);
+    }
+
+    template<class Sink, std::unsigned_integral UInt>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, FormatHex<UInt> hex){
+        print_hex(stream, hex);
+        return stream;
+    }
+
+    template<class Sink, class T>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, const T* ptr){
+        return stream << FormatHex(reinterpret_cast<std::uintptr_t>(ptr));
+    }
+
+    template<class Sink>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, [[maybe_unused]]std::nullptr_t ptr){
+        return stream << "nullptr";
+    }
+
+    template<class Sink, class Rep, class Period>
+    inline StaticOStream<Sink>& operator<<(StaticOStream<Sink>& stream, std::chrono::duration<Rep, Period> duration){
+        return stream << format_chrono(duration);
+    }
+
+    /**
+     * \brief `fiber::format()` for a `StaticOStream`, the fields are written with direct calls of the sink
+     * \returns the stream
+     */
+    template<FormatString Fmt, class Sink, class... Args>
+    StaticOStream<Sink>& format(StaticOStream<Sink>& stream, const Args&... args){
+        detail::format_to<Fmt>(stream, args...);
+        return stream;
+    }
+
+} // namespace fiber
@@ -0,0 +1,269 @@
+#include "OStream_benchmark.hpp"
+
+// std
+#include <cstdio>
+#include <string_view>
+
+// fiber
+#include <fiber/OStream/OStream.hpp>
+#include <fiber/OStream/ArrayListOStream.hpp>
+#include <fiber/OStream/BufferedOStream.hpp>
+#include <fiber/OStream/BinaryLog.hpp>
+#include <fiber/OStream/format.hpp>
+#include <fiber/OStream/SpanOStream.hpp>
+#include <fiber/OStream/StaticOStream.hpp>
+#include <fiber/BenchmarkFramework/BenchmarkFramework.hpp>
+
+namespace fiber
+{
+    static constexpr uint64_t iterations = 10'000;
+
+    /// a stream that only implements the mandatory methods, so every character is a virtual call
+    class CharOStream : public OStream{
+    public:
+        char last = 0;
+        void put(char c) final {this->last = c; fiber::do_not_optimize(this->last);}
+        void flush() final {}
+    };
+
+    class BlockOStream : public BufferedOStream<256>{
+    protected:
+        size_t sink(const char* data, size_t len) final {
+            fiber::do_not_optimize(data);
+            return len;
+        }
+    };
+
+    /// a table row like the ones of `Scheduler::print()`
+    static void print_row(OStream& stream, int i){
+        stream << "  " << FormatStr("task_name").mwidth(16).left() << " | " << FormatInt(i).mwidth(8) << " | " << FormatInt(i * 1000).mwidth(10) << fiber::newl;
+    }
+
+    static void table_benchmark(){
+        CharOStream char_stream;
+        fiber::benchmark("OStream per character table row", iterations, [&char_stream](){
+            for(int i = 0; i < 8; ++i) print_row(char_stream, i);
+            char_stream.flush();
+        });
+
+        BlockOStream block_stream;
+        fiber::benchmark("BufferedOStream table row", iterations, [&block_stream](){
+            for(int i = 0; i < 8; ++i) print_row(block_stream, i);
+            block_stream.flush();
+        });
+    }
+
+    static void padding_benchmark(){
+        CharOStream char_stream;
+        OStream& stream = char_stream;
+        fiber::benchmark("OStream per character padding 200", iterations, [&stream](){
+            stream.put(' ', 200);
+        });
+
+        BlockOStream block_stream;
+        fiber::benchmark("BufferedOStream padding 200", iterations, [&block_stream](){
+            block_stream.put(' ', 200);
+            block_stream.flush();
+        });
+    }
+
+    /// the previous conversion with one division per digit, as a baseline
+    template<class UInt>
+    static std::string_view digit_wise_uint_to_string(char* buffer_last, UInt value){
+        char* itr = buffer_last;
+        do{
+            *--itr = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }while(value != 0);
+        return std::string_view(itr, buffer_last);
+    }
+
+    static void uint_to_string_benchmark(){
+        // values with one to ten digits
+        static constexpr uint32_t values32[] = {7u, 42u, 365u, 4096u, 65535u, 123456u, 9999999u, 16777216u, 987654321u, 4294967295u};
+        static constexpr uint64_t values64[] = {7ull, 4294967296ull, 1234567890123ull, 18446744073709551615ull};
+        char buffer[32];
+        size_t size = 0;
+
+        fiber::benchmark("digit wise uint32 to string", iterations, [&](){
+            for(uint32_t value : values32) size += digit_wise_uint_to_string(&buffer[32], value).size();
+            fiber::do_not_optimize(size);
+        });
+        fiber::benchmark("fiber::uint_to_string uint32", iterations, [&](){
+            for(uint32_t value : values32) size += fiber::uint_to_string(&buffer[0], &buffer[32], value).size();
+            fiber::do_not_optimize(size);
+        });
+        fiber::benchmark("fiber::uint_to_string uint32 thousands", iterations, [&](){
+            for(uint32_t value : values32) size += fiber::uint_to_string(&buffer[0], &buffer[32], value, true).size();
+            fiber::do_not_optimize(size);
+        });
+        fiber::benchmark("snprintf uint32", iterations, [&](){
+            for(uint32_t value : values32) size += static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%lu", static_cast<unsigned long>(value)));
+            fiber::do_not_optimize(size);
+        });
+
+        fiber::benchmark("digit wise uint64 to string", iterations, [&](){
+            for(uint64_t value : values64) size += digit_wise_uint_to_string(&buffer[32], value).size();
+            fiber::do_not_optimize(size);
+        });
+        fiber::benchmark("fiber::uint_to_string uint64", iterations, [&](){
+            for(uint64_t value : values64) size += fiber::uint_to_string(&buffer[0], &buffer[32], value).size();
+            fiber::do_not_optimize(size);
+        });
+        fiber::benchmark("snprintf uint64", iterations, [&](){
+            for(uint64_t value : values64) size += static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value)));
+            fiber::do_not_optimize(size);
+        });
+    }
+
+    static void float_benchmark(){
+        static constexpr float floats[] = {3.536f, 42.0f, 23165546.0f, 6.02214e23f, 299792.458f, 1.5f, -7.25f, 0.001234f};
+        static constexpr double doubles[] = {3.536, 42.0, 23165546.231564, 6.02214076e23, 299792.458, 1.5, -7.25, 0.001234};
+        BlockOStream stream;
+
+        fiber::benchmark("FormatFloat float", iterations, [&stream](){
+            for(float value : floats) stream << value;
+            stream.flush();
+        });
+        fiber::benchmark("FormatFloat double", iterations, [&stream](){
+            for(double value : doubles) stream << value;
+            stream.flush();
+        });
+        fiber::benchmark("FormatFloat float full", iterations, [&stream](){
+            for(float value : floats) stream << FormatFloat(value).full();
+            stream.flush();
+        });
+        fiber::benchmark("FormatFloat double shortest", iterations, [&stream](){
+            for(double value : doubles) stream << FormatFloat(value).shortest();
+            stream.flush();
+        });
+    }
+
+    static void format_benchmark(){
+        BlockOStream stream;
+
+        fiber::benchmark("table row with Format* builders", iterations, [&stream](){
+            for(int i = 0; i < 8; ++i){
+                stream << "  " << FormatStr("task_name").mwidth(16).left() << " | " << FormatInt(i).mwidth(8) << " | "
+                    << FormatFloat(i * 1.25f).sci().decimals(3).fdeci() << fiber::newl;
+            }
+            stream.flush();
+        });
+        fiber::benchmark("table row with fiber::format", iterations, [&stream](){
+            for(int i = 0; i < 8; ++i){
+                fiber::format<"  {:<16} | {:>8} | {:.3e}\n">(stream, "task_name", i, i * 1.25f);
+            }
+            stream.flush();
+        });
+        fiber::benchmark("table row with fiber::binlog", iterations, [&stream](){
+            for(int i = 0; i < 8; ++i){
+                fiber::binlog<"  {:<16} | {:>8} | {:.3e}\n">(stream, "task_name", i, i * 1.25f);
+            }
+            stream.flush();
+        });
+    }
+
+    /// a stream into RAM that only implements the mandatory methods, like before `SpanOStream`
+    class PutOnlyRamOStream : public OStream{
+    public:
+        char buffer[128];
+        size_t size = 0;
+        void put(char c) final {if(this->size < sizeof(this->buffer)) this->buffer[this->size++] = c;}
+        void flush() final {}
+    };
+
+    /// a packet record like a telemetry line
+    static void print_record(OStream& stream, int i){
+        stream << "id=" << FormatInt(i).mwidth(6) << " name=" << FormatStr("sensor_name").mwidth(16).left()
+            << " state=" << "running" << fiber::newl;
+    }
+
+    static void memory_sink_benchmark(){
+        // every iteration formats one record into a packet buffer, so each benchmark formats 10k records
+        PutOnlyRamOStream put_stream;
+        fiber::benchmark("record into put-only RAM OStream", iterations, [&put_stream](){
+            put_stream.size = 0;
+            print_record(put_stream, 4711);
+            fiber::do_not_optimize(put_stream.buffer);
+        });
+
+        char buffer[128];
+        SpanOStream span_stream(buffer);
+        fiber::benchmark("record into SpanOStream", iterations, [&span_stream, &buffer](){
+            span_stream.clear();
+            print_record(span_stream, 4711);
+            fiber::do_not_optimize(buffer);
+        });
+
+        ArrayList<char, 128> list;
+        ArrayListOStream list_stream(list);
+        fiber::benchmark("record into ArrayListOStream", iterations, [&list_stream, &list](){
+            list.clear();
+            print_record(list_stream, 4711);
+            fiber::do_not_optimize(list);
+        });
+    }
+
+    /// the sink of the static stream benchmarks, copies the characters into a packet buffer
+    struct PacketSink{
+        char buffer[128];
+        size_t size = 0;
+
+        void write(const char* str, size_t len){
+            for(size_t i = 0; i < len && this->size < sizeof(this->buffer); ++i) this->buffer[this->size++] = str[i];
+        }
+    };
+
+    /**
+     * The same record through the virtual interface and through the static type of the stream.
+     * Not inlined, so that their code size can be compared with:
+     * `nm --print-size --size-sort --demangle bench_runner | grep print_record_`
+     */
+    [[gnu::noinline]] static void print_record_virtual(OStream& stream, int i){
+        stream << "id=" << FormatInt(i).mwidth(6) << " name=" << FormatStr("sensor_name").mwidth(16).left()
+            << " state=" << "running" << fiber::newl;
+    }
+
+    [[gnu::noinline]] static void print_record_static(StaticOStream<PacketSink>& stream, int i){
+        stream << "id=" << FormatInt(i).mwidth(6) << " name=" << FormatStr("sensor_name").mwidth(16).left()
+            << " state=" << "running" << fiber::newl;
+    }
+
+    static void static_ostream_benchmark(){
+        // every iteration formats one record into a packet buffer, like `memory_sink_benchmark()`
+        StaticOStream<PacketSink> stream;
+        fiber::benchmark("record into StaticOStream as OStream&", iterations, [&stream](){
+            stream.sink().size = 0;
+            print_record_virtual(stream, 4711);
+            fiber::do_not_optimize(stream.sink().buffer);
+        });
+        fiber::benchmark("record into StaticOStream", iterations, [&stream](){
+            stream.sink().size = 0;
+            print_record_static(stream, 4711);
+            fiber::do_not_optimize(stream.sink().buffer);
+        });
+
+        fiber::benchmark("fiber::format into StaticOStream as OStream&", iterations, [&stream](){
+            stream.sink().size = 0;
+            fiber::format<"id={:>6} name={:<16} state={}\n">(static_cast<OStream&>(stream), 4711, "sensor_name", "running");
+            fiber::do_not_optimize(stream.sink().buffer);
+        });
+        fiber::benchmark("fiber::format into StaticOStream", iterations, [&stream](){
+            stream.sink().size = 0;
+            fiber::format<"id={:>6} name={:<16} state={}\n">(stream, 4711, "sensor_name", "running");
+            fiber::do_not_optimize(stream.sink().buffer);
+        });
+    }
+
+    void OStream_benchmark(){
+        BENCHMARK_GROUP;
+
+        table_benchmark();
+        padding_benchmark();
+        uint_to_string_benchmark();
+        float_benchmark();
+        format_benchmark();
+        memory_sink_benchmark();
+        static_ostream_benchmark();
+    }
+} // namespace fiber
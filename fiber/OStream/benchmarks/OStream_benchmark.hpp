@@ -0,0 +1,9 @@
+#pragma once
+
+namespace fiber
+{
+    /**
+     * @brief Benchmarks formatting into an `OStream` that only implements `put(char)` against a `BufferedOStream`
+     */
+    void OStream_benchmark();
+} // namespace fiber
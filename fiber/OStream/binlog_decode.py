@@ -0,0 +1,154 @@
+"""
+Decodes the binary log records of `fiber::binlog()` into text.
+
+The format strings are read from the `fiber_log` section of the ELF file that wrote the records.
+
+Usage:
+    python binlog_decode.py firmware.elf capture.bin
+    python binlog_decode.py firmware.elf < capture.bin
+
+Record layout:  size (1 byte) | id (4 bytes, little endian) | arguments (little endian)
+Dictionary:     0xA5 | id (4 bytes) | number of arguments | type codes | format string | 0
+"""
+
+import string
+import struct
+import sys
+
+ENTRY_MAGIC = 0xA5
+
+
+def read_section(elf, name):
+    """returns the content of an ELF section"""
+    if elf[:4] != b"\x7fELF":
+        raise ValueError("not an ELF file")
+    is_64 = elf[4] == 2
+    endian = "<" if elf[5] == 1 else ">"
+
+    if is_64:
+        shoff, = struct.unpack_from(endian + "Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x3A)
+        header = endian + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(endian + "I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x2E)
+        header = endian + "IIIIIIIIII"
+
+    sections = [struct.unpack_from(header, elf, shoff + i * shentsize) for i in range(shnum)]
+    names_offset = sections[shstrndx][4]
+    for section in sections:
+        name_offset, offset, size = section[0], section[4], section[5]
+        end = elf.index(b"\0", names_offset + name_offset)
+        if elf[names_offset + name_offset:end].decode() == name:
+            return elf[offset:offset + size]
+    raise ValueError(f"the ELF file has no section '{name}', was fiber::binlog() used?")
+
+
+def read_dictionary(section):
+    """returns {id: (type codes, format string)}, entries are padded with zeros"""
+    dictionary = {}
+    i = 0
+    while i < len(section):
+        if section[i] == 0:
+            i += 1
+            continue
+        if section[i] != ENTRY_MAGIC:
+            raise ValueError(f"invalid dictionary entry at offset {i}")
+        entry_id, n_args = struct.unpack_from("<IB", section, i + 1)
+        codes = section[i + 6:i + 6 + n_args].decode()
+        end = section.index(b"\0", i + 6 + n_args)
+        fmt = section[i + 6 + n_args:end].decode()
+        if entry_id in dictionary and dictionary[entry_id] != (codes, fmt):
+            print(f"warning: id 0x{entry_id:08x} is used by '{fmt}' and '{dictionary[entry_id][1]}'", file=sys.stderr)
+        dictionary[entry_id] = (codes, fmt)
+        i = end + 1
+    return dictionary
+
+
+class Float32(float):
+    """marks values that were a `float` on the target"""
+
+
+def shortest_float32(value):
+    """the shortest digits that read back as the same 32-bit float"""
+    for precision in range(1, 10):
+        text = f"{value:.{precision}g}"
+        if struct.unpack("<f", struct.pack("<f", float(text)))[0] == value:
+            return text
+    return repr(value)
+
+
+def right_aligned(spec):
+    """fiber aligns all fields right by default, Python aligns text left"""
+    has_align = spec[:1] in ("<", ">", "^") or spec[1:2] in ("<", ">", "^")
+    return spec if has_align or spec.startswith("0") else ">" + spec
+
+
+class Formatter(string.Formatter):
+    """renders the `fiber::format()` syntax with the Python format mini language"""
+
+    def format_field(self, value, spec):
+        spec = right_aligned(spec) if spec else spec
+        if isinstance(value, bool):
+            return format(int(value) if spec.endswith("d") else ("true" if value else "false"), spec)
+        if isinstance(value, float) and "." not in spec:
+            # no precision: shortest digits that read back as the same value
+            text = shortest_float32(value) if isinstance(value, Float32) else repr(value)
+            return format(text, spec.rstrip("efg").replace("+", "").replace(",", "") or "")
+        return format(value, spec)
+
+
+def decode_arguments(codes, payload):
+    args = []
+    i = 0
+    for code in codes:
+        if code == "s":
+            length = payload[i]
+            args.append(payload[i + 1:i + 1 + length].decode(errors="replace"))
+            i += 1 + length
+        elif code == "c":
+            args.append(payload[i:i + 1].decode(errors="replace"))
+            i += 1
+        else:
+            value, = struct.unpack_from("<" + code, payload, i)
+            args.append(Float32(value) if code == "f" else value)
+            i += struct.calcsize("<" + code)
+    return args
+
+
+def decode(dictionary, records):
+    """yields the text of each record"""
+    formatter = Formatter()
+    i = 0
+    while i < len(records):
+        size = records[i]
+        record = records[i + 1:i + 1 + size]
+        i += 1 + size
+        if len(record) < 4:
+            yield "<incomplete record>"
+            break
+        record_id, = struct.unpack_from("<I", record)
+        if record_id not in dictionary:
+            yield f"<unknown id 0x{record_id:08x}>"
+            continue
+        codes, fmt = dictionary[record_id]
+        yield formatter.format(fmt, *decode_arguments(codes, record[4:]))
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        print(__doc__, file=sys.stderr)
+        sys.exit(1)
+    with open(sys.argv[1], "rb") as file:
+        dictionary = read_dictionary(read_section(file.read(), "fiber_log"))
+    if len(sys.argv) == 3:
+        with open(sys.argv[2], "rb") as file:
+            records = file.read()
+    else:
+        records = sys.stdin.buffer.read()
+    for line in decode(dictionary, records):
+        sys.stdout.write(line if line.endswith("\n") else line + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,330 @@
+#pragma once
+
+// std
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// fiber
+#include <fiber/OStream/OStream.hpp>
+
+namespace fiber{
+
+    /**
+     * \brief A string literal that can be passed as a template parameter, see `fiber::format()`
+     */
+    template<size_t N>
+    struct FormatString{
+        char _str[N];
+
+        consteval FormatString(const char (&str)[N]){
+            for(size_t i = 0; i < N; ++i) this->_str[i] = str[i];
+        }
+
+        /// @brief returns the number of characters without the terminating zero
+        constexpr size_t size() const {return N - 1;}
+    };
+
+    namespace detail{
+
+        /// a replacement field `{[index][:[[fill]align][sign][0][width][,][.precision][type]]}`
+        struct FormatSpec{
+            size_t arg_index = 0;
+            char fill = ' ';
+            char align = 0; // '<', '>', '^' or 0 for the default of the argument type
+            bool force_sign = false;
+            bool zero_pad = false;
+            bool thousands = false;
+            int width = 0;
+            int precision = -1; // -1 if not set
+            char type = 0;      // 0 if not set
+        };
+
+        /// either literal text `[first, first + length)` of the format string or a replacement field
+        struct FormatSegment{
+            bool is_field = false;
+            size_t first = 0;
+            size_t length = 0;
+            FormatSpec spec{};
+        };
+
+        /// not `constexpr` on purpose: calling it while parsing a format string at compile time makes the compiler report an error
+        void format_string_error(const char* message);
+
+        constexpr bool is_digit(char c){return '0' <= c && c <= '9';}
+        constexpr bool is_align(char c){return c == '<' || c == '>' || c == '^';}
+
+        consteval int parse_number(const char* str, size_t& i){
+            int n = 0;
+            for(; is_digit(str[i]); ++i) n = n * 10 + (str[i] - '0');
+            return n;
+        }
+
+        /// parses the part of a replacement field after the ':', `str` is zero terminated
+        consteval void parse_spec(const char* str, size_t& i, FormatSpec& spec){
+            if(str[i] != '\0' && str[i] != '}' && is_align(str[i + 1])){
+                spec.fill = str[i];
+                spec.align = str[i + 1];
+                i += 2;
+            }else if(is_align(str[i])){
+                spec.align = str[i++];
+            }
+
+            if(str[i] == '+'){
+                spec.force_sign = true;
+                ++i;
+            }else if(str[i] == '-'){
+                ++i;
+            }
+
+            if(str[i] == '0'){
+                spec.zero_pad = true;
+                ++i;
+            }
+
+            spec.width = parse_number(str, i);
+
+            if(str[i] == ','){
+                spec.thousands = true;
+                ++i;
+            }
+
+            if(str[i] == '.'){
+                ++i;
+                if(!is_digit(str[i])) format_string_error("missing precision after '.'");
+                spec.precision = parse_number(str, i);
+            }
+
+            if(str[i] != '}' && str[i] != '\0') spec.type = str[i++];
+        }
+
+        /**
+         * Splits a zero terminated format string into literal text and replacement fields.
+         * Writes the segments to `out` if it is not `nullptr` and returns their number.
+         * `n_args_out` receives the number of arguments that the fields refer to.
+         */
+        consteval size_t parse_format(const char* str, size_t size, FormatSegment* out, size_t& n_args_out){
+            size_t n = 0;
+            size_t literal_first = 0;
+            size_t next_arg = 0;
+            bool automatic_index = false;
+            bool manual_index = false;
+            n_args_out = 0;
+
+            auto add_literal = [&](size_t last){
+                if(last > literal_first){
+                    if(out != nullptr) out[n] = FormatSegment{false, literal_first, last - literal_first, {}};
+                    ++n;
+                }
+            };
+
+            size_t i = 0;
+            while(i < size){
+                if(str[i] == '{' && str[i + 1] == '{'){
+                    // escaped brace: keep the first as text, skip the second
+                    add_literal(i + 1);
+                    i += 2;
+                    literal_first = i;
+                }else if(str[i] == '}' && str[i + 1] == '}'){
+                    add_literal(i + 1);
+                    i += 2;
+                    literal_first = i;
+                }else if(str[i] == '}'){
+                    format_string_error("unmatched '}' in format string, use '}}' to print a brace");
+                    ++i;
+                }else if(str[i] == '{'){
+                    add_literal(i);
+                    ++i;
+
+                    FormatSpec spec;
+                    if(is_digit(str[i])){
+                        manual_index = true;
+                        spec.arg_index = static_cast<size_t>(parse_number(str, i));
+                    }else{
+                        automatic_index = true;
+                        spec.arg_index = next_arg++;
+                    }
+                    if(manual_index && automatic_index) format_string_error("cannot mix automatic and manual argument indices");
+
+                    if(str[i] == ':'){
+                        ++i;
+                        parse_spec(str, i, spec);
+                    }
+                    if(str[i] != '}') format_string_error("missing '}' or invalid format specification");
+                    ++i;
+
+                    if(out != nullptr) out[n] = FormatSegment{true, 0, 0, spec};
+                    ++n;
+                    if(spec.arg_index + 1 > n_args_out) n_args_out = spec.arg_index + 1;
+                    literal_first = i;
+                }else{
+                    ++i;
+                }
+            }
+            add_literal(size);
+            return n;
+        }
+
+        template<FormatString Fmt>
+        consteval size_t count_segments(){
+            size_t n_args = 0;
+            return parse_format(Fmt._str, Fmt.size(), nullptr, n_args);
+        }
+
+        template<FormatString Fmt>
+        struct ParsedFormat{
+            std::array<FormatSegment, count_segments<Fmt>()> segments{};
+            size_t n_args = 0;
+
+            consteval ParsedFormat(){
+                parse_format(Fmt._str, Fmt.size(), this->segments.data(), this->n_args);
+            }
+        };
+
+        /// applies width, fill and alignment that all formatters share
+        template<FormatSpec Spec>
+        constexpr void apply_layout(FormatStrParams& params){
+            params._mwidth = Spec.width;
+            params._fill = Spec.fill;
+            if constexpr (Spec.align == '<'){
+                params._alignment = AlignmentLRC::Left;
+            }else if constexpr (Spec.align == '>'){
+                params._alignment = AlignmentLRC::Right;
+            }else if constexpr (Spec.align == '^'){
+                params._alignment = AlignmentLRC::Center;
+            }else if constexpr (Spec.zero_pad){
+                // zeros go between the sign and the number
+                params._fill = '0';
+                params._alignment = AlignmentLRC::Right;
+            }
+        }
+
+        template<FormatSpec Spec, class Stream, class T>
+        void format_field(Stream& stream, const T& value){
+            if constexpr (std::is_same_v<T, bool>){
+                static_assert(Spec.type == 0 || Spec.type == 's' || Spec.type == 'd', "bool supports the types 's' and 'd'");
+                FormatBool f(value);
+                if constexpr (Spec.type == 'd') f.num(); else f.text();
+                apply_layout<Spec>(f);
+                stream << f;
+            }else if constexpr (std::is_same_v<T, char>){
+                static_assert(Spec.type == 0 || Spec.type == 'c' || Spec.type == 'd', "char supports the types 'c' and 'd'");
+                if constexpr (Spec.type == 'd'){
+                    format_field<Spec>(stream, static_cast<int>(value));
+                }else{
+                    FormatStr f(&value, 1);
+                    apply_layout<Spec>(f);
+                    stream << f;
+                }
+            }else if constexpr (std::is_integral_v<T>){
+                static_assert(Spec.type == 0 || Spec.type == 'd', "integers support the type 'd'");
+                static_assert(Spec.precision < 0, "integers do not support a precision");
+                FormatInt f(value);
+                f.fsign(Spec.force_sign);
+                if constexpr (Spec.thousands) f.thousands(',');
+                f.pad_sign(Spec.zero_pad && Spec.align == 0);
+                apply_layout<Spec>(f);
+                stream << f;
+            }else if constexpr (std::is_floating_point_v<T>){
+                static_assert(Spec.type == 0 || Spec.type == 'e' || Spec.type == 'f' || Spec.type == 'g', "floating point numbers support the types 'e', 'f' and 'g'");
+                FormatFloat f(value);
+                if constexpr (Spec.type == 'e') f.sci();
+                if constexpr (Spec.type == 'f') f.full();
+                if constexpr (Spec.type == 'g') f.eng();
+                if constexpr (Spec.precision >= 0){
+                    f.decimals(Spec.precision);
+                    f.fdeci(Spec.type == 'e' || Spec.type == 'f');
+                }else{
+                    f.shortest();
+                }
+                f.fsign(Spec.force_sign);
+                if constexpr (Spec.thousands) f.thousands(',');
+                f.pad_sign(Spec.zero_pad && Spec.align == 0);
+                apply_layout<Spec>(f);
+                stream << f;
+            }else if constexpr (std::is_convertible_v<const T&, std::string_view>){
+                static_assert(Spec.type == 0 || Spec.type == 's', "strings support the type 's'");
+                const std::string_view str(value);
+                const size_t len = (Spec.precision >= 0 && static_cast<size_t>(Spec.precision) < str.size()) ? static_cast<size_t>(Spec.precision) : str.size();
+                FormatStr f(str.data(), len);
+                apply_layout<Spec>(f);
+                stream << f;
+            }else{
+                static_assert(Spec.width == 0 && Spec.type == 0 && Spec.precision < 0 && !Spec.force_sign && !Spec.zero_pad && !Spec.thousands,
+                    "this type only supports empty replacement fields '{}'");
+                stream << value;
+            }
+        }
+
+        template<FormatString Fmt, FormatSegment Segment, class Stream, class Tuple>
+        void format_segment(Stream& stream, const Tuple& args){
+            if constexpr (Segment.is_field){
+                format_field<Segment.spec>(stream, std::get<Segment.spec.arg_index>(args));
+            }else{
+                stream.write(&Fmt._str[Segment.first], Segment.length);
+            }
+        }
+
+        /// writes all segments of the format string, templated on the stream type so that `StaticOStream` stays devirtualised
+        template<FormatString Fmt, class Stream, class... Args>
+        void format_to(Stream& stream, const Args&... args){
+            static constexpr ParsedFormat<Fmt> parsed{};
+            static_assert(parsed.n_args == sizeof...(Args), "the number of arguments does not match the format string");
+
+            const std::tuple<const Args&...> arg_refs(args...);
+            [&]<size_t... I>(std::index_sequence<I...>){
+                (format_segment<Fmt, parsed.segments[I]>(stream, arg_refs), ...);
+            }(std::make_index_sequence<parsed.segments.size()>());
+        }
+
+    } // namespace detail
+
+    /**
+     * \brief Writes arguments with a format string that is parsed at compile time
+     *
+     * The format string is split into text and replacement fields during compilation.
+     * Each field turns into a direct call of the matching `FormatInt`, `FormatFloat`, `FormatBool` or `FormatStr`
+     * with constant settings, so there is no parsing at runtime. Errors in the format string are compile errors.
+     *
+     * Replacement fields follow `std::format`: `{[index][:[[fill]align][sign][0][width][,][.precision][type]]}`
+     * - `index`: the argument to print, either all fields have one or none
+     * - `align`: `<` left, `>` right, `^` center. Default is right, like the `Format*` types.
+     * - `sign`: `+` always prints the sign
+     * - `0`: pads with zeros between the sign and the number
+     * - `,`: uses ',' as thousands separator
+     * - `precision`: decimals of floating point numbers, maximal length of strings
+     * - `type`: `d` integers and bools as numbers, `e` scientific, `f` full and `g` engineering representation,
+     *   `s` strings and bools as text, `c` characters
+     *
+     * Floating point numbers without precision print the shortest digits that read back as the same value.
+     * With a precision and `e` or `f` all decimals are printed, like `printf`.
+     * Use `{{` and `}}` to print braces. Other types only support `{}` and use their `operator<<`.
+     *
+     * With `FIBER_FMT_MINIMAL` only width, fill and alignment apply, the rest follows the compile definitions.
+     *
+     * Example:
+     * ```C++
+     * fiber::format<"{:>6} {:.3e}\n">(fiber::cout, 42, 1234.56); // Outputs "    42 1.235e3"
+     * fiber::format<"[{:<8}] {:+,}">(stream, "motor", 1200000);  // Outputs "[motor   ] +1,200,000"
+     * ```
+     *
+     * \returns the stream
+     */
+    template<FormatString Fmt, class... Args>
+    OStream& format(OStream& stream, const Args&... args){
+        detail::format_to<Fmt>(stream, args...);
+        return stream;
+    }
+
+    /// \brief Writes arguments with a format string to a stream reference like `fiber::cout`, see `format(OStream&, const Args&...)`
+    template<FormatString Fmt, class... Args>
+    OStream& format(OStreamRef stream, const Args&... args){
+        FIBER_ASSERT_O1_MSG(stream.is_open(), "No output stream! S: Assign an output stream to `fiber::cout`, `fiber::cerr` or `fiber::clog`.");
+        return format<Fmt>(*(stream.ptr), args...);
+    }
+
+} // namespace fiber
@@ -1,13 +1,34 @@
 target_sources(fiber
     PUBLIC
         ${CMAKE_CURRENT_LIST_DIR}/ansi.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/ArrayListOStream.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/AsyncOStream.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/BinaryLog.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/BufferedOStream.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/format.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/JsonWriter.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/LogBuffer.hpp
         ${CMAKE_CURRENT_LIST_DIR}/OStream.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/SpanOStream.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/StaticOStream.hpp
     PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/AsyncOStream.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/BinaryLog.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/BufferedOStream.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/JsonWriter.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/LogBuffer.cpp
         ${CMAKE_CURRENT_LIST_DIR}/OStream.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/SpanOStream.cpp
 )
 
 if(FIBER_COMPILE_TESTS)
 
     include(${CMAKE_CURRENT_LIST_DIR}/tests/sources.cmake)
 
+endif()
+
+if(FIBER_COMPILE_BENCHMARKS)
+
+    include(${CMAKE_CURRENT_LIST_DIR}/benchmarks/sources.cmake)
+
 endif()
\ No newline at end of file
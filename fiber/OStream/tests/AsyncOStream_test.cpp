@@ -0,0 +1,196 @@
+#include "AsyncOStream_test.hpp"
+
+// std
+#include <string_view>
+#include <utility>
+
+// fiber
+#include <fiber/OStream/AsyncOStream.hpp>
+#include <fiber/OS/Coroutine.hpp>
+#include <fiber/Memory/StackAllocator.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        /// keeps the promise of a transmission until the test completes it, like a DMA interrupt
+        template<size_t N>
+        class MockUart : public AsyncOStream<N>{
+        public:
+            char output[256];
+            size_t output_size = 0;
+            int n_transmits = 0;
+            bool complete_immediately = false;
+
+            const char* tx_data = nullptr;
+            size_t tx_len = 0;
+            Promise<size_t> tx_promise;
+
+            ~MockUart(){
+                this->complete_immediately = true;
+                this->flush();
+            }
+
+            std::string_view str() const {return std::string_view(this->output, this->output_size);}
+
+            /// completes the running transmission with at most `max` characters
+            void complete(size_t max = 1000){
+                const size_t n = (this->tx_len < max) ? this->tx_len : max;
+                for(size_t i = 0; i < n; ++i) this->output[this->output_size++] = this->tx_data[i];
+                this->tx_len = 0;
+                this->tx_promise.set_value(n);
+            }
+
+        protected:
+            Future<size_t> transmit(const char* data, size_t len) final {
+                ++this->n_transmits;
+                auto [future, promise] = fiber::make_future_promise<size_t>();
+                this->tx_data = data;
+                this->tx_len = len;
+                this->tx_promise = std::move(promise);
+                if(this->complete_immediately) this->complete();
+                return std::move(future);
+            }
+        };
+    }
+
+    static fiber::TestResult AsyncOStream_test_transmit(){
+        TEST_START;
+
+        MockUart<16> uart;
+        uart << "Hello";
+        TEST_FALSE(uart.is_transmitting());
+        TEST_EQUAL(uart.n_transmits, 0);
+
+        // the characters stay buffered until the transmission completed
+        uart.poll();
+        TEST_TRUE(uart.is_transmitting());
+        TEST_TRUE(std::string_view(uart.tx_data, uart.tx_len) == "Hello");
+        TEST_EQUAL(uart.size(), 5);
+
+        uart << " World";
+        uart.poll();
+        TEST_EQUAL(uart.n_transmits, 1);
+
+        // partial transmission, the rest follows in the next block
+        uart.complete(3);
+        uart.poll();
+        TEST_EQUAL(uart.size(), 8);
+        TEST_TRUE(uart.is_transmitting());
+        TEST_TRUE(std::string_view(uart.tx_data, uart.tx_len) == "lo World");
+
+        uart.complete();
+        uart.poll();
+        TEST_FALSE(uart.is_transmitting());
+        TEST_TRUE(uart.empty());
+        TEST_TRUE(uart.str() == "Hello World");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult AsyncOStream_test_broken_promise(){
+        TEST_START;
+
+        MockUart<16> uart;
+        uart << "abc";
+        uart.poll();
+        TEST_EQUAL(uart.n_transmits, 1);
+
+        // the driver dropped the transmission: the next poll sends the block again
+        uart.tx_promise = Promise<size_t>();
+        uart.poll();
+        TEST_FALSE(uart.is_transmitting());
+        uart.poll();
+        TEST_EQUAL(uart.n_transmits, 2);
+        TEST_EQUAL(uart.size(), 3);
+
+        uart.complete();
+        uart.poll();
+        TEST_TRUE(uart.empty());
+        TEST_TRUE(uart.str() == "abc");
+
+        // blocking interface with a driver that completes immediately
+        uart.complete_immediately = true;
+        uart << "0123456789" << "0123456789" << fiber::endl;
+        TEST_TRUE(uart.empty());
+        TEST_TRUE(uart.str() == "abc01234567890123456789\n");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult AsyncOStream_test_awaitables(){
+        TEST_START;
+
+        fiber::StackAllocator<512> allocator;
+        fiber::detail::frame_allocator = &allocator;
+
+        class Task : public fiber::TaskBase{
+            public:
+            MockUart<16>& uart;
+            int step = 0;
+
+            Task(fiber::StackAllocatorExtern* allocator, MockUart<16>& uart) : fiber::TaskBase("Async Print", allocator, Task::main, this), uart(uart){}
+
+            static fiber::Coroutine<fiber::Exit> main(Task* This){
+                co_await This->uart.write_async(std::string_view("0123456789abcdefghijklmnopqrstuvwxyz"));
+                This->step = 1;
+                co_await This->uart.wait_available(12);
+                This->uart << "[12 chars!]" << fiber::newl;
+                This->step = 2;
+                co_await This->uart.flush_async();
+                This->step = 3;
+                co_return fiber::Exit::Success;
+            }
+        };
+
+        {
+            MockUart<16> uart;
+            Task task(&allocator, uart);
+
+            // the text does not fit: the task suspends instead of blocking
+            task.resume();
+            TEST_TRUE(task.is_awaiting());
+            TEST_EQUAL(task.step, 0);
+            TEST_EQUAL(uart.size(), 16);
+
+            // each completed transmission makes room, the scheduler polls the awaitable
+            int n_completions = 0;
+            while(task.is_awaiting()){
+                uart.complete(10);
+                ++n_completions;
+            }
+            TEST_TRUE(n_completions >= 2);
+            task.resume();
+            TEST_EQUAL(task.step, 1);
+
+            while(task.is_awaiting()) uart.complete(4);
+            TEST_TRUE(uart.available() >= 12);
+            task.resume();
+            TEST_EQUAL(task.step, 2);
+
+            TEST_TRUE(task.is_awaiting());
+            while(task.is_awaiting()) uart.complete();
+            task.resume();
+            TEST_EQUAL(task.step, 3);
+            TEST_TRUE(task.is_done());
+            TEST_TRUE(uart.empty());
+            TEST_TRUE(uart.str() == "0123456789abcdefghijklmnopqrstuvwxyz[12 chars!]\n");
+
+            task.destroy();
+        }
+        TEST_TRUE(allocator.empty());
+
+        TEST_END;
+    }
+
+    fiber::TestResult AsyncOStream_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | AsyncOStream_test_transmit
+            | AsyncOStream_test_broken_promise
+            | AsyncOStream_test_awaitables
+            ;
+    }
+} // namespace fiber
@@ -0,0 +1,144 @@
+#include "BinaryLog_test.hpp"
+
+// std
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+// fiber
+#include <fiber/OStream/BinaryLog.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        struct Recorder : public OStream{
+            char output[512];
+            size_t size = 0;
+            size_t writes = 0;
+            void put(char c) final {this->output[this->size++] = c;}
+            void write(const char* str, size_t len) final {
+                std::memcpy(this->output + this->size, str, len);
+                this->size += len;
+                ++this->writes;
+            }
+            void flush() final {}
+            const uint8_t* bytes() const {return reinterpret_cast<const uint8_t*>(this->output);}
+        };
+
+        uint32_t read_u32(const uint8_t* bytes){
+            return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8)
+                | (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+        }
+    }
+
+    static fiber::TestResult BinaryLog_record_test(){
+        TEST_START;
+
+        Recorder r;
+        fiber::binlog<"x={} y={} ok={}">(r, int16_t(-2), 0x12345678u, true);
+
+        using Entry = detail::BinlogEntry<"x={} y={} ok={}", 'h', 'I', '?'>;
+        TEST_EQUAL(r.writes, 1);
+        TEST_EQUAL(r.size, 1 + 4 + 2 + 4 + 1);
+        TEST_EQUAL(r.bytes()[0], r.size - 1);
+        TEST_EQUAL(read_u32(r.bytes() + 1), Entry::id);
+        TEST_EQUAL(r.bytes()[5], 0xFE);
+        TEST_EQUAL(r.bytes()[6], 0xFF);
+        TEST_EQUAL(read_u32(r.bytes() + 7), 0x12345678u);
+        TEST_EQUAL(r.bytes()[11], 1);
+
+        r.size = 0;
+        fiber::binlog<"{} {}">(r, 1.5f, 2.0L);
+        float f;
+        double d;
+        std::memcpy(&f, r.output + 5, sizeof(f));
+        std::memcpy(&d, r.output + 9, sizeof(d));
+        TEST_EQUAL(r.size, 1 + 4 + 4 + 8);
+        TEST_TRUE(f == 1.5f);
+        TEST_TRUE(d == 2.0);
+
+        // the id depends on the argument types
+        TEST_TRUE((detail::BinlogEntry<"{}", 'i'>::id != detail::BinlogEntry<"{}", 'f'>::id));
+
+        TEST_END;
+    }
+
+    static fiber::TestResult BinaryLog_string_test(){
+        TEST_START;
+
+        Recorder r;
+        fiber::binlog<"{}: {}">(r, "motor", 'c');
+        TEST_EQUAL(r.size, 1 + 4 + 1 + 5 + 1);
+        TEST_EQUAL(r.bytes()[5], 5);
+        TEST_TRUE(std::string_view(r.output + 6, 5) == "motor");
+        TEST_EQUAL(r.output[11], 'c');
+
+        // long strings are cut so that the record and the following arguments fit
+        char long_str[300];
+        std::memset(long_str, 'a', sizeof(long_str));
+        r.size = 0;
+        fiber::binlog<"{}{}">(r, std::string_view(long_str, sizeof(long_str)), uint32_t(7));
+        TEST_EQUAL(r.size, detail::binlog_max_record);
+        TEST_EQUAL(r.bytes()[0], 255);
+        TEST_EQUAL(r.bytes()[5], 256 - 1 - 4 - 1 - 4);
+        TEST_EQUAL(read_u32(r.bytes() + r.size - 4), 7);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult BinaryLog_dictionary_test(){
+        TEST_START;
+
+        using Entry = detail::BinlogEntry<"temp {:.1f} C", 'd'>;
+        Recorder r;
+        fiber::binlog<"temp {:.1f} C">(r, 21.5);
+        TEST_EQUAL(read_u32(r.bytes() + 1), Entry::id);
+
+        const uint8_t* entry = reinterpret_cast<const uint8_t*>(Entry::bytes.data());
+        TEST_EQUAL(Entry::bytes.size(), 6 + 1 + 14);
+        TEST_EQUAL(entry[0], 0xA5);
+        TEST_EQUAL(read_u32(entry + 1), Entry::id);
+        TEST_EQUAL(entry[5], 1);
+        TEST_EQUAL(entry[6], 'd');
+        TEST_TRUE(std::string_view(Entry::bytes.data() + 7, Entry::bytes.size() - 8) == "temp {:.1f} C");
+        TEST_EQUAL(Entry::bytes.back(), '\0');
+
+        // the words store the bytes in order, padded with zeros
+        char words[sizeof(Entry::words)];
+        std::memcpy(words, Entry::words.data(), sizeof(words));
+        TEST_TRUE(std::memcmp(words, Entry::bytes.data(), Entry::bytes.size()) == 0);
+        TEST_EQUAL(words[Entry::bytes.size()], 0);
+        TEST_EQUAL(Entry::n_words, 6);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult BinaryLog_default_stream_test(){
+        TEST_START;
+
+        Recorder r;
+        const OStreamRef previous = fiber::blog;
+        fiber::blog = r;
+        fiber::binlog<"no arguments">();
+        fiber::blog = previous;
+
+        TEST_EQUAL(r.size, 5);
+        TEST_EQUAL(r.bytes()[0], 4);
+        TEST_EQUAL(read_u32(r.bytes() + 1), (detail::BinlogEntry<"no arguments">::id));
+
+        TEST_END;
+    }
+
+    fiber::TestResult BinaryLog_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | BinaryLog_record_test
+            | BinaryLog_string_test
+            | BinaryLog_dictionary_test
+            | BinaryLog_default_stream_test
+            ;
+    }
+} // namespace fiber
@@ -0,0 +1,178 @@
+#include "BufferedOStream_test.hpp"
+
+// std
+#include <string_view>
+
+// fiber
+#include <fiber/OStream/BufferedOStream.hpp>
+#include <fiber/OS/Scheduler.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        /// records everything that reaches the sink and how often the sink was called
+        template<size_t N>
+        class RecordingStream : public BufferedOStream<N>{
+        public:
+            char output[4096];
+            size_t output_size = 0;
+            int n_sink_calls = 0;
+            size_t max_take = sizeof(output); // simulates a sink that can not take everything at once
+
+            ~RecordingStream(){this->flush();}
+
+            std::string_view str() const {return std::string_view(this->output, this->output_size);}
+
+        protected:
+            size_t sink(const char* data, size_t len) final {
+                ++this->n_sink_calls;
+                size_t n = (len < this->max_take) ? len : this->max_take;
+                n = (n < sizeof(this->output) - this->output_size) ? n : sizeof(this->output) - this->output_size;
+                for(size_t i = 0; i < n; ++i){this->output[this->output_size++] = data[i];}
+                return n;
+            }
+        };
+
+        TimePoint g_mock_time(0);
+        TimePoint get_time(){return g_mock_time;}
+    }
+
+    static fiber::TestResult BufferedOStream_test_buffering(){
+        TEST_START;
+
+        RecordingStream<16> stream;
+        TEST_EQUAL(stream.capacity(), 16);
+        TEST_TRUE(stream.empty());
+
+        stream << "Hello";
+        stream.put(' ');
+        stream << 42;
+        TEST_EQUAL(stream.size(), 8);
+        TEST_EQUAL(stream.n_sink_calls, 0);
+
+        stream.flush();
+        TEST_EQUAL(stream.n_sink_calls, 1);
+        TEST_TRUE(stream.empty());
+        TEST_TRUE(stream.str() == "Hello 42");
+
+        // endl flushes
+        stream << "ab" << fiber::endl;
+        TEST_EQUAL(stream.n_sink_calls, 2);
+        TEST_TRUE(stream.str() == "Hello 42ab\n");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult BufferedOStream_test_padding(){
+        TEST_START;
+
+        RecordingStream<8> stream;
+
+        // padding larger than the buffer is filled block wise
+        stream << FormatStr("x").mwidth(20).fill('.');
+        stream.put('-', 0);
+        stream.put('-', -3);
+        stream.flush();
+        TEST_TRUE(stream.str() == "...................x");
+        TEST_EQUAL(stream.n_sink_calls, 3);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult BufferedOStream_test_large_write(){
+        TEST_START;
+
+        RecordingStream<8> stream;
+
+        stream << "ab";
+        stream << "0123456789abcdef"; // larger than the buffer: flushes and bypasses it
+        TEST_TRUE(stream.empty());
+        TEST_EQUAL(stream.n_sink_calls, 2);
+        TEST_TRUE(stream.str() == "ab0123456789abcdef");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult BufferedOStream_test_partial_sink(){
+        TEST_START;
+
+        RecordingStream<8> stream;
+        stream.max_take = 3;
+
+        // drain takes only a part, so the following appends wrap around the ring buffer
+        stream << "abcde";
+        TEST_EQUAL(stream.drain(), 3);
+        TEST_EQUAL(stream.size(), 2);
+        TEST_EQUAL(stream.available(), 6);
+
+        stream << "fghij";
+        TEST_EQUAL(stream.size(), 7);
+        stream.put('k');
+        TEST_EQUAL(stream.available(), 0);
+        TEST_EQUAL(stream.n_sink_calls, 1);
+
+        // a full buffer drains before the next append
+        stream.put('l');
+        TEST_EQUAL(stream.n_sink_calls, 2);
+
+        stream.flush();
+        TEST_TRUE(stream.empty());
+        TEST_TRUE(stream.str() == "abcdefghijkl");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult BufferedOStream_test_try_write(){
+        TEST_START;
+
+        RecordingStream<8> stream;
+        stream.max_take = 5;
+        stream << "abcdef";
+        stream.drain();
+        TEST_EQUAL(stream.size(), 1);
+
+        // wraps around the end of the buffer and never drains
+        TEST_EQUAL(stream.try_write("ghijklmnop", 10), 7);
+        TEST_EQUAL(stream.size(), 8);
+        TEST_EQUAL(stream.n_sink_calls, 1);
+        TEST_EQUAL(stream.try_write("q", 1), 0);
+
+        stream.flush();
+        TEST_TRUE(stream.str() == "abcdefghijklm");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult BufferedOStream_test_scheduler_print(){
+        TEST_START;
+
+        g_mock_time = TimePoint(0);
+        Scheduler<2> scheduler(get_time);
+
+        RecordingStream<1024> stream;
+        stream << scheduler;
+        stream.flush();
+
+        // one sink call per full buffer instead of one virtual call per character
+        TEST_TRUE(stream.output_size > stream.capacity());
+        TEST_EQUAL(stream.n_sink_calls, static_cast<int>((stream.output_size + stream.capacity() - 1) / stream.capacity()));
+        TEST_TRUE(stream.str().find("Waiting:") != std::string_view::npos);
+
+        TEST_END;
+    }
+
+    fiber::TestResult BufferedOStream_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | BufferedOStream_test_buffering
+            | BufferedOStream_test_padding
+            | BufferedOStream_test_large_write
+            | BufferedOStream_test_partial_sink
+            | BufferedOStream_test_try_write
+            | BufferedOStream_test_scheduler_print
+            ;
+    }
+} // namespace fiber
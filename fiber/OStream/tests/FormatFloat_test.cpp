@@ -0,0 +1,318 @@
+#include "FormatFloat_test.hpp"
+
+// std
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+// fiber
+#include <fiber/OStream/OStream.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        struct Recorder : public OStream{
+            char output[1024];
+            size_t size = 0;
+            void put(char c) final {this->output[this->size++] = c;}
+            void flush() final {}
+            std::string_view str() const {return std::string_view(this->output, this->size);}
+        };
+
+        template<class Float>
+        std::string_view format(Recorder& recorder, const FormatFloat<Float>& value){
+            recorder.size = 0;
+            recorder << value;
+            return recorder.str();
+        }
+
+        uint64_t next_random(uint64_t& state){
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            return state;
+        }
+
+        /// reads the digits back with `strtof`/`strtod`
+        template<class Float>
+        Float read_back(const char* digits, int length, int exponent10){
+            char text[48];
+            std::snprintf(text, sizeof(text), "%.*se%d", length, digits, exponent10);
+            if constexpr (std::is_same_v<Float, float>){
+                return std::strtof(text, nullptr);
+            }else{
+                return std::strtod(text, nullptr);
+            }
+        }
+
+        /// returns 1 if the shortest digits of the value do not read back as the same value
+        template<class Float>
+        int n_wrong_round_trip(Float value){
+            if(!(value > 0) || fiber::is_inf(value)) return 0;
+            char digits[32];
+            int exponent10;
+            const int length = shortest_digits(value, digits, &exponent10);
+            const int max_length = std::numeric_limits<Float>::max_digits10;
+            return (length > max_length) || (read_back<Float>(digits, length, exponent10) != value);
+        }
+
+        template<class Float>
+        bool shortest_equals(Float value, std::string_view expected_digits, int expected_exponent10){
+            char digits[32];
+            int exponent10;
+            const int length = shortest_digits(value, digits, &exponent10);
+            return std::string_view(digits, length) == expected_digits && exponent10 == expected_exponent10;
+        }
+    }
+
+    static fiber::TestResult shortest_digits_test(){
+        TEST_START;
+
+        TEST_TRUE(shortest_equals(0.1f, "1", -1));
+        TEST_TRUE(shortest_equals(0.1, "1", -1));
+        TEST_TRUE(shortest_equals(0.3, "3", -1));
+        TEST_TRUE(shortest_equals(1.0 / 3.0, "3333333333333333", -16));
+        TEST_TRUE(shortest_equals(3.536f, "3536", -3));
+        TEST_TRUE(shortest_equals(23165546.231564, "23165546231564", -6));
+        TEST_TRUE(shortest_equals(std::numeric_limits<double>::max(), "17976931348623157", 292));
+        TEST_TRUE(shortest_equals(std::numeric_limits<double>::denorm_min(), "5", -324));
+        TEST_TRUE(shortest_equals(std::numeric_limits<float>::max(), "34028235", 31));
+        TEST_TRUE(shortest_equals(std::numeric_limits<float>::denorm_min(), "1", -45));
+
+        // random bit patterns of all magnitudes, including subnormals
+        int n_wrong = 0;
+        uint64_t state = 42;
+        for(int i = 0; i < 100'000; ++i){
+            const uint64_t bits = next_random(state);
+            n_wrong += n_wrong_round_trip(std::bit_cast<float>(static_cast<uint32_t>(bits >> 32)));
+            n_wrong += n_wrong_round_trip(std::bit_cast<double>(bits));
+        }
+
+        // every power of two, where the lower neighbour is closer
+        for(int exponent = -149; exponent < 128; ++exponent){
+            n_wrong += n_wrong_round_trip(std::ldexp(1.0f, exponent));
+        }
+        for(int exponent = -1074; exponent < 1024; ++exponent){
+            n_wrong += n_wrong_round_trip(std::ldexp(1.0, exponent));
+        }
+        TEST_EQUAL(n_wrong, 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult representations_test(){
+        TEST_START;
+
+        Recorder r;
+        TEST_TRUE(format(r, FormatFloat(3.536f)) == "3.536");
+        TEST_TRUE(format(r, FormatFloat(2.0)) == "2");
+        TEST_TRUE(format(r, FormatFloat(3.536f).fexp()) == "3.536e0");
+        TEST_TRUE(format(r, FormatFloat(2.0).fdeci()) == "2.000");
+        TEST_TRUE(format(r, FormatFloat(2.0).fcomma()) == "2.");
+
+        TEST_TRUE(format(r, FormatFloat(1.23e0).sci()) == "1.23");
+        TEST_TRUE(format(r, FormatFloat(1.23e1).sci()) == "1.23e1");
+        TEST_TRUE(format(r, FormatFloat(1.23e2).sci()) == "1.23e2");
+        TEST_TRUE(format(r, FormatFloat(1.23e3).sci()) == "1.23e3");
+        TEST_TRUE(format(r, FormatFloat(23165546.231564).sci()) == "2.317e7");
+        TEST_TRUE(format(r, FormatFloat(0.001234).sci()) == "1.234e-3");
+        TEST_TRUE(format(r, FormatFloat(9.9996f).sci()) == "1e1");
+
+        TEST_TRUE(format(r, FormatFloat(1.23e0).eng()) == "1.23");
+        TEST_TRUE(format(r, FormatFloat(1.23e1).eng()) == "12.3");
+        TEST_TRUE(format(r, FormatFloat(1.23e2).eng()) == "123");
+        TEST_TRUE(format(r, FormatFloat(1.23e3).eng()) == "1.23e3");
+        TEST_TRUE(format(r, FormatFloat(23165546.231564).eng()) == "23.166e6");
+        TEST_TRUE(format(r, FormatFloat(0.1).eng()) == "100e-3");
+        TEST_TRUE(format(r, FormatFloat(1e-20f).eng()) == "10e-21");
+        TEST_TRUE(format(r, FormatFloat(999.9996).eng()) == "1e3");
+
+        TEST_TRUE(format(r, FormatFloat(1.23e0).full()) == "1.23");
+        TEST_TRUE(format(r, FormatFloat(1.23e1).full()) == "12.3");
+        TEST_TRUE(format(r, FormatFloat(1.23e2).full()) == "123");
+        TEST_TRUE(format(r, FormatFloat(1.23e3).full()) == "1230");
+        TEST_TRUE(format(r, FormatFloat(23165546.231564).full()) == "23165546.232");
+        TEST_TRUE(format(r, FormatFloat(23165546.231564).full().thousands().decimals(5)) == "23,165,546.231,56");
+        TEST_TRUE(format(r, FormatFloat(0.1).full()) == "0.1");
+        TEST_TRUE(format(r, FormatFloat(0.0004).full()) == "0");
+        TEST_TRUE(format(r, FormatFloat(0.0005).full()) == "0.001");
+        TEST_TRUE(format(r, FormatFloat(1e20).full()) == "100000000000000000000");
+
+        // rounding half up on the exact binary value
+        TEST_TRUE(format(r, FormatFloat(1.0625f).full()) == "1.063");
+        TEST_TRUE(format(r, FormatFloat(2.675).full().decimals(2)) == "2.67"); // 2.67499999...
+
+        TEST_TRUE(format(r, FormatFloat(0.0)) == "0");
+        TEST_TRUE(format(r, FormatFloat(0.0).sci().fdeci().fexp()) == "0.000e0");
+        TEST_TRUE(format(r, FormatFloat(1.0 / 3.0).shortest()) == "333.3333333333333e-3");
+        TEST_TRUE(format(r, FormatFloat(0.1f + 0.2f).full().shortest()) == "0.3");
+        TEST_TRUE(format(r, FormatFloat(0.1 + 0.2).full().shortest()) == "0.30000000000000004");
+        TEST_TRUE(format(r, FormatFloat(1e-7).full().shortest()) == "0.0000001");
+        TEST_TRUE(format(r, FormatFloat(std::numeric_limits<double>::max()).sci().shortest()) == "1.7976931348623157e308");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult sign_and_padding_test(){
+        TEST_START;
+
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        const double inf = std::numeric_limits<double>::infinity();
+
+        Recorder r;
+        TEST_TRUE(format(r, FormatFloat(nan)) == "nan");
+        TEST_TRUE(format(r, FormatFloat(inf)) == "inf");
+        TEST_TRUE(format(r, FormatFloat(inf).fsign()) == "+inf");
+        TEST_TRUE(format(r, FormatFloat(-inf)) == "-inf");
+        TEST_TRUE(format(r, FormatFloat(-inf).mwidth(6)) == "  -inf");
+        TEST_TRUE(format(r, FormatFloat(-inf).mwidth(6).pad_sign()) == "-  inf");
+
+        TEST_TRUE(format(r, FormatFloat(-7.25f)) == "-7.25");
+        TEST_TRUE(format(r, FormatFloat(7.25f).fsign()) == "+7.25");
+        TEST_TRUE(format(r, FormatFloat(-7.25f).mwidth(8)) == "   -7.25");
+        TEST_TRUE(format(r, FormatFloat(-7.25f).mwidth(8).fill('0').pad_sign()) == "-0007.25");
+        TEST_TRUE(format(r, FormatFloat(-7.25f).mwidth(8).left()) == "-7.25   ");
+        TEST_TRUE(format(r, FormatFloat(-7.25f).mwidth(8).center()) == "  -7.25 ");
+        TEST_TRUE(format(r, FormatFloat(0.001234).sci().fexpsign().mwidth(10)) == "  1.234e-3");
+        TEST_TRUE(format(r, FormatFloat(1234.0).sci().fexpsign()) == "1.234e+3");
+        TEST_TRUE(format(r, FormatFloat(1234.5).full().comma(',').thousands('.')) == "1.234,5");
+
+        // long output that does not fit into any intermediate buffer
+        const std::string_view large = format(r, FormatFloat(1e300).full().shortest().thousands());
+        TEST_EQUAL(large.size(), 301u + 100u);
+        TEST_TRUE(large.substr(0, 8) == "1,000,00");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult matches_printf_test(){
+        TEST_START;
+
+        // "%.3e" as a reference for scientific representation with 3 forced decimals, skipping exact ties where printf rounds to even
+        int n_wrong = 0;
+        uint64_t state = 7;
+        Recorder r;
+        for(int i = 0; i < 20'000; ++i){
+            const uint64_t bits = next_random(state);
+            const int exponent = static_cast<int>(bits % 80) - 40;
+            const double value = std::ldexp(static_cast<double>(bits >> 11) / 9007199254740992.0 + 0.5, exponent);
+            for(bool is_float : {true, false}){
+                const double v = is_float ? static_cast<double>(static_cast<float>(value)) : value;
+
+                char exact[64];
+                std::snprintf(exact, sizeof(exact), "%.40e", v);
+                if(std::strncmp(exact + 5, "5000000000000000000000000", 25) == 0) continue;
+
+                // "d.ddde+XX" without the leading zeros and the plus of the exponent
+                char printed[32];
+                char expected[32];
+                std::snprintf(printed, sizeof(printed), "%.3e", v);
+                const int length = std::snprintf(expected, sizeof(expected), "%.5se%d", printed, std::atoi(printed + 6));
+
+                const std::string_view str = is_float
+                    ? format(r, FormatFloat(static_cast<float>(v)).sci().fdeci().fexp())
+                    : format(r, FormatFloat(v).sci().fdeci().fexp());
+                n_wrong += str != std::string_view(expected, length);
+            }
+        }
+        TEST_EQUAL(n_wrong, 0);
+
+        TEST_END;
+    }
+
+#ifdef FIBER_FMT_EXACT_DIGITS
+
+    static fiber::TestResult exact_digits_test(){
+        TEST_START;
+
+        // rounded from the exact value 0.1499999999999999944..., not from the shortest digits "15"
+        Recorder r;
+        TEST_TRUE(format(r, FormatFloat(0.15).sci().decimals(20)) == "1.49999999999999994449e-1");
+        TEST_TRUE(format(r, FormatFloat(0.15).sci().decimals(1)) == "1.5e-1");
+        TEST_TRUE(format(r, FormatFloat(1e300).full().decimals(0)).substr(0, 24) == "100000000000000005250476");
+        TEST_TRUE(format(r, FormatFloat(std::numeric_limits<double>::denorm_min()).sci().decimals(30)) == "4.940656458412465441765687928682e-324");
+
+        // "%.25e" and "%.40f" as references for precisions beyond the fixed point fast path, skipping exact ties where printf rounds to even
+        int n_wrong = 0;
+        uint64_t state = 11;
+        for(int i = 0; i < 2'000; ++i){
+            const uint64_t bits = next_random(state);
+            const int exponent = static_cast<int>(bits % 600) - 300;
+            const double value = std::ldexp(static_cast<double>(bits >> 11) / 9007199254740992.0 + 0.5, exponent);
+            for(bool is_float : {true, false}){
+                const double v = is_float ? static_cast<double>(static_cast<float>(value)) : value;
+                if(!(v > 0) || fiber::is_inf(v)) continue;
+
+                char exact[128];
+                std::snprintf(exact, sizeof(exact), "%.60e", v);
+                if(std::strncmp(exact + 27, "50000000000000000000000000000000", 32) == 0) continue;
+
+                char printed[64];
+                char expected[64];
+                std::snprintf(printed, sizeof(printed), "%.25e", v);
+                const int length = std::snprintf(expected, sizeof(expected), "%.27se%d", printed, std::atoi(printed + 28));
+                const std::string_view str = is_float
+                    ? format(r, FormatFloat(static_cast<float>(v)).sci().decimals(25).fdeci().fexp())
+                    : format(r, FormatFloat(v).sci().decimals(25).fdeci().fexp());
+                n_wrong += str != std::string_view(expected, length);
+
+                std::snprintf(exact, sizeof(exact), "%.80f", v);
+                if(v < 1e-5 && v > 1e-30 && std::strncmp(exact + 42, "50000000000000000000000000000000", 32) != 0){
+                    std::snprintf(expected, sizeof(expected), "%.40f", v);
+                    const std::string_view full = is_float
+                        ? format(r, FormatFloat(static_cast<float>(v)).full().decimals(40).fdeci())
+                        : format(r, FormatFloat(v).full().decimals(40).fdeci());
+                    n_wrong += full != std::string_view(expected);
+                }
+            }
+        }
+        TEST_EQUAL(n_wrong, 0);
+
+        TEST_END;
+    }
+
+#else
+
+    static fiber::TestResult rounded_digits_test(){
+        TEST_START;
+
+        // only the digits of a 64-bit integer are stored, the exact digits past the round-trip digits are printed as zeros
+        TEST_EQUAL(detail::float_digits_buffer_size<double>, 24u);
+        Recorder r;
+        TEST_TRUE(format(r, FormatFloat(0.15).sci().decimals(20)) == "1.5e-1");
+        TEST_TRUE(format(r, FormatFloat(0.15).sci().decimals(20).fdeci()) == "1.50000000000000000000e-1");
+        TEST_TRUE(format(r, FormatFloat(1.2345678e-30).sci().decimals(3)) == "1.235e-30");
+        // rounding carries into a new leading digit
+        TEST_TRUE(format(r, FormatFloat(9.9996e-30).sci().decimals(3)) == "1e-29");
+
+        const std::string_view large = format(r, FormatFloat(1e300).full().decimals(0));
+        TEST_EQUAL(large.size(), 301u);
+        TEST_TRUE(large.substr(0, 1) == "1");
+        TEST_TRUE(large.find_first_not_of('0', 1) == std::string_view::npos);
+
+        TEST_END;
+    }
+
+#endif
+
+    fiber::TestResult FormatFloat_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | shortest_digits_test
+            | representations_test
+            | sign_and_padding_test
+            | matches_printf_test
+            #ifdef FIBER_FMT_EXACT_DIGITS
+            | exact_digits_test
+            #else
+            | rounded_digits_test
+            #endif
+            ;
+    }
+} // namespace fiber
@@ -0,0 +1,157 @@
+#include "FormatInt_test.hpp"
+
+// std
+#include <cstdio>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+// fiber
+#include <fiber/OStream/OStream.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        /// formats with `snprintf` and inserts thousands separators as a reference
+        std::string_view reference_to_string(char* buffer, unsigned long long value, bool thousands){
+            char digits[32];
+            const int n = std::snprintf(digits, sizeof(digits), "%llu", value);
+            int len = 0;
+            for(int i = 0; i < n; ++i){
+                if(thousands && i != 0 && (n - i) % 3 == 0){buffer[len++] = ',';}
+                buffer[len++] = digits[i];
+            }
+            return std::string_view(buffer, len);
+        }
+
+        /// returns the number of values whose conversion differs from `snprintf`
+        template<class UInt>
+        int n_wrong_conversions(UInt value){
+            int n_wrong = 0;
+            for(bool thousands : {false, true}){
+                char buffer[32];
+                char expected[40];
+                const std::string_view str = uint_to_string(&buffer[0], &buffer[32], value, thousands, ',');
+                n_wrong += str != reference_to_string(expected, value, thousands);
+            }
+            return n_wrong;
+        }
+
+        int reference_count_digits(unsigned long long value){
+            int n = 1;
+            for(; value >= 10; value /= 10) ++n;
+            return n;
+        }
+    }
+
+    static fiber::TestResult count_digits_test(){
+        TEST_START;
+
+        TEST_EQUAL(count_digits(0u), 1);
+        TEST_EQUAL(count_digits(std::numeric_limits<uint8_t>::max()), 3);
+        TEST_EQUAL(count_digits(std::numeric_limits<uint16_t>::max()), 5);
+        TEST_EQUAL(count_digits(std::numeric_limits<uint32_t>::max()), 10);
+        TEST_EQUAL(count_digits(std::numeric_limits<uint64_t>::max()), 20);
+
+        // around every power of two and every power of ten
+        int n_wrong = 0;
+        for(int shift = 0; shift < 64; ++shift){
+            const uint64_t power = uint64_t(1) << shift;
+            for(uint64_t value : {power - 1, power, power + 1}){
+                n_wrong += count_digits(value) != reference_count_digits(value);
+            }
+        }
+        uint64_t power = 1;
+        for(int exponent = 0; exponent < 20; ++exponent, power *= 10){
+            for(uint64_t value : {power - 1, power, power + 1}){
+                n_wrong += count_digits(value) != reference_count_digits(value);
+            }
+        }
+        TEST_EQUAL(n_wrong, 0);
+
+        // the print buffers are sized at compile time
+        static_assert(uint_string_buffer_size<uint8_t> == 3);
+        static_assert(uint_string_buffer_size<uint32_t> == 13);
+        static_assert(uint_string_buffer_size<uint64_t> == 26);
+
+        // a buffer that fits exactly is enough, one character less is not
+        char buffer[5];
+        TEST_TRUE(uint_to_string(&buffer[0], &buffer[5], 12345u) == "12345");
+        TEST_TRUE(uint_to_string(&buffer[0], &buffer[5], 1234u, true, ',') == "1,234");
+        TEST_THROW(uint_to_string(&buffer[1], &buffer[5], 12345u));
+
+        TEST_END;
+    }
+
+    static fiber::TestResult uint_to_string_test(){
+        TEST_START;
+
+        int n_wrong = 0;
+
+        // every value with up to six digits
+        for(uint32_t value = 0; value < 1'000'000; ++value){
+            n_wrong += n_wrong_conversions(value);
+        }
+
+        // around every power of ten in every width
+        uint64_t power = 1;
+        for(int exponent = 0; exponent < 20; ++exponent, power *= 10){
+            for(uint64_t value : {power - 1, power, power + 1}){
+                n_wrong += n_wrong_conversions(value);
+                n_wrong += n_wrong_conversions(static_cast<uint32_t>(value));
+                n_wrong += n_wrong_conversions(static_cast<uint16_t>(value));
+                n_wrong += n_wrong_conversions(static_cast<uint8_t>(value));
+            }
+        }
+
+        // 64-bit values that need more than one 8 digit chunk
+        uint64_t value = 0x123456789ABCDEFULL;
+        for(int i = 0; i < 1000; ++i){
+            value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+            n_wrong += n_wrong_conversions(value);
+            n_wrong += n_wrong_conversions(value >> (i % 64));
+        }
+        n_wrong += n_wrong_conversions(std::numeric_limits<uint64_t>::max());
+        TEST_EQUAL(n_wrong, 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult signed_limits_test(){
+        TEST_START;
+
+        struct Recorder : public OStream{
+            char output[64];
+            size_t size = 0;
+            void put(char c) final {this->output[this->size++] = c;}
+            void flush() final {}
+            std::string_view str() const {return std::string_view(this->output, this->size);}
+        };
+
+        Recorder int_min;
+        int_min << std::numeric_limits<int32_t>::min();
+        TEST_TRUE(int_min.str() == "-2147483648");
+
+        Recorder int64_min;
+        int64_min << FormatInt(std::numeric_limits<int64_t>::min()).thousands();
+        TEST_TRUE(int64_min.str() == "-9,223,372,036,854,775,808");
+
+        Recorder padded;
+        padded << FormatInt(-42).mwidth(6).fill('0').pad_sign();
+        TEST_TRUE(padded.str() == "-00042");
+
+        TEST_END;
+    }
+
+    fiber::TestResult FormatInt_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | count_digits_test
+            | uint_to_string_test
+            | signed_limits_test
+            ;
+    }
+} // namespace fiber
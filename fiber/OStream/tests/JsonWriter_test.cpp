@@ -0,0 +1,133 @@
+#include "JsonWriter_test.hpp"
+
+// std
+#include <limits>
+#include <string_view>
+
+// fiber
+#include <fiber/OStream/JsonWriter.hpp>
+#include <fiber/OStream/SpanOStream.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    static fiber::TestResult JsonWriter_test_nesting(){
+        TEST_START;
+
+        char buffer[128];
+        SpanOStream stream(buffer);
+        JsonWriter json(stream);
+
+        json.begin_object();
+        json.field("name", "motor").field("rpm", 1200).field("on", true).field("error", nullptr);
+        TEST_EQUAL(json.depth(), 1);
+        json.key("list").begin_array().value(3).value(-7).begin_array().end_array().begin_object().end_object().end_array();
+        json.key("empty").begin_object().end_object();
+        json.end_object();
+
+        TEST_TRUE(json.is_complete());
+        TEST_TRUE(stream.view() == R"({"name":"motor","rpm":1200,"on":true,"error":null,"list":[3,-7,[],{}],"empty":{}})");
+
+        // top level values and arrays
+        stream.clear();
+        JsonWriter values(stream);
+        values.begin_array().value(false).value(uint8_t(255)).value(std::numeric_limits<int64_t>::min()).raw(R"({"a":1})").end_array();
+        TEST_TRUE(stream.view() == R"([false,255,-9223372036854775808,{"a":1}])");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult JsonWriter_test_escape(){
+        TEST_START;
+
+        char buffer[128];
+        SpanOStream stream(buffer);
+        JsonWriter json(stream);
+
+        json.value(std::string_view("a\"b\\c\nd\te\x01\x1f" "f\r\b\f/\xc3\xa4"));
+        TEST_TRUE(stream.view() == R"("a\"b\\c\nd\te\u0001\u001ff\r\b\f/)" "\xc3\xa4\"");
+
+        stream.clear();
+        JsonWriter keys(stream);
+        keys.begin_object().field("k\"ey", "").end_object();
+        TEST_TRUE(stream.view() == R"({"k\"ey":""})");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult JsonWriter_test_float(){
+        TEST_START;
+
+        char buffer[128];
+        SpanOStream stream(buffer);
+        JsonWriter json(stream);
+
+        json.begin_array();
+        json.value(0.5f).value(-1.25).value(0.0);
+        json.value(std::numeric_limits<float>::quiet_NaN()).value(std::numeric_limits<double>::infinity());
+        json.value(FormatFloat(3.25).sci().decimals(1));
+        json.end_array();
+
+        TEST_TRUE(stream.view() == "[0.5,-1.25,0,null,null,3.3]");
+
+        // plain decimals, the exponent form only for very small or very large magnitudes
+        char numbers_buffer[128];
+        SpanOStream numbers_stream(numbers_buffer);
+        JsonWriter numbers(numbers_stream);
+        numbers.begin_array();
+        numbers.value(41.5f).value(0.1 + 0.2).value(1200.0).value(-0.000125);
+        numbers.value(1e-7).value(2.5e21f).value(-1e300);
+        numbers.end_array();
+
+        TEST_TRUE(numbers_stream.view() == "[41.5,0.30000000000000004,1200,-0.000125,1e-7,2.5e21,-1e300]");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult JsonWriter_test_errors(){
+        TEST_START;
+
+        char buffer[64];
+        SpanOStream stream(buffer);
+
+        {
+            JsonWriter json(stream);
+            TEST_THROW(json.end_object());
+            TEST_THROW(json.key("a"));
+        }
+        {
+            JsonWriter json(stream);
+            json.begin_object();
+            TEST_THROW(json.value(1));
+            TEST_THROW(json.end_array());
+            json.key("a");
+            TEST_THROW(json.key("b"));
+            TEST_THROW(json.end_object());
+        }
+        {
+            JsonWriter json(stream);
+            json.begin_array();
+            TEST_THROW(json.key("a"));
+        }
+        {
+            JsonWriter json(stream);
+            for(int i = 0; i < JsonWriter::max_depth; ++i) json.begin_array();
+            TEST_THROW(json.begin_array());
+            for(int i = 0; i < JsonWriter::max_depth; ++i) json.end_array();
+            TEST_TRUE(json.is_complete());
+        }
+
+        TEST_END;
+    }
+
+    fiber::TestResult JsonWriter_test(){
+        TEST_GROUP;
+        return fiber::TestResult()
+            | JsonWriter_test_nesting
+            | JsonWriter_test_escape
+            | JsonWriter_test_float
+            | JsonWriter_test_errors
+            ;
+    }
+
+} // namespace fiber
@@ -0,0 +1,214 @@
+#include "LogBuffer_test.hpp"
+
+// std
+#if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+    #include <atomic>
+    #include <thread>
+#endif
+#include <string_view>
+
+// fiber
+#include <fiber/Chrono/TimePoint.hpp>
+#include <fiber/OS/Scheduler.hpp>
+#include <fiber/OS/Task.hpp>
+#include <fiber/OStream/LogBuffer.hpp>
+#include <fiber/OStream/SpanOStream.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        TimePoint g_log_time(0);
+        TimePoint get_log_time(){return g_log_time;}
+    }
+
+    static fiber::TestResult LogBuffer_test_merge(){
+        TEST_START;
+
+        char text[256];
+        SpanOStream sink(text);
+        LogAggregator logs(sink, get_log_time);
+
+        LogBuffer<64> a(logs);
+        LogBuffer<64> b(logs);
+        TEST_EQUAL(logs.size(), 2);
+
+        // lines are ordered by the time of their first character
+        g_log_time = TimePoint(5);
+        a << "a1" << fiber::newl;
+        g_log_time = TimePoint(3);
+        b << "b1" << fiber::newl;
+        TEST_EQUAL(logs.write_all(), 2);
+        TEST_TRUE(sink.view() == "b1\na1\n");
+
+        // incomplete lines are not written and do not interleave
+        sink.clear();
+        g_log_time = TimePoint(6);
+        a << "a2 " << 42;
+        g_log_time = TimePoint(7);
+        b << "b2" << fiber::endl;
+        TEST_EQUAL(logs.write_all(), 1);
+        TEST_TRUE(sink.view() == "b2\n");
+        g_log_time = TimePoint(8);
+        a << " done" << fiber::newl;
+        TEST_EQUAL(logs.write_all(), 1);
+        TEST_TRUE(sink.view() == "b2\na2 42 done\n");
+        TEST_FALSE(logs.write_next());
+
+        // many lines wrap around the end of the ring buffers
+        for(int i = 0; i < 20; ++i){
+            sink.clear();
+            a << "line " << i << fiber::newl;
+            b << FormatStr("x").fill('-').mwidth(20) << fiber::newl;
+            TEST_EQUAL(logs.write_all(), 2);
+            TEST_EQUAL(sink.size(), 7u + (i >= 10) + 21u);
+        }
+        TEST_EQUAL(a.dropped(), 0);
+        TEST_EQUAL(b.dropped(), 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult LogBuffer_test_full(){
+        TEST_START;
+
+        char text[256];
+        SpanOStream sink(text);
+        LogAggregator logs(sink, get_log_time);
+        g_log_time = TimePoint(0);
+
+        {
+            LogBuffer<32> log(logs);
+            constexpr size_t header = sizeof(TimePoint) <= 4 ? 8 : 16;
+
+            // the text that does not fit is dropped, the line end is kept
+            log << "0123456789012345678901234567890123456789" << fiber::newl;
+            TEST_EQUAL(log.dropped(), 40 - (32 - header - 1));
+            TEST_FALSE(log.empty());
+
+            // no space for another line
+            log << "dropped" << fiber::newl;
+            TEST_EQUAL(log.dropped_lines(), 1);
+
+            TEST_EQUAL(logs.write_all(), 1);
+            TEST_EQUAL(sink.size(), 32 - header);
+            TEST_EQUAL(sink.view().back(), '\n');
+
+            // the destructor writes the last lines and detaches
+            sink.clear();
+            log << "last";
+        }
+        TEST_TRUE(sink.view() == "last");
+        TEST_EQUAL(logs.size(), 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult LogBuffer_test_task(){
+        TEST_START;
+
+        char text[256];
+        SpanOStream sink(text);
+        LogAggregator logs(sink, get_log_time);
+        LogBuffer<64> log(logs);
+        g_log_time = TimePoint(0);
+
+        Task<256> logger("logger", 0, fiber::log_task, &logs, Duration(10));
+        Scheduler<1> scheduler(get_log_time);
+        scheduler.add(&logger);
+
+        log << "hello" << fiber::newl;
+        scheduler.spin();
+        TEST_TRUE(sink.view() == "hello\n");
+        TEST_EQUAL(scheduler.n_waiting(), 1);
+
+        // the logger sleeps for its period
+        log << "world" << fiber::newl;
+        g_log_time = TimePoint(5);
+        scheduler.spin();
+        TEST_TRUE(sink.view() == "hello\n");
+        g_log_time = TimePoint(10);
+        scheduler.spin();
+        TEST_TRUE(sink.view() == "hello\nworld\n");
+
+        logger.destroy();
+
+        TEST_END;
+    }
+
+#if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+
+    namespace
+    {
+        std::atomic<int> g_log_ticks = 0;
+        TimePoint get_log_ticks(){return TimePoint(g_log_ticks.load(std::memory_order_relaxed));}
+
+        /// counts the lines, only written by the core that holds the aggregator
+        struct LineCounter : public OStream{
+            size_t n_lines = 0;
+            size_t n_chars = 0;
+            void put(char c) final {++this->n_chars; this->n_lines += (c == '\n');}
+            void flush() final {}
+        };
+    }
+
+    /// @brief Destroys buffers on one thread while `log_task` writes them on another
+    static fiber::TestResult LogBuffer_test_multi_core_close(){
+        TEST_START;
+
+        static constexpr size_t n_buffers = 2000;
+
+        LineCounter sink;
+        LogAggregator logs(sink, get_log_ticks);
+        std::atomic<bool> stop = false;
+
+        std::thread logger_core([&](){
+            Task<256> logger("logger", 0, fiber::log_task, &logs, Duration(1));
+            Scheduler<1> scheduler(get_log_ticks);
+            scheduler.add(&logger);
+            while(!stop.load(std::memory_order_acquire)){
+                g_log_ticks.fetch_add(1, std::memory_order_relaxed);
+                scheduler.spin();
+            }
+            logger.destroy();
+        });
+
+        LogBuffer<64> long_lived(logs);
+        size_t n_chars = 0;
+        for(size_t i = 0; i < n_buffers; ++i){
+            LogBuffer<64> log(logs);
+            log << "line " << i << fiber::newl;
+            n_chars += sizeof("line 0\nlast") - 1 + (i >= 10) + (i >= 100) + (i >= 1000);
+            log << "last"; // committed by the destructor, without a line end
+            long_lived << "x" << fiber::newl;
+        }
+
+        stop.store(true, std::memory_order_release);
+        logger_core.join();
+        logs.write_all();
+
+        // every closed buffer wrote both of its lines before it was destroyed
+        const size_t n_long_lived = n_buffers - long_lived.dropped_lines();
+        TEST_EQUAL(logs.size(), 1u);
+        TEST_EQUAL(sink.n_lines, n_buffers + n_long_lived);
+        TEST_EQUAL(sink.n_chars, n_chars + 2 * n_long_lived - long_lived.dropped());
+
+        TEST_END;
+    }
+
+#endif
+
+    fiber::TestResult LogBuffer_test(){
+        TEST_GROUP;
+
+        return fiber::TestResult()
+            | LogBuffer_test_merge
+            | LogBuffer_test_full
+            | LogBuffer_test_task
+            #if defined(FIBER_MULTI_CORE) && defined(FIBER_CTEST)
+            | LogBuffer_test_multi_core_close
+            #endif
+            ;
+    }
+} // namespace fiber
@@ -0,0 +1,119 @@
+#include "SpanOStream_test.hpp"
+
+// std
+#include <span>
+#include <string_view>
+
+// fiber
+#include <fiber/OStream/ArrayListOStream.hpp>
+#include <fiber/OStream/SpanOStream.hpp>
+#include <fiber/OStream/format.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    static fiber::TestResult SpanOStream_test_write(){
+        TEST_START;
+
+        char buffer[64];
+        SpanOStream stream(buffer);
+        TEST_EQUAL(stream.capacity(), 64);
+        TEST_EQUAL(stream.size(), 0);
+
+        stream << "id: " << 42 << ' ' << FormatInt(7).mwidth(4) << fiber::newl;
+        TEST_TRUE(stream.view() == "id: 42    7\n");
+        TEST_EQUAL(stream.data(), buffer);
+        TEST_EQUAL(stream.span().size(), stream.size());
+        TEST_FALSE(stream.truncated());
+
+        // long strings and paddings take the block copy
+        stream.clear();
+        OStream& base = stream;
+        base.put('-', 20);
+        base.write("abcdefghijklmnopqrstuvwxyz", 26);
+        TEST_TRUE(stream.view() == "--------------------abcdefghijklmnopqrstuvwxyz");
+        TEST_EQUAL(stream.available(), 64 - 46);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult SpanOStream_test_truncation(){
+        TEST_START;
+
+        char buffer[8];
+        SpanOStream stream(std::span<char>(buffer, 8));
+
+        stream << "Hello";
+        stream.write("World", 5);
+        TEST_TRUE(stream.view() == "HelloWor");
+        TEST_TRUE(stream.truncated());
+        TEST_EQUAL(stream.dropped(), 2);
+
+        stream.put('x');
+        stream << "zero terminated";
+        static_cast<OStream&>(stream).put(' ', 3);
+        TEST_EQUAL(stream.size(), 8);
+        TEST_EQUAL(stream.dropped(), 2 + 1 + 15 + 3);
+
+        stream.clear();
+        TEST_FALSE(stream.truncated());
+        fiber::format<"{:>6}|{}">(stream, 1, "abc");
+        TEST_TRUE(stream.view() == "     1|a");
+        TEST_EQUAL(stream.dropped(), 2);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult ArrayListOStream_test_write(){
+        TEST_START;
+
+        ArrayList<char, 32> list{'>', ' '};
+        ArrayListOStream stream(list);
+        stream << "value " << -12 << fiber::newl;
+        TEST_TRUE(stream.view() == "> value -12\n");
+        TEST_EQUAL(list.size(), 12);
+        TEST_EQUAL(&stream.list(), &list);
+
+        // the list can be used while the stream writes to it
+        list.clear();
+        static_cast<OStream&>(stream).put('*', 17);
+        stream << "abc";
+        TEST_TRUE(stream.view() == "*****************abc");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult ArrayListOStream_test_truncation(){
+        TEST_START;
+
+        ArrayList<char, 6> list;
+        ArrayListOStream stream(list);
+        stream << "abcd" << "efgh";
+        TEST_TRUE(stream.view() == "abcdef");
+        TEST_TRUE(list.full());
+        TEST_EQUAL(stream.dropped(), 2);
+
+        stream.put('x');
+        static_cast<OStream&>(stream).put(' ', 4);
+        TEST_EQUAL(stream.dropped(), 7);
+
+        stream.clear_dropped();
+        list.clear();
+        stream << 123;
+        TEST_TRUE(stream.view() == "123");
+        TEST_FALSE(stream.truncated());
+
+        TEST_END;
+    }
+
+    fiber::TestResult SpanOStream_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | SpanOStream_test_write
+            | SpanOStream_test_truncation
+            | ArrayListOStream_test_write
+            | ArrayListOStream_test_truncation
+            ;
+    }
+} // namespace fiber
@@ -0,0 +1,118 @@
+#include "StaticOStream_test.hpp"
+
+// std
+#include <chrono>
+#include <string_view>
+
+// fiber
+#include <fiber/OStream/SpanOStream.hpp>
+#include <fiber/OStream/StaticOStream.hpp>
+#include <fiber/OStream/format.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    /// a sink that only offers `write()`
+    struct WriteOnlySink{
+        char buffer[512];
+        size_t size = 0;
+        int writes = 0;
+
+        void write(const char* str, size_t len){
+            for(size_t i = 0; i < len && this->size < sizeof(this->buffer); ++i) this->buffer[this->size++] = str[i];
+            ++this->writes;
+        }
+
+        std::string_view view() const {return std::string_view(this->buffer, this->size);}
+        void clear(){this->size = 0; this->writes = 0;}
+    };
+
+    /// a sink with the optional `put()` and `flush()`
+    struct FullSink : public WriteOnlySink{
+        int puts = 0;
+        int flushes = 0;
+
+        void put(char c){
+            this->write(&c, 1);
+            ++this->puts;
+        }
+        void flush(){++this->flushes;}
+    };
+
+    static const int printed_object = 0;
+
+    /// prints the same values to both streams
+    template<class Stream>
+    static void print_values(Stream& stream){
+        stream << "str " << FormatStr("ok").mwidth(6).center() << '|' << std::string_view("view") << fiber::newl;
+        stream << true << ' ' << FormatBool(false).num().mwidth(3) << fiber::newl;
+        stream << -42 << ' ' << 4711u << ' ' << FormatInt(1234567).thousands('.').fsign() << ' ' << FormatInt(-7).mwidth(5).pad_sign() << fiber::newl;
+        stream << FormatIntSuffix(64, "kB").mwidth(7).left() << std::chrono::milliseconds(250) << fiber::newl;
+        stream << 3.5f << ' ' << -0.125 << ' ' << FormatFloat(-2.5f).mwidth(8).pad_sign() << ' ' << FormatFloat(1.5).mwidth(7).left().fill('.') << fiber::newl;
+        stream << FormatFloat(1e300).full().decimals(0) << fiber::newl;
+        stream << FormatHex(0xBEEFu).fill('_').mwidth(12) << ' ' << &printed_object << ' ' << nullptr << fiber::newl;
+        fiber::format<"{:>6}|{:<5}|{:+.2f}\n">(stream, 42, "ab", 1.25);
+    }
+
+    static fiber::TestResult StaticOStream_test_same_as_virtual(){
+        TEST_START;
+
+        char buffer[1024];
+        SpanOStream expected(buffer);
+        print_values(expected);
+        TEST_FALSE(expected.truncated());
+
+        StaticOStream<WriteOnlySink> stream;
+        print_values(stream);
+        TEST_TRUE(stream.sink().view() == expected.view());
+
+        // the type erased interface writes the same
+        StaticOStream<FullSink> full_stream;
+        OStream& base = full_stream;
+        print_values(base);
+        TEST_TRUE(full_stream.sink().view() == stream.sink().view());
+
+        TEST_END;
+    }
+
+    static fiber::TestResult StaticOStream_test_sink_methods(){
+        TEST_START;
+
+        StaticOStream<WriteOnlySink> write_only;
+        write_only.put('a');
+        write_only.flush();
+        TEST_TRUE(write_only.sink().view() == "a");
+        TEST_EQUAL(write_only.sink().writes, 1);
+
+        // paddings are written in blocks of 16 characters
+        write_only.sink().clear();
+        write_only.put('-', 40);
+        TEST_EQUAL(write_only.sink().size, 40);
+        TEST_EQUAL(write_only.sink().writes, 3);
+        write_only.put('-', 0);
+        write_only.put('-', -5);
+        TEST_EQUAL(write_only.sink().writes, 3);
+
+        StaticOStream<FullSink> full(FullSink{});
+        full << 'x' << fiber::endl;
+        TEST_TRUE(full.sink().view() == "x\n");
+        TEST_EQUAL(full.sink().puts, 2);
+        TEST_EQUAL(full.sink().flushes, 1);
+
+        // works as a default stream
+        full.sink().clear();
+        OStreamRef ref(full);
+        ref << "ref " << 1;
+        TEST_TRUE(full.sink().view() == "ref 1");
+
+        TEST_END;
+    }
+
+    fiber::TestResult StaticOStream_test(){
+        TEST_GROUP;
+
+        return fiber::TestResult()
+            | StaticOStream_test_same_as_virtual
+            | StaticOStream_test_sink_methods;
+    }
+} // namespace fiber
@@ -0,0 +1,157 @@
+#include "format_test.hpp"
+
+// std
+#include <cstdint>
+#include <string_view>
+
+// fiber
+#include <fiber/OStream/format.hpp>
+#include <fiber/TestFramework/TestFramework.hpp>
+
+namespace fiber
+{
+    namespace
+    {
+        struct Recorder : public OStream{
+            char output[256];
+            size_t size = 0;
+            void put(char c) final {this->output[this->size++] = c;}
+            void flush() final {}
+            std::string_view str() const {return std::string_view(this->output, this->size);}
+        };
+
+        template<FormatString Fmt, class... Args>
+        std::string_view format_to_string(Recorder& recorder, const Args&... args){
+            recorder.size = 0;
+            fiber::format<Fmt>(recorder, args...);
+            return recorder.str();
+        }
+
+        struct Point{int x; int y;};
+
+        OStream& operator<<(OStream& stream, const Point& p){
+            return stream << '(' << p.x << ", " << p.y << ')';
+        }
+    }
+
+    static fiber::TestResult format_parse_test(){
+        TEST_START;
+
+        constexpr detail::ParsedFormat<"a{}bc{:>6}"> parsed{};
+        static_assert(parsed.segments.size() == 4);
+        static_assert(parsed.n_args == 2);
+        static_assert(!parsed.segments[0].is_field && parsed.segments[0].first == 0 && parsed.segments[0].length == 1);
+        static_assert(parsed.segments[1].is_field && parsed.segments[1].spec.arg_index == 0);
+        static_assert(!parsed.segments[2].is_field && parsed.segments[2].first == 3 && parsed.segments[2].length == 2);
+        static_assert(parsed.segments[3].spec.align == '>' && parsed.segments[3].spec.width == 6 && parsed.segments[3].spec.arg_index == 1);
+
+        constexpr detail::ParsedFormat<"{1:*^+010,.3e}{0}"> full_spec{};
+        constexpr detail::FormatSpec spec = full_spec.segments[0].spec;
+        static_assert(spec.arg_index == 1 && spec.fill == '*' && spec.align == '^' && spec.force_sign && spec.zero_pad);
+        static_assert(spec.width == 10 && spec.thousands && spec.precision == 3 && spec.type == 'e');
+        static_assert(full_spec.n_args == 2);
+
+        constexpr detail::ParsedFormat<"{{}}"> escaped{};
+        static_assert(escaped.segments.size() == 2 && escaped.n_args == 0);
+
+        TEST_END;
+    }
+
+    static fiber::TestResult format_int_test(){
+        TEST_START;
+
+        Recorder r;
+        TEST_TRUE(format_to_string<"{}">(r, 42) == "42");
+        TEST_TRUE(format_to_string<"[{:>6}]">(r, 42) == "[    42]");
+        TEST_TRUE(format_to_string<"[{:<6}]">(r, -42) == "[-42   ]");
+        TEST_TRUE(format_to_string<"[{:^6}]">(r, 42u) == "[  42  ]");
+        TEST_TRUE(format_to_string<"[{:*>6}]">(r, 42) == "[****42]");
+        TEST_TRUE(format_to_string<"{:+}">(r, 42) == "+42");
+        TEST_TRUE(format_to_string<"{:06}">(r, -42) == "-00042");
+        TEST_TRUE(format_to_string<"{:,}">(r, 1234567) == "1,234,567");
+        TEST_TRUE(format_to_string<"{:+,}">(r, int64_t(-1234567)) == "-1,234,567");
+        TEST_TRUE(format_to_string<"{}">(r, uint8_t(200)) == "200");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult format_float_test(){
+        TEST_START;
+
+        Recorder r;
+        TEST_TRUE(format_to_string<"{}">(r, 0.1) == "100e-3");
+        TEST_TRUE(format_to_string<"{:f}">(r, 0.1 + 0.2) == "0.30000000000000004");
+        TEST_TRUE(format_to_string<"{:.3e}">(r, 1234.56) == "1.235e3");
+        TEST_TRUE(format_to_string<"{:.3e}">(r, 2.0) == "2.000");
+        TEST_TRUE(format_to_string<"{:.2f}">(r, 3.14159f) == "3.14");
+        TEST_TRUE(format_to_string<"{:.3g}">(r, 1500.0) == "1.5e3");
+        TEST_TRUE(format_to_string<"{:e}">(r, 1500.0) == "1.5e3");
+        TEST_TRUE(format_to_string<"[{:>8.1f}]">(r, -7.25f) == "[    -7.3]");
+        TEST_TRUE(format_to_string<"{:+08.2f}">(r, 7.25f) == "+0007.25");
+        TEST_TRUE(format_to_string<"{:,.1f}">(r, 1234567.25) == "1,234,567.3");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult format_str_test(){
+        TEST_START;
+
+        Recorder r;
+        const char* name = "motor";
+        const std::string_view view = "temperature";
+
+        TEST_TRUE(format_to_string<"[{:<8}]">(r, name) == "[motor   ]");
+        TEST_TRUE(format_to_string<"[{:>8}]">(r, "abc") == "[     abc]");
+        TEST_TRUE(format_to_string<"[{:.4}]">(r, view) == "[temp]");
+        TEST_TRUE(format_to_string<"[{:-^7}]">(r, 'x') == "[---x---]");
+        TEST_TRUE(format_to_string<"{:d}">(r, 'A') == "65");
+        TEST_TRUE(format_to_string<"{} {:d}">(r, true, false) == "true 0");
+        TEST_TRUE(format_to_string<"{}">(r, Point{1, 2}) == "(1, 2)");
+
+        TEST_END;
+    }
+
+    static fiber::TestResult format_text_test(){
+        TEST_START;
+
+        Recorder r;
+        TEST_TRUE(format_to_string<"plain text">(r) == "plain text");
+        TEST_TRUE(format_to_string<"">(r).empty());
+        TEST_TRUE(format_to_string<"{{{}}}">(r, 7) == "{7}");
+        TEST_TRUE(format_to_string<"{1} {0} {1}">(r, "a", "b") == "b a b");
+        TEST_TRUE(format_to_string<"x={}, y={}\n">(r, 1, 2.5f) == "x=1, y=2.5\n");
+
+        TEST_END;
+    }
+
+    /// @brief the examples of the documentation, called exactly as documented
+    static fiber::TestResult format_cout_test(){
+        TEST_START;
+
+        Recorder r;
+        const OStreamRef previous = fiber::cout;
+        fiber::cout = r;
+
+        fiber::format<"{:>6} {:.3e}\n">(fiber::cout, 42, 1234.56);
+        fiber::format<"[{:<8}] {:+,}\n">(fiber::cout, "motor", 1200000);
+        fiber::format<"{:f}\n">(fiber::cout, 0.1 + 0.2);
+
+        fiber::cout = previous;
+        TEST_TRUE(r.str() == "    42 1.235e3\n[motor   ] +1,200,000\n0.30000000000000004\n");
+
+        TEST_END;
+    }
+
+    fiber::TestResult format_test(){
+        TEST_GROUP;
+
+        return TestResult()
+            | format_parse_test
+            | format_int_test
+            | format_float_test
+            | format_str_test
+            | format_text_test
+            | format_cout_test
+            ;
+    }
+} // namespace fiber
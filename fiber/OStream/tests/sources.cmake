@@ -1,6 +1,26 @@
 target_sources(fiber
     PUBLIC
+        ${CMAKE_CURRENT_LIST_DIR}/FormatInt_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/FormatFloat_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/format_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/BinaryLog_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/BufferedOStream_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/SpanOStream_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/StaticOStream_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/AsyncOStream_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/LogBuffer_test.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/JsonWriter_test.hpp
         ${CMAKE_CURRENT_LIST_DIR}/OStream_test.hpp
     PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/FormatInt_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/FormatFloat_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/format_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/BinaryLog_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/BufferedOStream_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/SpanOStream_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/StaticOStream_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/AsyncOStream_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/LogBuffer_test.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/JsonWriter_test.cpp
         ${CMAKE_CURRENT_LIST_DIR}/OStream_test.cpp
 )
\ No newline at end of file
@@ -0,0 +1,19 @@
+#include "benchmark.hpp"
+
+// fiber-benchmarks
+#include <fiber/Containers/benchmarks/ArrayList_benchmark.hpp>
+#include <fiber/Containers/benchmarks/DualPriorityQueue_benchmark.hpp>
+#include <fiber/Chrono/benchmarks/rounding_duration_cast_benchmark.hpp>
+#include <fiber/Future/benchmarks/Future_benchmark.hpp>
+#include <fiber/Memory/benchmarks/memory_benchmark.hpp>
+#include <fiber/OStream/benchmarks/OStream_benchmark.hpp>
+
+int benchmark_all(){
+    fiber::rounding_duration_cast_benchmark();
+    fiber::ArrayList_benchmark();
+    fiber::DualPriorityQueue_benchmark();
+    fiber::Future_benchmark();
+    fiber::memory_benchmark();
+    fiber::OStream_benchmark();
+    return 0;
+}
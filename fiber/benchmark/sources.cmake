@@ -0,0 +1,8 @@
+if(FIBER_COMPILE_BENCHMARKS)
+    target_sources(fiber
+        PUBLIC
+            ${CMAKE_CURRENT_LIST_DIR}/benchmark.hpp
+        PRIVATE
+            ${CMAKE_CURRENT_LIST_DIR}/benchmark.cpp
+    )
+endif()
@@ -113,6 +113,10 @@ namespace fiber{
         // empty
     }
 
+    FIBER_WEAK bool is_interrupt_context(){
+        return false;
+    }
+
     void disable_interrupts(){
         FIBER_ASSERT_CRITICAL(_irq_disable_count != std::numeric_limits<uint32_t>::max());
         #if defined(FIBER_SINGLE_CORE)
@@ -14,6 +14,17 @@ namespace fiber{
      */
     FIBER_WEAK void enable_interrupts_command();
 
+    /**
+     * @brief Weak, user overloadable function that returns `true` while an interrupt service routine is executed.
+     * 
+     * Used by assertions that detect code that must not run in an interrupt, because it could wait on the
+     * task that the interrupt preempted. Returns `false` by default. On ARM Cortex-M for example:
+     * ```cpp
+     * bool fiber::is_interrupt_context(){return __get_IPSR() != 0;}
+     * ```
+     */
+    FIBER_WEAK bool is_interrupt_context();
+
     /**
      * \brief Function that is used to disable the interrupts 
      * 
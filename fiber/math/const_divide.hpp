@@ -0,0 +1,117 @@
+#pragma once
+
+// std
+#include <bit>
+#include <cstdint>
+
+namespace fiber{
+
+    /// \brief The 128 bit result of a 64 bit multiplication
+    struct WideProduct{
+        uint64_t high = 0;
+        uint64_t low = 0;
+    };
+
+    /**
+     * \brief Multiplies two 64 bit integers to the full 128 bit result
+     *
+     * Uses `unsigned __int128` where the compiler has it, otherwise four 32 x 32 -> 64 bit multiplications,
+     * which are single instructions on 32 bit processors.
+     */
+    constexpr WideProduct mul_wide(uint64_t a, uint64_t b){
+        #ifdef __SIZEOF_INT128__
+            const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+            return WideProduct{static_cast<uint64_t>(product >> 64), static_cast<uint64_t>(product)};
+        #else
+            const uint64_t a_low = static_cast<uint32_t>(a);
+            const uint64_t a_high = a >> 32;
+            const uint64_t b_low = static_cast<uint32_t>(b);
+            const uint64_t b_high = b >> 32;
+
+            const uint64_t low_low = a_low * b_low;
+            const uint64_t high_low = a_high * b_low;
+            const uint64_t low_high = a_low * b_high;
+            const uint64_t high_high = a_high * b_high;
+
+            // sum of the middle parts, cannot overflow
+            const uint64_t middle = (low_low >> 32) + static_cast<uint32_t>(high_low) + static_cast<uint32_t>(low_high);
+            return WideProduct{
+                high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32),
+                (middle << 32) | static_cast<uint32_t>(low_low)
+            };
+        #endif
+    }
+
+    /// \brief Returns the upper 64 bits of the 128 bit product `a * b`
+    constexpr uint64_t mul_high(uint64_t a, uint64_t b){
+        return mul_wide(a, b).high;
+    }
+
+    /**
+     * \brief Divides a 128 bit number by a 64 bit number with a shift and subtract loop
+     * \returns the quotient or `UINT64_MAX` if it does not fit into 64 bits
+     */
+    constexpr uint64_t div_wide_saturate(WideProduct n, uint64_t d){
+        if(n.high >= d) return UINT64_MAX;
+        if(n.high == 0) return n.low / d;
+
+        uint64_t remainder = n.high;
+        uint64_t quotient = 0;
+        for(int i = 63; i >= 0; --i){
+            const bool carry = (remainder >> 63) != 0;
+            remainder = (remainder << 1) | ((n.low >> i) & 1);
+            if(carry || remainder >= d){
+                remainder -= d;
+                quotient |= uint64_t(1) << i;
+            }
+        }
+        return quotient;
+    }
+
+    /**
+     * \brief Division by the compile time constant `D` with a multiplication and shifts instead of a division instruction
+     *
+     * Compilers replace 32 bit divisions by constants with multiplications, but 64 bit divisions on 32 bit processors
+     * become calls of a slow library function. `ConstDivider` computes the reciprocal at compile time
+     * (Granlund and Montgomery, "Division by Invariant Integers using Multiplication", figure 4.1)
+     * and is exact for all 64 bit dividends.
+     *
+     * Example:
+     * ```C++
+     * const uint64_t ms = fiber::ConstDivider<20>::divide(ticks);
+     * ```
+     *
+     * \tparam D The divisor, larger than zero
+     */
+    template<uint64_t D>
+    struct ConstDivider{
+        static_assert(D != 0, "Division by zero");
+
+        static constexpr int log2_ceil = (D == 1) ? 0 : std::bit_width(D - 1);
+
+        /// computes `floor(2^64 * (2^l - D) / D) + 1` with a long division, only at compile time
+        static constexpr uint64_t compute_multiplier(){
+            const uint64_t high = (log2_ceil == 64) ? uint64_t(0) - D : (uint64_t(1) << log2_ceil) - D;
+            return div_wide_saturate(WideProduct{high, 0}, D) + 1;
+        }
+
+        static constexpr uint64_t multiplier = std::has_single_bit(D) ? 0 : compute_multiplier();
+        static constexpr int shift1 = (log2_ceil < 1) ? log2_ceil : 1;
+        static constexpr int shift2 = (log2_ceil > 1) ? log2_ceil - 1 : 0;
+
+        /// @brief returns `n / D`
+        static constexpr uint64_t divide(uint64_t n){
+            if constexpr (std::has_single_bit(D)){
+                return n >> std::countr_zero(D);
+            }else{
+                if constexpr (D <= UINT32_MAX){
+                    // compilers divide 32 bit numbers by constants with a single multiplication
+                    if(n <= UINT32_MAX) return static_cast<uint32_t>(n) / static_cast<uint32_t>(D);
+                }
+                const uint64_t t = mul_high(multiplier, n);
+                return (t + ((n - t) >> shift1)) >> shift2;
+            }
+        }
+    };
+
+} // namespace fiber
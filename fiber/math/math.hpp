@@ -46,6 +46,39 @@ namespace fiber{
     inline bool is_inf(float value){
         return is_pinf(value) || is_ninf(value);
     }
+
+    inline bool is_nan(double value) {
+        const uint64_t i = std::bit_cast<uint64_t>(value);
+        return ((i & 0x7FF0000000000000) == 0x7FF0000000000000) && ((i & 0x000FFFFFFFFFFFFF) != 0);
+    }
+
+    inline bool is_pinf(double value) {
+        return std::bit_cast<uint64_t>(value) == 0x7FF0000000000000;
+    }
+
+    inline bool is_ninf(double value) {
+        return std::bit_cast<uint64_t>(value) == 0xFFF0000000000000;
+    }
+
+    inline bool is_inf(double value){
+        return is_pinf(value) || is_ninf(value);
+    }
+
+    /**
+     * \brief Writes the shortest decimal digits that read back as exactly the same floating point value
+     *
+     * Uses Grisu2 with 64-bit integer arithmetic only, no `libm` and no floating point operations.
+     * The result is the shortest for nearly all values, for the rest it has one digit more than necessary.
+     *
+     * \param value a positive and finite number that is not zero
+     * \param digits output buffer for at least 9 (`float`) or 17 (`double`) characters, not terminated
+     * \param exponent10_out the decimal exponent of the last digit, so that `value == digits * 10^exponent10_out`
+     * \returns the number of digits written
+     */
+    int shortest_digits(float value, char* digits, int* exponent10_out);
+
+    /// \copydoc shortest_digits(float, char*, int*)
+    int shortest_digits(double value, char* digits, int* exponent10_out);
     
 
 
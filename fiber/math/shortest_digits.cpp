@@ -0,0 +1,284 @@
+#include <fiber/math/math.hpp>
+
+// std
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace fiber{
+
+    // Grisu2 by Florian Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with Integers" (2010).
+    // Only uses 64-bit integer arithmetic. The digits always read back as the same value and are the shortest
+    // such digits for all but a tiny fraction of inputs, where one more digit than necessary is printed.
+
+    namespace{
+
+        /// a floating point number `f * 2^e` with a 64-bit significand
+        struct DiyFp{
+            uint64_t f;
+            int e;
+
+            static DiyFp sub(DiyFp x, DiyFp y){
+                return DiyFp{x.f - y.f, x.e};
+            }
+
+            /// returns the upper 64 bit of the 128-bit product, rounded
+            static DiyFp mul(DiyFp x, DiyFp y){
+                const uint64_t u_lo = x.f & 0xFFFFFFFFu;
+                const uint64_t u_hi = x.f >> 32;
+                const uint64_t v_lo = y.f & 0xFFFFFFFFu;
+                const uint64_t v_hi = y.f >> 32;
+
+                const uint64_t p0 = u_lo * v_lo;
+                const uint64_t p1 = u_lo * v_hi;
+                const uint64_t p2 = u_hi * v_lo;
+                const uint64_t p3 = u_hi * v_hi;
+
+                uint64_t q = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+                q += uint64_t(1) << 31; // round
+
+                const uint64_t h = p3 + (p1 >> 32) + (p2 >> 32) + (q >> 32);
+                return DiyFp{h, x.e + y.e + 64};
+            }
+
+            static DiyFp normalize(DiyFp x){
+                const int shift = std::countl_zero(x.f);
+                return DiyFp{x.f << shift, x.e - shift};
+            }
+
+            static DiyFp normalize_to(DiyFp x, int target_exponent){
+                return DiyFp{x.f << (x.e - target_exponent), target_exponent};
+            }
+        };
+
+        /// the value and the normalized midpoints to its neighbours
+        struct Boundaries{
+            DiyFp w;
+            DiyFp minus;
+            DiyFp plus;
+        };
+
+        template<class Float>
+        Boundaries compute_boundaries(Float value){
+            constexpr int precision = std::numeric_limits<Float>::digits; // including the hidden bit
+            constexpr int bias = std::numeric_limits<Float>::max_exponent - 1 + (precision - 1);
+            constexpr int min_exponent = 1 - bias;
+            constexpr uint64_t hidden_bit = uint64_t(1) << (precision - 1);
+            using Bits = std::conditional_t<(sizeof(Float) == 4), uint32_t, uint64_t>;
+
+            const uint64_t bits = std::bit_cast<Bits>(value);
+            const uint64_t biased_exponent = bits >> (precision - 1);
+            const uint64_t fraction = bits & (hidden_bit - 1);
+
+            const DiyFp v = (biased_exponent == 0)
+                ? DiyFp{fraction, min_exponent} // subnormal
+                : DiyFp{fraction + hidden_bit, static_cast<int>(biased_exponent) - bias};
+
+            // the next smaller value is closer if the fraction is zero, because the exponent steps down
+            const bool lower_boundary_is_closer = (fraction == 0) && (biased_exponent > 1);
+            const DiyFp m_plus{2 * v.f + 1, v.e - 1};
+            const DiyFp m_minus = lower_boundary_is_closer ? DiyFp{4 * v.f - 1, v.e - 2} : DiyFp{2 * v.f - 1, v.e - 1};
+
+            const DiyFp w_plus = DiyFp::normalize(m_plus);
+            const DiyFp w_minus = DiyFp::normalize_to(m_minus, w_plus.e);
+            return Boundaries{DiyFp::normalize(v), w_minus, w_plus};
+        }
+
+        // the scaled boundaries have binary exponents in [alpha, gamma], so the integral part fits into 32 bit
+        constexpr int alpha = -60;
+        constexpr int gamma = -32;
+
+        struct CachedPower{
+            uint64_t f;
+            int16_t e;
+            int16_t k;
+        };
+
+        /// returns a power of ten `c = f * 2^e = 10^k` such that `alpha <= e + binary_exponent + 64 <= gamma`
+        CachedPower cached_power_for_binary_exponent(int binary_exponent){
+            // 10^k for k = -300, -292, ..., 324, normalized to 64 bit and rounded
+            static constexpr CachedPower cached_powers[] = {
+            {0xAB70FE17C79AC6CA, -1060, -300},
+            {0xFF77B1FCBEBCDC4F, -1034, -292},
+            {0xBE5691EF416BD60C, -1007, -284},
+            {0x8DD01FAD907FFC3C, -980, -276},
+            {0xD3515C2831559A83, -954, -268},
+            {0x9D71AC8FADA6C9B5, -927, -260},
+            {0xEA9C227723EE8BCB, -901, -252},
+            {0xAECC49914078536D, -874, -244},
+            {0x823C12795DB6CE57, -847, -236},
+            {0xC21094364DFB5637, -821, -228},
+            {0x9096EA6F3848984F, -794, -220},
+            {0xD77485CB25823AC7, -768, -212},
+            {0xA086CFCD97BF97F4, -741, -204},
+            {0xEF340A98172AACE5, -715, -196},
+            {0xB23867FB2A35B28E, -688, -188},
+            {0x84C8D4DFD2C63F3B, -661, -180},
+            {0xC5DD44271AD3CDBA, -635, -172},
+            {0x936B9FCEBB25C996, -608, -164},
+            {0xDBAC6C247D62A584, -582, -156},
+            {0xA3AB66580D5FDAF6, -555, -148},
+            {0xF3E2F893DEC3F126, -529, -140},
+            {0xB5B5ADA8AAFF80B8, -502, -132},
+            {0x87625F056C7C4A8B, -475, -124},
+            {0xC9BCFF6034C13053, -449, -116},
+            {0x964E858C91BA2655, -422, -108},
+            {0xDFF9772470297EBD, -396, -100},
+            {0xA6DFBD9FB8E5B88F, -369, -92},
+            {0xF8A95FCF88747D94, -343, -84},
+            {0xB94470938FA89BCF, -316, -76},
+            {0x8A08F0F8BF0F156B, -289, -68},
+            {0xCDB02555653131B6, -263, -60},
+            {0x993FE2C6D07B7FAC, -236, -52},
+            {0xE45C10C42A2B3B06, -210, -44},
+            {0xAA242499697392D3, -183, -36},
+            {0xFD87B5F28300CA0E, -157, -28},
+            {0xBCE5086492111AEB, -130, -20},
+            {0x8CBCCC096F5088CC, -103, -12},
+            {0xD1B71758E219652C, -77, -4},
+            {0x9C40000000000000, -50, 4},
+            {0xE8D4A51000000000, -24, 12},
+            {0xAD78EBC5AC620000, 3, 20},
+            {0x813F3978F8940984, 30, 28},
+            {0xC097CE7BC90715B3, 56, 36},
+            {0x8F7E32CE7BEA5C70, 83, 44},
+            {0xD5D238A4ABE98068, 109, 52},
+            {0x9F4F2726179A2245, 136, 60},
+            {0xED63A231D4C4FB27, 162, 68},
+            {0xB0DE65388CC8ADA8, 189, 76},
+            {0x83C7088E1AAB65DB, 216, 84},
+            {0xC45D1DF942711D9A, 242, 92},
+            {0x924D692CA61BE758, 269, 100},
+            {0xDA01EE641A708DEA, 295, 108},
+            {0xA26DA3999AEF774A, 322, 116},
+            {0xF209787BB47D6B85, 348, 124},
+            {0xB454E4A179DD1877, 375, 132},
+            {0x865B86925B9BC5C2, 402, 140},
+            {0xC83553C5C8965D3D, 428, 148},
+            {0x952AB45CFA97A0B3, 455, 156},
+            {0xDE469FBD99A05FE3, 481, 164},
+            {0xA59BC234DB398C25, 508, 172},
+            {0xF6C69A72A3989F5C, 534, 180},
+            {0xB7DCBF5354E9BECE, 561, 188},
+            {0x88FCF317F22241E2, 588, 196},
+            {0xCC20CE9BD35C78A5, 614, 204},
+            {0x98165AF37B2153DF, 641, 212},
+            {0xE2A0B5DC971F303A, 667, 220},
+            {0xA8D9D1535CE3B396, 694, 228},
+            {0xFB9B7CD9A4A7443C, 720, 236},
+            {0xBB764C4CA7A44410, 747, 244},
+            {0x8BAB8EEFB6409C1A, 774, 252},
+            {0xD01FEF10A657842C, 800, 260},
+            {0x9B10A4E5E9913129, 827, 268},
+            {0xE7109BFBA19C0C9D, 853, 276},
+            {0xAC2820D9623BF429, 880, 284},
+            {0x80444B5E7AA7CF85, 907, 292},
+            {0xBF21E44003ACDD2D, 933, 300},
+            {0x8E679C2F5E44FF8F, 960, 308},
+            {0xD433179D9C8CB841, 986, 316},
+            {0x9E19DB92B4E31BA9, 1013, 324},
+            };
+            constexpr int min_decimal_exponent = -300;
+            constexpr int decimal_step = 8;
+
+            // k = ceil((alpha - e - 1) * log10(2))
+            const int f = alpha - binary_exponent - 1;
+            const int k = (f * 78913) / (1 << 18) + static_cast<int>(f > 0);
+            const int index = (-min_decimal_exponent + k + (decimal_step - 1)) / decimal_step;
+            return cached_powers[index];
+        }
+
+        /// returns the number of decimal digits of `n` and sets `pow10` to the largest power of ten `<= n`
+        int find_largest_pow10(uint32_t n, uint32_t& pow10){
+            constexpr uint32_t powers[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+            int digits = 10;
+            while(digits > 1 && n < powers[digits - 1]) --digits;
+            pow10 = powers[digits - 1];
+            return digits;
+        }
+
+        /// moves the last digit towards `w` as long as the result stays inside the boundaries
+        void round_weed(char* digits, int length, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t ten_k){
+            while(rest < dist && delta - rest >= ten_k && (rest + ten_k < dist || dist - rest > rest + ten_k - dist)){
+                --digits[length - 1];
+                rest += ten_k;
+            }
+        }
+
+        /// generates the shortest digits in `[M_minus, M_plus]` that are closest to `w`
+        int generate_digits(char* digits, int& decimal_exponent, DiyFp M_minus, DiyFp w, DiyFp M_plus){
+            uint64_t delta = DiyFp::sub(M_plus, M_minus).f;
+            uint64_t dist = DiyFp::sub(M_plus, w).f;
+
+            // split M_plus into an integral part p1 and a fractional part p2
+            const DiyFp one{uint64_t(1) << -M_plus.e, M_plus.e};
+            uint32_t p1 = static_cast<uint32_t>(M_plus.f >> -one.e);
+            uint64_t p2 = M_plus.f & (one.f - 1);
+
+            int length = 0;
+            uint32_t pow10 = 0;
+            int n = find_largest_pow10(p1, pow10);
+
+            // integral digits
+            while(n > 0){
+                const uint32_t d = p1 / pow10;
+                p1 = p1 % pow10;
+                digits[length++] = static_cast<char>('0' + d);
+                --n;
+
+                const uint64_t rest = (uint64_t(p1) << -one.e) + p2;
+                if(rest <= delta){
+                    decimal_exponent += n;
+                    round_weed(digits, length, dist, delta, rest, uint64_t(pow10) << -one.e);
+                    return length;
+                }
+                pow10 /= 10;
+            }
+
+            // fractional digits
+            int m = 0;
+            while(true){
+                p2 *= 10;
+                digits[length++] = static_cast<char>('0' + (p2 >> -one.e));
+                p2 &= one.f - 1;
+                ++m;
+                delta *= 10;
+                dist *= 10;
+                if(p2 <= delta) break;
+            }
+            decimal_exponent -= m;
+            round_weed(digits, length, dist, delta, p2, one.f);
+            return length;
+        }
+
+        template<class Float>
+        int grisu2(Float value, char* digits, int* exponent10_out){
+            const Boundaries b = compute_boundaries(value);
+            const CachedPower cached = cached_power_for_binary_exponent(b.plus.e);
+            const DiyFp c_minus_k{cached.f, cached.e};
+
+            const DiyFp w = DiyFp::mul(b.w, c_minus_k);
+            const DiyFp w_minus = DiyFp::mul(b.minus, c_minus_k);
+            const DiyFp w_plus = DiyFp::mul(b.plus, c_minus_k);
+
+            // shrink the interval by one unit to account for the rounding of the multiplications
+            const DiyFp M_minus{w_minus.f + 1, w_minus.e};
+            const DiyFp M_plus{w_plus.f - 1, w_plus.e};
+
+            int decimal_exponent = -cached.k;
+            const int length = generate_digits(digits, decimal_exponent, M_minus, w, M_plus);
+            *exponent10_out = decimal_exponent;
+            return length;
+        }
+
+    } // namespace
+
+    int shortest_digits(float value, char* digits, int* exponent10_out){
+        return grisu2(value, digits, exponent10_out);
+    }
+
+    int shortest_digits(double value, char* digits, int* exponent10_out){
+        return grisu2(value, digits, exponent10_out);
+    }
+
+} // namespace fiber
@@ -1,6 +1,8 @@
 target_sources(fiber
     PUBLIC
+        ${CMAKE_CURRENT_LIST_DIR}/const_divide.hpp
         ${CMAKE_CURRENT_LIST_DIR}/math.hpp
     PRIVATE
         ${CMAKE_CURRENT_LIST_DIR}/math.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/shortest_digits.cpp
 )
\ No newline at end of file
@@ -3,10 +3,34 @@
 // fiber-tests
 #include <fiber/Containers/tests/ArrayList_test.hpp>
 #include <fiber/Containers/tests/DualArrayList_test.hpp>
+#include <fiber/Containers/tests/DualPriorityQueue_test.hpp>
+#include <fiber/Containers/tests/IntrusiveList_test.hpp>
+#include <fiber/Containers/tests/IntrusivePairingHeap_test.hpp>
+#include <fiber/Containers/tests/PriorityQueue_test.hpp>
+#include <fiber/Containers/tests/SpscRing_test.hpp>
+#include <fiber/Containers/tests/BipBuffer_test.hpp>
+#include <fiber/Containers/tests/StaticHashMap_test.hpp>
+#include <fiber/Containers/tests/SmallArrayList_test.hpp>
 #include <fiber/Chrono/tests/Clock_test.hpp>
+#include <fiber/Chrono/tests/rounding_duration_cast_test.hpp>
 #include <fiber/Future/tests/Future_test.hpp>
+#include <fiber/Future/tests/SharedFuture_test.hpp>
+#include <fiber/Future/tests/Continuation_test.hpp>
+#include <fiber/Memory/tests/memory_test.hpp>
 #include <fiber/OS/tests/Coroutine_test.hpp>
+#include <fiber/OS/tests/PeriodicTask_test.hpp>
 #include <fiber/OS/tests/Scheduler_test.hpp>
+#include <fiber/OS/tests/TimerService_test.hpp>
+#include <fiber/OStream/tests/BufferedOStream_test.hpp>
+#include <fiber/OStream/tests/SpanOStream_test.hpp>
+#include <fiber/OStream/tests/StaticOStream_test.hpp>
+#include <fiber/OStream/tests/AsyncOStream_test.hpp>
+#include <fiber/OStream/tests/LogBuffer_test.hpp>
+#include <fiber/OStream/tests/JsonWriter_test.hpp>
+#include <fiber/OStream/tests/FormatInt_test.hpp>
+#include <fiber/OStream/tests/FormatFloat_test.hpp>
+#include <fiber/OStream/tests/format_test.hpp>
+#include <fiber/OStream/tests/BinaryLog_test.hpp>
 #include <fiber/OStream/tests/OStream_test.hpp>
 
 #include <iostream>
@@ -22,10 +46,34 @@ int test_all(){
         return fiber::TestResult()
             | fiber::ArrayList_test
             | fiber::DualArrayList_test
+            | fiber::DualPriorityQueue_test
+            | fiber::IntrusiveList_test
+            | fiber::IntrusivePairingHeap_test
+            | fiber::PriorityQueue_test
+            | fiber::SpscRing_test
+            | fiber::BipBuffer_test
+            | fiber::StaticHashMap_test
+            | fiber::SmallArrayList_test
             | fiber::ClockTick_test
+            | fiber::rounding_duration_cast_test
             | fiber::Future_test
+            | fiber::SharedFuture_test
+            | fiber::Continuation_test
+            | fiber::memory_test
+            | fiber::BufferedOStream_test
+            | fiber::SpanOStream_test
+            | fiber::StaticOStream_test
+            | fiber::AsyncOStream_test
+            | fiber::LogBuffer_test
+            | fiber::JsonWriter_test
+            | fiber::FormatInt_test
+            | fiber::FormatFloat_test
+            | fiber::format_test
+            | fiber::BinaryLog_test
             | fiber::Coroutine_test
             | fiber::Scheduler_test
+            | fiber::TimerService_test
+            | fiber::PeriodicTask_test
             | fiber::evaluate 
             ;
     #ifndef FIBER_DISABLE_EXCEPTIONS